@@ -677,6 +677,7 @@ class CLI
         #gem_install: [ Proc.new { ::InstallGem }, {primary: false, working: false}], # DLM: needs Ruby built with FFI
         measure: [ Proc.new { ::Measure }, {primary: true, working: false}],
         update: [ Proc.new { ::Update }, {primary: true, working: false}],
+        translate: [ Proc.new { ::Translate }, {primary: true, working: true}],
         execute_ruby_script: [ Proc.new { ::ExecuteRubyScript }, {primary: false, working: true}],
         #interactive_ruby: [ Proc.new { ::InteractiveRubyShell }, {primary: false, working: false}], # DLM: not working
         openstudio_version: [ Proc.new { ::OpenStudioVersion }, {primary: true, working: true}],
@@ -1462,6 +1463,95 @@ class Update
   end
 end
 
+# Class to translate an OpenStudio Model to EnergyPlus, optionally profiling the translation
+class Translate
+
+  # Provides text for the main help functionality
+  def self.synopsis
+    'Translates an OpenStudio Model to an EnergyPlus IDF'
+  end
+
+  # Executes code to translate a model and write the IDF and translation profile
+  #
+  # @param [Array] sub_argv Options passed to the translate command from the user input
+  # @return [Fixnum] Return status
+  #
+  def execute(sub_argv)
+
+    $logger.info "Translate, sub_argv = #{sub_argv}"
+
+    options = {}
+    options[:output] = nil
+    options[:profile] = nil
+    options[:chrome_trace] = nil
+
+    opts = OptionParser.new do |o|
+      o.banner = 'Usage: openstudio translate [options] PATH'
+      o.separator ''
+      o.separator 'Options:'
+      o.separator ''
+
+      o.on('-o', '--output PATH', 'Path of the IDF to write, defaults to PATH with an .idf extension') do |path|
+        options[:output] = path
+      end
+      o.on('-p', '--profile PATH', 'Write the time spent in each translation stage to PATH as JSON') do |path|
+        options[:profile] = path
+      end
+      o.on('-t', '--chrome-trace PATH', 'Write the translation stages to PATH in the Chrome trace event format') do |path|
+        options[:chrome_trace] = path
+      end
+    end
+
+    # Parse the options
+    argv = parse_options(opts, sub_argv)
+    return 0 if argv == nil
+
+    $logger.debug("Translate command: #{argv.inspect} #{options.inspect}")
+
+    if argv == []
+      $logger.error 'No path provided'
+      return 1
+    end
+    path = File.expand_path(argv[0])
+
+    unless File.file?(path)
+      $logger.error("Model does not exist at #{path}")
+      return 1
+    end
+
+    vt = OpenStudio::OSVersion::VersionTranslator.new
+    model = vt.loadModel(path)
+    if model.empty?
+      $logger.error("Could not read model at #{path}")
+      return 1
+    end
+
+    output = options[:output] ? File.expand_path(options[:output]) : path.sub(/\.osm$/i, '') + '.idf'
+
+    ft = OpenStudio::EnergyPlus::ForwardTranslator.new
+    ft.setProfileTranslation(!options[:profile].nil? || !options[:chrome_trace].nil?)
+    workspace = ft.translateModel(model.get)
+
+    ft.errors.each { |message| $logger.error(message.logMessage) }
+    ft.warnings.each { |message| $logger.warn(message.logMessage) }
+
+    unless workspace.save(OpenStudio::toPath(output), true)
+      $logger.error("Could not write IDF to #{output}")
+      return 1
+    end
+
+    profile = ft.translationProfile
+    if options[:profile]
+      File.open(File.expand_path(options[:profile]), 'w') { |f| f << profile.toJSON(true) }
+    end
+    if options[:chrome_trace]
+      File.open(File.expand_path(options[:chrome_trace]), 'w') { |f| f << profile.toChromeTrace }
+    end
+
+    0
+  end
+end
+
 # Class to execute a ruby script
 class ExecuteRubyScript
 
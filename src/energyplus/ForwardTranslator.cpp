@@ -69,6 +69,8 @@
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
+#include "../utilities/idd/IddFieldProperties.hpp"
+#include "../utilities/core/UUID.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
@@ -84,7 +86,13 @@
 
 #include "../utilities/idd/IddEnums.hpp"
 
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <atomic>
+#include <exception>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
 
 #include <sstream>
 
@@ -109,23 +117,86 @@ ForwardTranslator::ForwardTranslator()
   m_excludeSQliteOutputReport = false;
   m_excludeHTMLOutputReport = false;
   m_excludeVariableDictionary = false;
+  m_numThreads = 1;
+  m_profileTranslation = false;
+  m_stagedTranslation = nullptr;
+  m_stagingDepth = 0;
+  m_stageableTypes = &parallelTranslationTypes();
+  m_recordTranslatedRanges = false;
 }
 
 Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* progressBar )
 {
+  m_profiler.clear();
+
+  ProfilerStage copyStage(activeProfiler(), "Copy Model");
   Model modelCopy = model.clone(true).cast<Model>();
+  copyStage.end();
 
   m_progressBar = progressBar;
   if (m_progressBar){
     m_progressBar->setMinimum(0);
-    m_progressBar->setMaximum(model.numObjects());
+    m_progressBar->setMaximum(modelCopy.numObjects());
   }
 
   return translateModelPrivate(modelCopy, true);
 }
 
+Workspace ForwardTranslator::translateModelInPlace( Model & model, ProgressBar* progressBar )
+{
+  m_profiler.clear();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(model.numObjects());
+  }
+
+  return translateModelPrivate(model, true);
+}
+
+bool ForwardTranslator::translateModelToStream( const Model & model, std::ostream & os, ProgressBar* progressBar )
+{
+  m_profiler.clear();
+
+  ProfilerStage copyStage(activeProfiler(), "Copy Model");
+  Model modelCopy = model.clone(true).cast<Model>();
+  copyStage.end();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(modelCopy.numObjects());
+  }
+
+  translateModelToIdfObjects(modelCopy, true);
+
+  ProfilerStage writeStage(activeProfiler(), "Write IDF");
+  writeStage.setCount(m_idfObjects.size());
+  return writeIdfObjects(os);
+}
+
+bool ForwardTranslator::translateModelToStreamInPlace( Model & model, std::ostream & os, ProgressBar* progressBar )
+{
+  m_profiler.clear();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(model.numObjects());
+  }
+
+  translateModelToIdfObjects(model, true);
+
+  ProfilerStage writeStage(activeProfiler(), "Write IDF");
+  writeStage.setCount(m_idfObjects.size());
+  return writeIdfObjects(os);
+}
+
 Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
 {
+  m_profiler.clear();
+
   Model modelCopy;
   modelObject.clone(modelCopy);
 
@@ -187,7 +258,53 @@ void ForwardTranslator::setExcludeVariableDictionary(bool excludeVariableDiction
   m_excludeVariableDictionary = excludeVariableDictionary;
 }
 
+unsigned ForwardTranslator::numThreads() const {
+  return m_numThreads;
+}
+
+void ForwardTranslator::setNumThreads(unsigned numThreads) {
+  if (numThreads == 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  m_numThreads = numThreads;
+}
+
+void ForwardTranslator::setProfileTranslation(bool profileTranslation) {
+  m_profileTranslation = profileTranslation;
+}
+
+Profiler ForwardTranslator::translationProfile() const {
+  return m_profiler;
+}
+
+Profiler* ForwardTranslator::activeProfiler() {
+  if (m_profileTranslation) {
+    return &m_profiler;
+  }
+  return nullptr;
+}
+
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
+{
+  translateModelToIdfObjects(model, fullModelTranslation);
+
+  ProfilerStage workspaceStage(activeProfiler(), "Create Workspace");
+  workspaceStage.setCount(m_idfObjects.size());
+
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject vo = workspace.versionObject();
+  OS_ASSERT(vo);
+  workspace.removeObject(vo->handle());
+
+  workspace.setFastNaming(true);
+  workspace.addObjects(m_idfObjects);
+  workspace.setFastNaming(false);
+  OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
+
+  return workspace;
+}
+
+void ForwardTranslator::translateModelToIdfObjects( model::Model & model, bool fullModelTranslation )
 {
   reset();
 
@@ -199,6 +316,8 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
   model::Timestep timestep = model.getUniqueModelObject<model::Timestep>();
   translateAndMapModelObject(timestep);
 
+  ProfilerStage preprocessStage(activeProfiler(), "Preprocess Model");
+
   // resolve surface marching conflicts before combining thermal zones or removing spaces
   // as those operations may change search distances
   resolveMatchedSurfaceConstructionConflicts(model);
@@ -504,7 +623,11 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     }
   }
 
+  preprocessStage.end();
+
   if (fullModelTranslation){
+    ProfilerStage settingsStage(activeProfiler(), "Translate Simulation Settings");
+    size_t numIdfObjects = m_idfObjects.size();
 
     // translate life cycle cost parameters
     if( ! m_excludeLCCObjects ){
@@ -574,10 +697,34 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
       OutputMeter consumptionMeter = utilityBill.consumptionMeter();
       boost::optional<OutputMeter> peakDemandMeter = utilityBill.peakDemandMeter();
     }
+
+    settingsStage.setCount(m_idfObjects.size() - numIdfObjects);
+  }
+
+  // the model is not changed beyond this point other than by translators of other types
+  if (m_numThreads > 1){
+    ProfilerStage stagingStage(activeProfiler(), "Stage Objects");
+    stageModelObjects(model);
+    size_t numStagedObjects = 0;
+    for (const auto& stagedTranslation : m_stagedTranslations){
+      numStagedObjects += stagedTranslation.second.idfObjects.size();
+    }
+    stagingStage.setCount(numStagedObjects);
+  }
+
+  {
+    ProfilerStage constructionsStage(activeProfiler(), "Translate Constructions");
+    size_t numIdfObjects = m_idfObjects.size();
+    translateConstructions(model);
+    constructionsStage.setCount(m_idfObjects.size() - numIdfObjects);
   }
 
-  translateConstructions(model);
-  translateSchedules(model);
+  {
+    ProfilerStage schedulesStage(activeProfiler(), "Translate Schedules");
+    size_t numIdfObjects = m_idfObjects.size();
+    translateSchedules(model);
+    schedulesStage.setCount(m_idfObjects.size() - numIdfObjects);
+  }
 
   // Translate the Outdoor Air Node
   {
@@ -588,6 +735,9 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     idfObject.setName(node.name().get());
   }
 
+  ProfilerStage loopsStage(activeProfiler(), "Translate Loops");
+  size_t numIdfObjectsBeforeLoops = m_idfObjects.size();
+
   // get air loops in sorted order
   std::vector<AirLoopHVAC> airLoops = model.getConcreteModelObjects<AirLoopHVAC>();
   std::sort(airLoops.begin(), airLoops.end(), WorkspaceObjectNameLess());
@@ -609,15 +759,29 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     translateAndMapModelObject(plantLoop);
   }
 
+  loopsStage.setCount(m_idfObjects.size() - numIdfObjectsBeforeLoops);
+  loopsStage.end();
+
   // translate AFN
-  translateAirflowNetwork(model);
+  {
+    ProfilerStage airflowNetworkStage(activeProfiler(), "Translate Airflow Network");
+    size_t numIdfObjects = m_idfObjects.size();
+    translateAirflowNetwork(model);
+    airflowNetworkStage.setCount(m_idfObjects.size() - numIdfObjects);
+  }
 
   // now loop over all objects
+  ProfilerStage objectsStage(activeProfiler(), "Translate Objects");
+  size_t numIdfObjectsBeforeObjects = m_idfObjects.size();
+
   for (const IddObjectType& iddObjectType : iddObjectsToTranslate()){
 
     // get objects by type in sorted order
+    ProfilerStage sortStage(activeProfiler(), "Sort Objects");
     std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
     std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+    sortStage.setCount(objects.size());
+    sortStage.end();
 
     for (const WorkspaceObject& workspaceObject : objects){
       model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
@@ -625,22 +789,122 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     }
   }
 
+  objectsStage.setCount(m_idfObjects.size() - numIdfObjectsBeforeObjects);
+  objectsStage.end();
+
   if (fullModelTranslation){
     // add output requests
+    ProfilerStage outputRequestsStage(activeProfiler(), "Create Output Requests");
+    size_t numIdfObjects = m_idfObjects.size();
     this->createStandardOutputRequests();
+    outputRequestsStage.setCount(m_idfObjects.size() - numIdfObjects);
   }
 
-  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
-  OptionalWorkspaceObject vo = workspace.versionObject();
-  OS_ASSERT(vo);
-  workspace.removeObject(vo->handle());
+  // staged objects that were never reached, e.g. unused curves
+  m_stagedTranslations.clear();
+}
 
-  workspace.setFastNaming(true);
-  workspace.addObjects(m_idfObjects);
-  workspace.setFastNaming(false);
-  OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
+bool ForwardTranslator::writeIdfObjects(std::ostream& os) const
+{
+  // names the objects are written with, where they differ from the names of m_idfObjects
+  std::unordered_map<size_t, std::string> newNames;
+  auto finalName = [&](size_t i) {
+    auto it = newNames.find(i);
+    return (it == newNames.end()) ? m_idfObjects[i].nameString() : it->second;
+  };
+
+  // named objects by lower case name, to resolve references as the Workspace would
+  std::unordered_map<std::string, std::vector<size_t> > namedObjects;
+  for (size_t i = 0; i < m_idfObjects.size(); ++i){
+    const IdfObject& idfObject = m_idfObjects[i];
+    if (!idfObject.iddObject().hasNameField()){
+      continue;
+    }
+    // the Workspace names objects that have neither a name nor a default one, with fast naming
+    if (idfObject.name() && idfObject.name(true).get().empty()){
+      newNames[i] = toString(createUUID());
+      continue;
+    }
 
-  return workspace;
+    // the Workspace renames an object whose name is taken by an object sharing a reference list with it, see
+    // resolvePotentialNameConflicts, here the first object keeps the name
+    std::vector<size_t>& sameName = namedObjects[boost::algorithm::to_lower_copy(idfObject.nameString())];
+    for (size_t j : sameName){
+      if (!intersectReferenceLists(idfObject.iddObject().references(), m_idfObjects[j].iddObject().references()).empty()){
+        newNames[i] = toString(createUUID());
+        LOG(Info, "Renamed " << idfObject.briefDescription() << " to " << newNames[i]
+            << " to avoid a name conflict upon WorkspaceObject addition.");
+        break;
+      }
+    }
+    sameName.push_back(i);
+  }
+
+  // header, as printed by IdfFile, then the version object first
+  os << std::endl;
+  std::vector<size_t> order;
+  order.reserve(m_idfObjects.size());
+  for (size_t i = 0; i < m_idfObjects.size(); ++i){
+    if (m_idfObjects[i].iddObject().isVersionObject()){
+      order.push_back(i);
+    }
+  }
+  for (size_t i = 0; i < m_idfObjects.size(); ++i){
+    if (!m_idfObjects[i].iddObject().isVersionObject()){
+      order.push_back(i);
+    }
+  }
+
+  for (size_t i : order){
+    const IdfObject& idfObject = m_idfObjects[i];
+
+    // fields that are written differently, m_idfObjects is left as translated
+    std::vector<std::pair<unsigned, std::string> > newFields;
+    auto newName = newNames.find(i);
+    if (newName != newNames.end()){
+      newFields.push_back(std::make_pair(idfObject.iddObject().nameFieldIndex().get(), newName->second));
+    }
+
+    for (unsigned index : idfObject.objectListFields()){
+      std::string targetName = idfObject.getString(index).get();
+      if (targetName.empty()){
+        continue;
+      }
+
+      std::string resolvedName;
+      auto it = namedObjects.find(boost::algorithm::to_lower_copy(targetName));
+      if (it != namedObjects.end()){
+        std::set<std::string> intermediate = idfObject.iddObject().objectLists(index);
+        std::vector<std::string> objectLists(intermediate.begin(), intermediate.end());
+        for (size_t j : it->second){
+          if (!intersectReferenceLists(m_idfObjects[j].iddObject().references(), objectLists).empty()){
+            resolvedName = finalName(j);
+            break;
+          }
+        }
+      }
+
+      if (resolvedName.empty()){
+        LOG(Warn, idfObject.briefDescription() << ", points to an object named " << targetName
+            << " from field " << index << ", but that object cannot be located.");
+      }
+      if (resolvedName != targetName){
+        newFields.push_back(std::make_pair(index, resolvedName));
+      }
+    }
+
+    if (newFields.empty()){
+      idfObject.print(os);
+    }else{
+      IdfObject written = idfObject.clone();
+      for (const auto& newField : newFields){
+        written.setString(newField.first, newField.second);
+      }
+      written.print(os);
+    }
+  }
+
+  return os.good();
 }
 
 // struct for sorting children in forward translator
@@ -681,6 +945,21 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
 {
   boost::optional<IdfObject> retVal;
 
+  // staging a translation on a worker thread, see stageModelObjects
+  if (m_stagedTranslation)
+  {
+    if (m_stageableTypes->count(modelObject.iddObject().type()) == 0) {
+      // the staged translation is dropped and the object is left to the serial translation
+      m_stagedTranslation->unstageable = true;
+      return retVal;
+    }
+    if (m_stagingDepth == 1) {
+      m_stagedTranslation->dependencies.push_back(std::make_pair(m_idfObjects.size(), modelObject));
+      // messages logged by a dependency are logged again when its own translation is merged
+      collectStagedLogMessages();
+    }
+  }
+
   // if already translated then exit
   ModelObjectMap::const_iterator objInMap = m_map.find( modelObject.handle() );
   if( objInMap != m_map.end() )
@@ -688,8 +967,37 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
     return boost::optional<IdfObject>(objInMap->second);
   }
 
+  if (m_recordTranslatedRanges && !m_stagedTranslation) {
+    beginTranslatedRange(modelObject);
+  }
+
+  // one stage per type, only look up the name of the type when profiling
+  Profiler* profiler = activeProfiler();
+  ProfilerStage stage(profiler, profiler ? modelObject.iddObject().name() : std::string());
+
+  size_t numIdfObjects = m_idfObjects.size();
+
+  // if translated ahead of time then merge
+  auto stagedInMap = m_stagedTranslations.find( modelObject.handle() );
+  if( stagedInMap != m_stagedTranslations.end() )
+  {
+    StagedTranslation stagedTranslation = std::move(stagedInMap->second);
+    m_stagedTranslations.erase(stagedInMap);
+    retVal = mergeStagedTranslation(stagedTranslation);
+    stage.setCount(m_idfObjects.size() - numIdfObjects);
+    mapModelObject(modelObject, retVal);
+    if (m_recordTranslatedRanges && !m_stagedTranslation) {
+      endTranslatedRange();
+    }
+    return retVal;
+  }
+
   LOG(Trace,"Translating " << modelObject.briefDescription() << ".");
 
+  if (m_stagedTranslation) {
+    ++m_stagingDepth;
+  }
+
   switch(modelObject.iddObject().type().value())
   {
   case openstudio::IddObjectType::OS_AdditionalProperties :
@@ -3446,19 +3754,70 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
   default:
     {
       LOG(Warn, "Unknown IddObjectType: '" << modelObject.iddObject().name() << "'");
+      if (m_recordTranslatedRanges && !m_stagedTranslation) {
+        endTranslatedRange();
+      }
       return retVal;
     }
   }
 
-  if(retVal)
+  if (m_stagedTranslation) {
+    --m_stagingDepth;
+    // only the result of a dependency matters here, its objects are added when the staged translation is merged
+    if (m_stagingDepth > 0) {
+      m_idfObjects.erase(m_idfObjects.begin() + numIdfObjects, m_idfObjects.end());
+    }
+    if (m_stagingDepth == 1) {
+      m_logSink.resetStringStream();
+    }
+  }
+
+  stage.setCount(m_idfObjects.size() - numIdfObjects);
+
+  mapModelObject(modelObject, retVal);
+
+  if (m_recordTranslatedRanges && !m_stagedTranslation) {
+    endTranslatedRange();
+  }
+
+  return retVal;
+}
+
+void ForwardTranslator::beginTranslatedRange(const ModelObject & modelObject)
+{
+  auto inserted = m_translatedRanges.insert(std::make_pair(modelObject.handle(), TranslatedRange()));
+  if (!inserted.second) {
+    // translated again, objects without a result are not mapped, so its objects are not all in one range
+    inserted.first->second.interleaved = true;
+  }
+  inserted.first->second.begin = m_idfObjects.size();
+  m_translationStack.push_back(modelObject.handle());
+}
+
+void ForwardTranslator::endTranslatedRange()
+{
+  OS_ASSERT(!m_translationStack.empty());
+  TranslatedRange& range = m_translatedRanges[m_translationStack.back()];
+  range.end = m_idfObjects.size();
+  m_translationStack.pop_back();
+}
+
+void ForwardTranslator::mapModelObject(ModelObject & modelObject, const boost::optional<IdfObject> & idfObject)
+{
+  if(idfObject)
   {
-    m_map.insert(make_pair(modelObject.handle(),retVal.get()));
+    m_map.insert(make_pair(modelObject.handle(),idfObject.get()));
 
     if (m_progressBar){
       m_progressBar->setValue((int)m_map.size());
     }
   }
 
+  // children are translated when a staged translation is merged
+  if (m_stagedTranslation) {
+    return;
+  }
+
   // is this redundant?
   // ETH@20120112 Yes.
   OptionalParentObject opo = modelObject.optionalCast<ParentObject>();
@@ -3477,8 +3836,6 @@ boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelOb
       }
     }
   }
-
-  return retVal;
 }
 
 std::string ForwardTranslator::stripOS2(const string& s)
@@ -4145,12 +4502,265 @@ void ForwardTranslator::translateAirflowNetwork(const model::Model & model)
   }
 }
 
+void ForwardTranslator::stageModelObjects(const model::Model & model)
+{
+  std::vector<ModelObject> modelObjects;
+  for (const IddObjectType& iddObjectType : parallelTranslationTypes()){
+    for (const WorkspaceObject& workspaceObject : model.getObjectsByType(iddObjectType)){
+      modelObjects.push_back(workspaceObject.cast<ModelObject>());
+    }
+  }
+
+  if (modelObjects.empty()){
+    return;
+  }
+
+  // IddObjects cache their name field on first use, fill the caches before reading from several threads
+  for (const IddObject& iddObject : IddFactory::instance().objects()){
+    iddObject.hasNameField();
+  }
+
+  std::vector<boost::optional<StagedTranslation> > stagedTranslations = stageTranslations(modelObjects, m_numThreads, parallelTranslationTypes());
+
+  for (size_t i = 0; i < modelObjects.size(); ++i){
+    if (stagedTranslations[i]){
+      m_stagedTranslations.insert(std::make_pair(modelObjects[i].handle(), std::move(*stagedTranslations[i])));
+    }
+  }
+}
+
+std::vector<boost::optional<ForwardTranslator::StagedTranslation> > ForwardTranslator::stageTranslations(const std::vector<ModelObject> & modelObjects, unsigned numThreads,
+                                                                                                        const std::set<IddObjectType> & stageableTypes)
+{
+  std::vector<boost::optional<StagedTranslation> > stagedTranslations(modelObjects.size());
+  std::atomic<size_t> next(0);
+
+  // the first error on any thread stops the staging and is thrown again here, as the serial translation would have
+  std::exception_ptr error;
+  std::mutex errorMutex;
+
+  auto stage = [&]() {
+    // created on this thread so that its log sink only collects messages from this thread
+    ForwardTranslator translator;
+    translator.m_progressBar = nullptr;
+    translator.m_stageableTypes = &stageableTypes;
+
+    try {
+      for (size_t i = next++; i < modelObjects.size(); i = next++){
+        StagedTranslation stagedTranslation;
+        translator.m_idfObjects.clear();
+        translator.m_map.clear();
+        translator.m_logSink.resetStringStream();
+        translator.m_stagedTranslation = &stagedTranslation;
+        translator.m_stagingDepth = 0;
+        ModelObject modelObject = modelObjects[i];
+        stagedTranslation.result = translator.translateAndMapModelObject(modelObject);
+        if (!stagedTranslation.unstageable){
+          translator.collectStagedLogMessages();
+          stagedTranslation.idfObjects = std::move(translator.m_idfObjects);
+          stagedTranslations[i] = std::move(stagedTranslation);
+        }
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (!error){
+        error = std::current_exception();
+      }
+      next = modelObjects.size();
+    }
+
+    translator.m_stagedTranslation = nullptr;
+  };
+
+  // not staged on this thread, the log sink of the calling translator would collect the messages of the workers
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < numThreads; ++i){
+    threads.push_back(std::thread(stage));
+  }
+  for (std::thread& thread : threads){
+    thread.join();
+  }
+
+  if (error){
+    std::rethrow_exception(error);
+  }
+
+  return stagedTranslations;
+}
+
+void ForwardTranslator::collectStagedLogMessages()
+{
+  std::vector<LogMessage> logMessages = m_logSink.logMessages();
+  m_stagedTranslation->logMessages.insert(m_stagedTranslation->logMessages.end(), logMessages.begin(), logMessages.end());
+  m_logSink.resetStringStream();
+}
+
+boost::optional<IdfObject> ForwardTranslator::mergeStagedTranslation(StagedTranslation & stagedTranslation)
+{
+  // logged again on this thread so that they are in m_logSink, as if the object had been translated here
+  for (const LogMessage& logMessage : stagedTranslation.logMessages){
+    LOG_FREE(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
+  }
+
+  size_t i = 0;
+  for (auto& dependency : stagedTranslation.dependencies){
+    for (; i < dependency.first; ++i){
+      m_idfObjects.push_back(stagedTranslation.idfObjects[i]);
+    }
+    translateAndMapModelObject(dependency.second);
+  }
+  for (; i < stagedTranslation.idfObjects.size(); ++i){
+    m_idfObjects.push_back(stagedTranslation.idfObjects[i]);
+  }
+
+  return stagedTranslation.result;
+}
+
+boost::optional<std::vector<std::pair<IdfObject, IdfObject> > > ForwardTranslator::retranslateModelObject(ModelObject & modelObject)
+{
+  auto previous = m_translatedRanges.find(modelObject.handle());
+  if ((previous == m_translatedRanges.end()) || previous->second.interleaved || (retranslationTypes().count(modelObject.iddObject().type()) == 0)){
+    return boost::none;
+  }
+  const TranslatedRange range = previous->second;
+
+  // staged on a separate translator so that the translations of its dependencies are not repeated
+  std::vector<boost::optional<StagedTranslation> > stagedTranslations = stageTranslations(std::vector<ModelObject>{modelObject}, 1u, retranslationTypes());
+  if (!stagedTranslations[0]){
+    return boost::none;
+  }
+  const StagedTranslation& stagedTranslation = *stagedTranslations[0];
+
+  // its own objects must be of the same types and names, so that references to them and the order of all objects
+  // are kept, and each dependency must have been translated before it, or in turn within its range
+  std::vector<std::pair<IdfObject, IdfObject> > result;
+  std::vector<size_t> indices;
+  boost::optional<size_t> resultIndex;
+  std::set<Handle> dependencies;
+  size_t index = range.begin;
+  auto addOwnObjects = [&](size_t end) {
+    for (size_t i = result.size(); i < end; ++i){
+      const IdfObject& idfObject = stagedTranslation.idfObjects[i];
+      if ((index >= range.end) || (idfObject.iddObject().type() != m_idfObjects[index].iddObject().type()) ||
+          !istringEqual(idfObject.nameString(), m_idfObjects[index].nameString())){
+        return false;
+      }
+      if (stagedTranslation.result && (idfObject == *stagedTranslation.result)){
+        resultIndex = index;
+      }
+      result.push_back(std::make_pair(m_idfObjects[index], idfObject));
+      indices.push_back(index++);
+    }
+    return true;
+  };
+  for (const auto& dependency : stagedTranslation.dependencies){
+    if (!addOwnObjects(dependency.first)){
+      return boost::none;
+    }
+    auto translated = m_translatedRanges.find(dependency.second.handle());
+    if ((translated == m_translatedRanges.end()) || !dependencies.insert(dependency.second.handle()).second){
+      // translated later, or again, and so mapped already
+      if (translated == m_translatedRanges.end()){
+        return boost::none;
+      }
+      continue;
+    }
+    if (translated->second.end <= range.begin){
+      continue;
+    }
+    if (translated->second.begin != index){
+      return boost::none;
+    }
+    index = translated->second.end;
+  }
+  if (!addOwnObjects(stagedTranslation.idfObjects.size()) || (index != range.end)){
+    return boost::none;
+  }
+
+  // the mapped object must be the same one of its objects as before
+  auto mapped = m_map.find(modelObject.handle());
+  if (resultIndex){
+    if ((mapped == m_map.end()) || !(mapped->second == m_idfObjects[*resultIndex])){
+      return boost::none;
+    }
+  } else if (stagedTranslation.result || (mapped != m_map.end())){
+    return boost::none;
+  }
+
+  for (size_t i = 0; i < result.size(); ++i){
+    if (resultIndex && (indices[i] == *resultIndex)){
+      m_map.erase(mapped);
+      m_map.insert(std::make_pair(modelObject.handle(), result[i].second));
+    }
+    m_idfObjects[indices[i]] = result[i].second;
+  }
+
+  for (const LogMessage& logMessage : stagedTranslation.logMessages){
+    LOG_FREE(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
+  }
+
+  return result;
+}
+
+const std::set<IddObjectType>& ForwardTranslator::parallelTranslationTypes()
+{
+  static const std::set<IddObjectType> result{
+    IddObjectType::OS_Construction,
+    IddObjectType::OS_Curve_Bicubic,
+    IddObjectType::OS_Curve_Biquadratic,
+    IddObjectType::OS_Curve_Cubic,
+    IddObjectType::OS_Curve_DoubleExponentialDecay,
+    IddObjectType::OS_Curve_Exponent,
+    IddObjectType::OS_Curve_ExponentialDecay,
+    IddObjectType::OS_Curve_ExponentialSkewNormal,
+    IddObjectType::OS_Curve_FanPressureRise,
+    IddObjectType::OS_Curve_Functional_PressureDrop,
+    IddObjectType::OS_Curve_Linear,
+    IddObjectType::OS_Curve_Quadratic,
+    IddObjectType::OS_Curve_QuadraticLinear,
+    IddObjectType::OS_Curve_Quartic,
+    IddObjectType::OS_Curve_RectangularHyperbola1,
+    IddObjectType::OS_Curve_RectangularHyperbola2,
+    IddObjectType::OS_Curve_Sigmoid,
+    IddObjectType::OS_Curve_Triquadratic,
+    IddObjectType::OS_Material,
+    IddObjectType::OS_Material_InfraredTransparent,
+    IddObjectType::OS_Material_NoMass,
+    IddObjectType::OS_Schedule_Constant,
+    IddObjectType::OS_WindowMaterial_Blind,
+    IddObjectType::OS_WindowMaterial_GasMixture,
+    IddObjectType::OS_WindowMaterial_SimpleGlazingSystem,
+    IddObjectType::OS_WindowProperty_FrameAndDivider
+  };
+  return result;
+}
+
+const std::set<IddObjectType>& ForwardTranslator::retranslationTypes()
+{
+  static const std::set<IddObjectType> result = []() {
+    std::set<IddObjectType> types = parallelTranslationTypes();
+    types.insert(IddObjectType::OS_Schedule_Compact);
+    types.insert(IddObjectType::OS_Schedule_Day);
+    types.insert(IddObjectType::OS_Schedule_FixedInterval);
+    types.insert(IddObjectType::OS_Schedule_Rule);
+    types.insert(IddObjectType::OS_Schedule_Ruleset);
+    types.insert(IddObjectType::OS_Schedule_VariableInterval);
+    types.insert(IddObjectType::OS_Schedule_Week);
+    types.insert(IddObjectType::OS_Schedule_Year);
+    types.insert(IddObjectType::OS_ScheduleTypeLimits);
+    return types;
+  }();
+  return result;
+}
+
 void ForwardTranslator::reset()
 {
   m_idfObjects.clear();
 
   m_map.clear();
 
+  m_stagedTranslations.clear();
+
   m_anyNumberScheduleTypeLimits.reset();
 
   m_alwaysOnSchedule.reset();
@@ -4163,6 +4773,10 @@ void ForwardTranslator::reset()
 
   m_constructionHandleToReversedConstructions.clear();
 
+  m_translatedRanges.clear();
+
+  m_translationStack.clear();
+
   m_logSink.setThreadId(std::this_thread::get_id());
 
   m_logSink.resetStringStream();
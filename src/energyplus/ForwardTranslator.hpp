@@ -36,9 +36,15 @@
 #include "../model/HVACComponent.hpp"
 #include "../utilities/idf/Workspace.hpp"
 #include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Profiler.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 #include "../utilities/time/Time.hpp"
 
+#include <map>
+#include <ostream>
+#include <set>
+#include <vector>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -461,6 +467,8 @@ class ZoneVentilationWindandStackOpenArea;
 
 namespace energyplus {
 
+class IncrementalForwardTranslator;
+
 namespace detail
 {
   struct ForwardTranslatorInitializer;
@@ -477,6 +485,33 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModel( const model::Model & model, ProgressBar* progressBar=nullptr );
 
+  /** Translates the given Model to a Workspace without copying it first, which saves the memory and time of
+   *  the copy made by translateModel.
+   *
+   *  \warning The model is consumed: it must not be used, saved or translated again afterwards. Translation
+   *  changes the model it works on: spaces in each thermal zone are combined, orphan objects and air walls are
+   *  removed, loads and shading controls are duplicated per space or zone, and reversed and default constructions
+   *  are added. The changes are not undone, so the model left behind no longer matches the one passed in, and
+   *  handles to removed objects are null. Use translateModel whenever the model is still needed.
+   */
+  Workspace translateModelInPlace( model::Model & model, ProgressBar* progressBar=nullptr );
+
+  /** Translates the given Model and writes the translated objects to os in IDF format, without building a
+   *  Workspace. The handle maps, pointers and validity checks of the Workspace take neither memory nor time, but
+   *  the translated objects are still held until they are all written, since references can only be resolved
+   *  once every name is known. The text is that of the Workspace returned by translateModel: an object whose
+   *  name is taken by an earlier object sharing a reference list with it is renamed, and references are
+   *  written with the names of the objects they resolve to. Returns false if writing to os fails.
+   */
+  bool translateModelToStream( const model::Model & model, std::ostream & os, ProgressBar* progressBar=nullptr );
+
+  /** Same as translateModelToStream, but translates the given Model without copying it first, see
+   *  translateModelInPlace.
+   *
+   *  \warning The model is consumed: it must not be used, saved or translated again afterwards.
+   */
+  bool translateModelToStreamInPlace( model::Model & model, std::ostream & os, ProgressBar* progressBar=nullptr );
+
   /** Translates a ModelObject into a Workspace
    */
   Workspace translateModelObject( model::ModelObject & modelObject );
@@ -517,15 +552,44 @@ class ENERGYPLUS_API ForwardTranslator {
    *  Use this at your own risks */
   void setExcludeVariableDictionary(bool excludeVariableDictionary);
 
+  /** Returns the number of threads used to translate objects ahead of the serial translation, 1 by default. */
+  unsigned numThreads() const;
+
+  /** Sets the number of threads used to translate objects ahead of the serial translation, 0 sets it to the number
+   *  of hardware threads. If more than one, curves, materials, constructions and other objects that do not depend
+   *  on the rest of the model are translated concurrently into staging buffers, which are then merged into the
+   *  Workspace in the order the serial translation would have added them. The resulting Workspace is the same
+   *  as with one thread. */
+  void setNumThreads(unsigned numThreads);
+
+  /** If profileTranslation, record the wall time spent in each stage of the following translations and the number
+   *  of objects each stage added, see translationProfile. Stages are steps such as the preprocessing of the model
+   *  and the translation of constructions and schedules, and the translation of each model object, recorded under
+   *  the name of its IddObjectType. With more than one thread, the objects translated ahead of time are recorded under
+   *  their types as they are merged, and the time taken on the worker threads and the number of objects they added
+   *  are recorded as "Stage Objects". Off by default. */
+  void setProfileTranslation(bool profileTranslation);
+
+  /** Returns the profile of the last translation, empty unless enabled by setProfileTranslation. */
+  Profiler translationProfile() const;
+
  private:
 
+  friend class IncrementalForwardTranslator;
+
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
 
-  /** Translates the given Model to a workspace.  If fullModelTranslation is true
-   *  various "front matter" objects (such as global geometry rules and others) are added to the workspace so that it is fully
+  // returns m_profiler if profiling is enabled, null otherwise
+  Profiler* activeProfiler();
+
+  /** Translates the given Model to a Workspace holding m_idfObjects, see translateModelToIdfObjects. */
+  Workspace translateModelPrivate( model::Model& model, bool fullModelTranslation );
+
+  /** Translates the given Model to m_idfObjects.  If fullModelTranslation is true
+   *  various "front matter" objects (such as global geometry rules and others) are added so that the translation is fully
    *  prepared for simulation.
    *
-   *  The method translateModelPrivate() carries out its work by explicitly translating the highest level objects in
+   *  The method translateModelToIdfObjects() carries out its work by explicitly translating the highest level objects in
    *  the model by calling translateAndMapModelObject().  The translateAndMapModelObject method in turn calls a type
    *  specific function to translate the given object.  Each type specific function is responsible for translating
    *  not only the direct model object passed into it, but also related model objects under its purview.  Related objects
@@ -536,7 +600,12 @@ class ENERGYPLUS_API ForwardTranslator {
    *  concern of translating a model object twice, provided that model objects are always translated using the
    *  translateAndMapModelObject() interface as opposed to the type specific translators.
    */
-  Workspace translateModelPrivate( model::Model& model, bool fullModelTranslation );
+  void translateModelToIdfObjects( model::Model& model, bool fullModelTranslation );
+
+  // writes m_idfObjects to os as Workspace::toIdfFile would after adding them to a Workspace, filling in empty
+  // names, renaming conflicting names and writing the names of objects that references resolve to, returns
+  // false if os fails
+  bool writeIdfObjects(std::ostream& os) const;
 
   boost::optional<IdfObject> translateAndMapModelObject( model::ModelObject & modelObject );
 
@@ -1374,6 +1443,80 @@ class ENERGYPLUS_API ForwardTranslator {
   // reset the state of the translator between translations
   void reset();
 
+  // translation of a model object made ahead of time on a worker thread, see stageModelObjects
+  struct StagedTranslation {
+    boost::optional<IdfObject> result;
+    // objects added by the type specific translator, in order
+    std::vector<IdfObject> idfObjects;
+    // model objects the translator translated in turn, with the number of idfObjects added before each
+    std::vector<std::pair<size_t, model::ModelObject> > dependencies;
+    // messages logged by the type specific translator, logged again when the translation is merged
+    std::vector<LogMessage> logMessages;
+    // set when the translation needs an object of a type that cannot be staged, the translation is then dropped
+    bool unstageable = false;
+  };
+
+  // objects of m_idfObjects added while translating a model object, recorded if m_recordTranslatedRanges is set, the
+  // ranges of model objects translated in turn are nested within
+  struct TranslatedRange {
+    size_t begin = 0;
+    size_t end = 0;
+    // set when the model object is translated more than once, its objects are then not all in one range
+    bool interleaved = false;
+  };
+
+  // translates all objects of parallelTranslationTypes on numThreads threads and keeps the results in
+  // m_stagedTranslations, for translateAndMapModelObject to merge as it comes to each object
+  void stageModelObjects(const model::Model & model);
+
+  // translates the model objects on numThreads new threads, each on its own translator, the result is empty for objects
+  // that needed an object not of stageableTypes, the first exception thrown by a translation is thrown again once all
+  // threads are done
+  static std::vector<boost::optional<StagedTranslation> > stageTranslations(const std::vector<model::ModelObject> & modelObjects, unsigned numThreads,
+                                                                             const std::set<IddObjectType> & stageableTypes);
+
+  // moves the messages logged so far on a staging translator into the current staged translation
+  void collectStagedLogMessages();
+
+  // adds the objects of a staged translation to m_idfObjects as the type specific translator would have, and
+  // translates its dependencies in between, returns the result of the translation
+  boost::optional<IdfObject> mergeStagedTranslation(StagedTranslation & stagedTranslation);
+
+  // translates a model object of retranslationTypes again after a translation that recorded m_translatedRanges. If it
+  // translates to objects of the same types and names as then, and only needs objects translated before it or in turn
+  // within its range, these replace its own objects in m_idfObjects and m_map, and the previous objects are returned
+  // with their replacements
+  boost::optional<std::vector<std::pair<IdfObject, IdfObject> > > retranslateModelObject(model::ModelObject & modelObject);
+
+  // starts and ends the range of the model object being translated when m_recordTranslatedRanges is set
+  void beginTranslatedRange(const model::ModelObject & modelObject);
+  void endTranslatedRange();
+
+  // maps the model object to its translation and translates its children
+  void mapModelObject(model::ModelObject & modelObject, const boost::optional<IdfObject> & idfObject);
+
+  // types whose translators only read the model object and objects of these types, do not log and leave the
+  // state of the translator alone, so that they can be translated on worker threads
+  static const std::set<IddObjectType>& parallelTranslationTypes();
+
+  // types whose translators only read the model object, its children and objects of these types, and whose objects
+  // are only referred to by name, so that they can be translated again on their own
+  static const std::set<IddObjectType>& retranslationTypes();
+
+  std::map<Handle, StagedTranslation> m_stagedTranslations;
+
+  // set on worker translators, the translation being staged, the depth of translateAndMapModelObject calls and the
+  // types its dependencies may be of
+  StagedTranslation* m_stagedTranslation;
+  unsigned m_stagingDepth;
+  const std::set<IddObjectType>* m_stageableTypes;
+
+  // set by IncrementalForwardTranslator, which translates objects again in place of their recorded ranges
+  bool m_recordTranslatedRanges;
+  std::map<Handle, TranslatedRange> m_translatedRanges;
+  // model objects whose translation is under way, innermost last
+  std::vector<Handle> m_translationStack;
+
   // helper method used by ForwardTranslatePlantLoop
   IdfObject populateBranch( IdfObject & branchIdfObject, std::vector<model::ModelObject> & modelObjects, model::Loop & loop, bool isSupplyBranch);
 
@@ -1489,6 +1632,9 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_excludeSQliteOutputReport; // exclude Output:Sqlite
   bool m_excludeHTMLOutputReport;   // exclude Output:Table:SummaryReports
   bool m_excludeVariableDictionary; // exclude Output:VariableDictionary
+  unsigned m_numThreads;
+  bool m_profileTranslation;
+  Profiler m_profiler;
 };
 
 
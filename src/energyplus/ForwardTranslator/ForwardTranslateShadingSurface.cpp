@@ -104,7 +104,9 @@ boost::optional<IdfObject> ForwardTranslator::translateShadingSurface( model::Sh
             for (const Point3d& point : points){
               for (const Point3d& surfaceVertex : surfaceVertices){
                 double distance = getDistance(point, surfaceVertex);
-                if (distance < minDistance){
+                // ties go to the first name so that the base surface does not depend on the order of surfaces
+                if ((distance < minDistance) ||
+                    ((distance == minDistance) && (surface.nameString() < baseSurface->nameString()))){
                   baseSurface = surface;
                   minDistance = distance;
                 }
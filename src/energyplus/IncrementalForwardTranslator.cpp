@@ -0,0 +1,355 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "IncrementalForwardTranslator.hpp"
+
+#include "../model/Model_Impl.hpp"
+#include "../model/ModelObject.hpp"
+#include "../model/ModelObject_Impl.hpp"
+#include "../model/ConstructionBase.hpp"
+#include "../model/ConstructionBase_Impl.hpp"
+#include "../model/LayeredConstruction.hpp"
+#include "../model/LayeredConstruction_Impl.hpp"
+#include "../model/Material.hpp"
+#include "../model/Material_Impl.hpp"
+#include "../model/ParentObject.hpp"
+#include "../model/ParentObject_Impl.hpp"
+#include "../model/Surface.hpp"
+#include "../model/Surface_Impl.hpp"
+#include "../model/SubSurface.hpp"
+#include "../model/SubSurface_Impl.hpp"
+#include "../model/ShadingSurface.hpp"
+#include "../model/ShadingSurface_Impl.hpp"
+
+#include "../utilities/idf/IdfExtensibleGroup.hpp"
+#include "../utilities/idf/IdfObjectWatcher.hpp"
+#include "../utilities/idf/WorkspaceObject.hpp"
+#include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
+
+#include <utility>
+
+namespace openstudio {
+namespace energyplus {
+
+// marks its object as changed when it first changes after a translation
+class IncrementalForwardTranslator::ObjectWatcher : public IdfObjectWatcher {
+ public:
+
+  ObjectWatcher(const model::ModelObject& modelObject, std::vector<ObjectWatcher*>& changedObjects)
+    : IdfObjectWatcher(modelObject), m_modelObject(modelObject), m_changedObjects(changedObjects)
+  {}
+
+  virtual ~ObjectWatcher() {}
+
+  model::ModelObject modelObject() const
+  {
+    return m_modelObject;
+  }
+
+  virtual void onBecomeDirty() override
+  {
+    m_changedObjects.push_back(this);
+  }
+
+  // setters that skip the change signals, such as Space::setXOrigin, leave their changes pending on the object
+  void emitPendingChanges() const
+  {
+    m_modelObject.getImpl<model::detail::ModelObject_Impl>()->emitChangeSignals();
+  }
+
+ private:
+
+  model::ModelObject m_modelObject;
+  std::vector<ObjectWatcher*>& m_changedObjects;
+};
+
+IncrementalForwardTranslator::IncrementalForwardTranslator(const model::Model& model)
+  : m_model(model), m_fullTranslationRequired(true)
+{
+  m_forwardTranslator.m_recordTranslatedRanges = true;
+
+  std::shared_ptr<model::detail::Model_Impl> modelImpl = m_model.getImpl<model::detail::Model_Impl>();
+  modelImpl.get()->openstudio::model::detail::Model_Impl::addWorkspaceObject.connect<IncrementalForwardTranslator, &IncrementalForwardTranslator::objectAdded>(this);
+  modelImpl.get()->openstudio::model::detail::Model_Impl::removeWorkspaceObject.connect<IncrementalForwardTranslator, &IncrementalForwardTranslator::objectRemoved>(this);
+}
+
+IncrementalForwardTranslator::~IncrementalForwardTranslator()
+{
+}
+
+model::Model IncrementalForwardTranslator::model() const
+{
+  return m_model;
+}
+
+ForwardTranslator& IncrementalForwardTranslator::forwardTranslator()
+{
+  return m_forwardTranslator;
+}
+
+Workspace IncrementalForwardTranslator::translateModel(ProgressBar* progressBar)
+{
+  if (!fullTranslationRequired()){
+    if (translateChangedObjects()){
+      return *m_workspace;
+    }
+    LOG(Info, "Unable to translate the changed objects on their own, translating the whole Model.");
+  }
+
+  // translated in place of a copy of the model, as ForwardTranslator::translateModel does, which is kept to translate
+  // the changed objects again
+  m_translatedModel = m_model.clone(true).cast<model::Model>();
+  m_workspace = m_forwardTranslator.translateModelInPlace(*m_translatedModel, progressBar);
+  watchModel();
+  m_fullTranslationRequired = false;
+
+  return *m_workspace;
+}
+
+bool IncrementalForwardTranslator::fullTranslationRequired()
+{
+  collectChanges();
+  return m_fullTranslationRequired || !m_workspace || !canTranslateChangedObjects();
+}
+
+void IncrementalForwardTranslator::requireFullTranslation()
+{
+  m_fullTranslationRequired = true;
+}
+
+void IncrementalForwardTranslator::watchModel()
+{
+  m_changedObjects.clear();
+  m_watchers.clear();
+  for (const model::ModelObject& modelObject : m_model.modelObjects()){
+    // changes left pending before the translation are part of it
+    modelObject.getImpl<model::detail::ModelObject_Impl>()->emitChangeSignals();
+    m_watchers.push_back(std::unique_ptr<ObjectWatcher>(new ObjectWatcher(modelObject, m_changedObjects)));
+  }
+
+  m_sharedObjects.clear();
+  auto addShared = [this](const boost::optional<model::ConstructionBase>& construction) {
+    if (construction){
+      m_sharedObjects.insert(construction->handle());
+    }
+  };
+
+  // reversed constructions are made for matched surfaces depending on their layers
+  for (const model::Surface& surface : m_model.getConcreteModelObjects<model::Surface>()){
+    if (surface.adjacentSurface()){
+      addShared(surface.construction());
+    }
+  }
+
+  // doors and glass doors are checked against the layers of their constructions
+  for (const model::SubSurface& subSurface : m_model.getConcreteModelObjects<model::SubSurface>()){
+    if (subSurface.adjacentSubSurface() || istringEqual(subSurface.subSurfaceType(), "Door") || istringEqual(subSurface.subSurfaceType(), "GlassDoor")){
+      addShared(subSurface.construction());
+    }
+  }
+
+  // reflectances of shading surfaces are taken from the outside layer of their constructions
+  for (const model::ShadingSurface& shadingSurface : m_model.getConcreteModelObjects<model::ShadingSurface>()){
+    boost::optional<model::ConstructionBase> construction = shadingSurface.construction();
+    addShared(construction);
+    if (construction){
+      if (boost::optional<model::LayeredConstruction> layeredConstruction = construction->optionalCast<model::LayeredConstruction>()){
+        std::vector<model::Material> layers = layeredConstruction->layers();
+        if (!layers.empty()){
+          m_sharedObjects.insert(layers.front().handle());
+        }
+      }
+    }
+  }
+}
+
+boost::optional<model::ModelObject> IncrementalForwardTranslator::translationRoot(const model::ModelObject& modelObject) const
+{
+  const std::map<Handle, ForwardTranslator::TranslatedRange>& translatedRanges = m_forwardTranslator.m_translatedRanges;
+
+  // an object without objects of its own, such as a ScheduleRule, is read by the translator of its parent
+  boost::optional<model::ModelObject> result = modelObject;
+  while (result){
+    if (ForwardTranslator::retranslationTypes().count(result->iddObject().type()) == 0){
+      return boost::none;
+    }
+    if (m_sharedObjects.find(result->handle()) != m_sharedObjects.end()){
+      return boost::none;
+    }
+    auto range = translatedRanges.find(result->handle());
+    if ((range != translatedRanges.end()) && (range->second.end > range->second.begin)){
+      return result;
+    }
+    boost::optional<model::ParentObject> parent = result->parent();
+    if (parent){
+      result = parent->cast<model::ModelObject>();
+    } else {
+      result.reset();
+    }
+  }
+  return boost::none;
+}
+
+void IncrementalForwardTranslator::collectChanges()
+{
+  for (const std::unique_ptr<ObjectWatcher>& watcher : m_watchers){
+    watcher->emitPendingChanges();
+  }
+}
+
+bool IncrementalForwardTranslator::copyToTranslatedModel(const model::ModelObject& modelObject)
+{
+  OS_ASSERT(m_translatedModel);
+
+  boost::optional<WorkspaceObject> copy = m_translatedModel->getObject(modelObject.handle());
+  if (!copy || (copy->iddObject().type() != modelObject.iddObject().type())){
+    return false;
+  }
+
+  // values added or removed, such as the times and values of a ScheduleDay, are extensible groups
+  while (copy->numExtensibleGroups() > modelObject.numExtensibleGroups()){
+    if (copy->popExtensibleGroup().empty()){
+      return false;
+    }
+  }
+  while (copy->numExtensibleGroups() < modelObject.numExtensibleGroups()){
+    if (copy->pushExtensibleGroup().empty()){
+      return false;
+    }
+  }
+  if (copy->numFields() != modelObject.numFields()){
+    return false;
+  }
+
+  // the handle is the same and the name did not change, pointers are set by handle since the copy has the same ones
+  boost::optional<unsigned> nameIndex = modelObject.iddObject().nameFieldIndex();
+  for (unsigned index = modelObject.iddObject().hasHandleField() ? 1u : 0u; index < modelObject.numFields(); ++index){
+    if (nameIndex && (index == *nameIndex)){
+      continue;
+    }
+    bool result = false;
+    if (modelObject.isObjectListField(index)){
+      boost::optional<WorkspaceObject> target = modelObject.getTarget(index);
+      result = target ? copy->setPointer(index, target->handle()) : copy->setString(index, "");
+    } else {
+      result = copy->setString(index, modelObject.getString(index).get_value_or(""));
+    }
+    if (!result){
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IncrementalForwardTranslator::canTranslateChangedObjects() const
+{
+  for (const ObjectWatcher* watcher : m_changedObjects){
+    // other objects refer to it by name
+    if (watcher->nameChanged()){
+      return false;
+    }
+    if (!translationRoot(watcher->modelObject())){
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IncrementalForwardTranslator::translateChangedObjects()
+{
+  OS_ASSERT(m_workspace);
+
+  m_forwardTranslator.m_profiler.clear();
+  ProfilerStage stage(m_forwardTranslator.activeProfiler(), "Retranslate Objects");
+  stage.setCount(m_changedObjects.size());
+
+  OS_ASSERT(m_translatedModel);
+  for (ObjectWatcher* watcher : m_changedObjects){
+    if (!copyToTranslatedModel(watcher->modelObject())){
+      return false;
+    }
+  }
+
+  // translate all objects before changing the workspace, each changed object through the object whose translation reads it
+  std::vector<std::pair<WorkspaceObject, IdfObject> > replacements;
+  std::set<Handle> roots;
+  for (ObjectWatcher* watcher : m_changedObjects){
+    boost::optional<model::ModelObject> root = translationRoot(watcher->modelObject());
+    if (!root){
+      return false;
+    }
+    if (!roots.insert(root->handle()).second){
+      continue;
+    }
+
+    boost::optional<model::ModelObject> translatedRoot = m_translatedModel->getModelObject<model::ModelObject>(root->handle());
+    if (!translatedRoot){
+      return false;
+    }
+    boost::optional<std::vector<std::pair<IdfObject, IdfObject> > > retranslation = m_forwardTranslator.retranslateModelObject(*translatedRoot);
+    if (!retranslation){
+      return false;
+    }
+    for (const auto& objects : *retranslation){
+      boost::optional<WorkspaceObject> workspaceObject = m_workspace->getObjectByTypeAndName(objects.first.iddObject().type(), objects.first.nameString());
+      if (!workspaceObject){
+        return false;
+      }
+      replacements.push_back(std::make_pair(*workspaceObject, objects.second));
+    }
+  }
+
+  // swap keeps the objects pointing to the replaced ones and their order
+  for (auto& replacement : replacements){
+    if (!m_workspace->swap(replacement.first, replacement.second)){
+      return false;
+    }
+  }
+
+  for (ObjectWatcher* watcher : m_changedObjects){
+    watcher->clearState();
+  }
+  m_changedObjects.clear();
+
+  return true;
+}
+
+void IncrementalForwardTranslator::objectAdded(const WorkspaceObject& /*object*/, const IddObjectType& /*iddObjectType*/, const UUID& /*handle*/)
+{
+  m_fullTranslationRequired = true;
+}
+
+void IncrementalForwardTranslator::objectRemoved(const WorkspaceObject& /*object*/, const IddObjectType& /*iddObjectType*/, const UUID& /*handle*/)
+{
+  m_fullTranslationRequired = true;
+}
+
+} // energyplus
+} // openstudio
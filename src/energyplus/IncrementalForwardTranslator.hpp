@@ -0,0 +1,155 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef ENERGYPLUS_INCREMENTALFORWARDTRANSLATOR_HPP
+#define ENERGYPLUS_INCREMENTALFORWARDTRANSLATOR_HPP
+
+#include "EnergyPlusAPI.hpp"
+#include "ForwardTranslator.hpp"
+
+#include "../model/Model.hpp"
+#include "../utilities/idf/Workspace.hpp"
+#include "../utilities/core/Logger.hpp"
+
+#include <nano/nano_signal_slot.hpp> // Signal-Slot replacement
+
+#include <boost/optional.hpp>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace openstudio {
+
+class ProgressBar;
+
+namespace energyplus {
+
+/** IncrementalForwardTranslator translates a Model to a Workspace for a workflow that changes the Model and
+ *  translates it again, such as an optimization loop. It keeps the Workspace of the last translation, which
+ *  IdfObject each ModelObject was translated to and which IdfObjects its translation added, and watches the Model
+ *  for changes.
+ *
+ *  When the only changes since the last translation are to the data of curves, materials, constructions and
+ *  schedules, including the rules and day schedules of a ScheduleRuleset, the objects whose translations read the
+ *  changed data are translated again and their IdfObjects replaced in the Workspace. A change to a ScheduleRule
+ *  translates its ScheduleRuleset again. Any other change, such as adding, removing or renaming an object,
+ *  changing a surface, or changing a construction or material that other objects take more than the name of,
+ *  makes the next translation translate the whole Model into a new Workspace. So does a changed object that now
+ *  translates to IdfObjects of other types or names than before. Either way the Workspace is the same as
+ *  ForwardTranslator::translateModel would return, objects and order.
+ *
+ *  The Model itself is not changed. Like ForwardTranslator::translateModel, a full translation works on a copy of
+ *  the Model, and that copy is kept: the changed objects are copied onto it and translated again from there. */
+class ENERGYPLUS_API IncrementalForwardTranslator : public Nano::Observer {
+ public:
+
+  /** Creates a translator for model, the model is translated on the first call to translateModel. */
+  explicit IncrementalForwardTranslator(const model::Model& model);
+
+  virtual ~IncrementalForwardTranslator();
+
+  IncrementalForwardTranslator(const IncrementalForwardTranslator& other) = delete;
+
+  IncrementalForwardTranslator& operator=(const IncrementalForwardTranslator& other) = delete;
+
+  /** Returns the Model being translated. */
+  model::Model model() const;
+
+  /** Returns the ForwardTranslator that translates the whole Model, to set its options or get the warnings and
+   *  errors of the last full translation. Call requireFullTranslation after changing its options. */
+  ForwardTranslator& forwardTranslator();
+
+  /** Translates the Model to a Workspace. Changes since the last call are translated into the Workspace
+   *  returned then if they can be, see fullTranslationRequired, so clone the Workspace to keep a translation
+   *  from being changed by later calls. */
+  Workspace translateModel(ProgressBar* progressBar = nullptr);
+
+  /** Returns true if the next call to translateModel will translate the whole Model. If false, it still does when a
+   *  changed object now translates to IdfObjects of other types or names. Not const: it first emits the change
+   *  signals left pending on objects of the Model, so that changes made by setters that skip them, such as
+   *  Space::setXOrigin, are seen by this and other observers of the Model. */
+  bool fullTranslationRequired();
+
+  /** Makes the next call to translateModel translate the whole Model. */
+  void requireFullTranslation();
+
+ private:
+
+  REGISTER_LOGGER("openstudio.energyplus.IncrementalForwardTranslator");
+
+  class ObjectWatcher;
+
+  // watches each object of the model for changes and finds the objects translated with more than their names
+  void watchModel();
+
+  // emits the change signals left pending on the watched objects, so that their watchers record the changes
+  void collectChanges();
+
+  // copies the fields of a changed object onto the same object of m_translatedModel, returns false if it cannot
+  bool copyToTranslatedModel(const model::ModelObject& modelObject);
+
+  // returns the object to translate again for a change to modelObject, the object itself or the closest parent with
+  // objects of its own, if all of them are of ForwardTranslator::retranslationTypes and not read by other translators
+  boost::optional<model::ModelObject> translationRoot(const model::ModelObject& modelObject) const;
+
+  // returns false if one of the changed objects cannot be translated again without translating the whole model
+  bool canTranslateChangedObjects() const;
+
+  // translates the changed objects into m_workspace, returns false if one of them could not be
+  bool translateChangedObjects();
+
+  void objectAdded(const WorkspaceObject& object, const IddObjectType& iddObjectType, const UUID& handle);
+
+  void objectRemoved(const WorkspaceObject& object, const IddObjectType& iddObjectType, const UUID& handle);
+
+  model::Model m_model;
+
+  ForwardTranslator m_forwardTranslator;
+
+  boost::optional<Workspace> m_workspace;
+
+  // the copy of m_model translated by the last full translation, with the same handles
+  boost::optional<model::Model> m_translatedModel;
+
+  std::vector<std::unique_ptr<ObjectWatcher> > m_watchers;
+
+  // watchers of objects changed since the last translation
+  std::vector<ObjectWatcher*> m_changedObjects;
+
+  // constructions and materials whose data is read by the translation of other objects
+  std::set<Handle> m_sharedObjects;
+
+  bool m_fullTranslationRequired;
+};
+
+} // energyplus
+} // openstudio
+
+#endif // ENERGYPLUS_INCREMENTALFORWARDTRANSLATOR_HPP
@@ -51,7 +51,10 @@
 #include "../../model/SiteWaterMainsTemperature_Impl.hpp"
 #include "../../model/Building.hpp"
 #include "../../model/ThermalZone.hpp"
+#include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/SpaceType.hpp"
 #include "../../model/Lights.hpp"
 #include "../../model/AirLoopHVAC.hpp"
 #include "../../model/Schedule.hpp"
@@ -64,6 +67,8 @@
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
 #include "../../model/Construction.hpp"
+#include "../../model/CurveCubic.hpp"
+#include "../../model/LifeCycleCost.hpp"
 #include "../../model/OutputVariable.hpp"
 #include "../../model/OutputVariable_Impl.hpp"
 #include "../../model/Version.hpp"
@@ -72,6 +77,7 @@
 #include "../../model/ZoneCapacitanceMultiplierResearchSpecial_Impl.hpp"
 
 #include "../../utilities/core/Optional.hpp"
+#include "../../utilities/core/Profiler.hpp"
 #include "../../utilities/core/Checksum.hpp"
 #include "../../utilities/core/UUID.hpp"
 #include "../../utilities/core/Logger.hpp"
@@ -146,6 +152,203 @@ TEST_F(EnergyPlusFixture,ForwardTranslator_ExampleModel) {
   // workspace.save(toPath("./example.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelInPlace) {
+  Model model = exampleModel();
+  Space orphanSpace(model); // not in thermal zone, removed by translation
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+  EXPECT_FALSE(orphanSpace.handle().isNull());
+
+  Workspace inPlaceWorkspace = forwardTranslator.translateModelInPlace(model);
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+  EXPECT_TRUE(orphanSpace.handle().isNull());
+
+  // same objects in the same order
+  std::stringstream ss;
+  ss << workspace.toIdfFile();
+  std::stringstream inPlaceSS;
+  inPlaceSS << inPlaceWorkspace.toIdfFile();
+  EXPECT_EQ(ss.str(), inPlaceSS.str());
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_NumThreads) {
+  Model model = exampleModel();
+
+  // more objects translated ahead of time, constructions share materials and one has a cost that is not
+  std::vector<OpaqueMaterial> materials;
+  for (unsigned i = 0; i < 10; ++i) {
+    StandardOpaqueMaterial material(model);
+    materials.push_back(material);
+  }
+  for (unsigned i = 0; i < 20; ++i) {
+    Construction construction(std::vector<OpaqueMaterial>{materials[i % 10], materials[(i + 3) % 10]});
+    if (i == 0) {
+      EXPECT_TRUE(LifeCycleCost::createLifeCycleCost("Construction Cost", construction, 10.0, "CostPerArea", "Construction"));
+    }
+  }
+  for (unsigned i = 0; i < 50; ++i) {
+    CurveCubic curve(model);
+    curve.setCoefficient2x(i);
+  }
+
+  ForwardTranslator serialTranslator;
+  EXPECT_EQ(1u, serialTranslator.numThreads());
+  Workspace serialWorkspace = serialTranslator.translateModel(model);
+  // the log sink of a translator also collects messages of later translations on this thread
+  size_t numSerialWarnings = serialTranslator.warnings().size();
+  size_t numSerialErrors = serialTranslator.errors().size();
+
+  ForwardTranslator parallelTranslator;
+  parallelTranslator.setNumThreads(4);
+  EXPECT_EQ(4u, parallelTranslator.numThreads());
+  Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+
+  std::stringstream serialIdf;
+  serialIdf << serialWorkspace.toIdfFile();
+  std::stringstream parallelIdf;
+  parallelIdf << parallelWorkspace.toIdfFile();
+  EXPECT_EQ(serialIdf.str(), parallelIdf.str());
+  EXPECT_EQ(numSerialWarnings, parallelTranslator.warnings().size());
+  EXPECT_EQ(numSerialErrors, parallelTranslator.errors().size());
+
+  // translator can be reused
+  parallelWorkspace = parallelTranslator.translateModel(model);
+  parallelIdf.str("");
+  parallelIdf << parallelWorkspace.toIdfFile();
+  EXPECT_EQ(serialIdf.str(), parallelIdf.str());
+
+  parallelTranslator.setNumThreads(0);
+  EXPECT_LE(1u, parallelTranslator.numThreads());
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelToStream) {
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream workspaceIdf;
+  workspaceIdf << workspace.toIdfFile();
+
+  std::stringstream streamIdf;
+  EXPECT_TRUE(forwardTranslator.translateModelToStream(model, streamIdf));
+  EXPECT_EQ(workspaceIdf.str(), streamIdf.str());
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+
+  // the stream reads back to the same objects
+  OptionalIdfFile idfFile = IdfFile::load(streamIdf, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  EXPECT_EQ(workspace.numObjects(), idfFile->objects().size());
+
+  // same text without copying the model, which is not used afterwards
+  std::stringstream inPlaceIdf;
+  EXPECT_TRUE(forwardTranslator.translateModelToStreamInPlace(model, inPlaceIdf));
+  EXPECT_EQ(workspaceIdf.str(), inPlaceIdf.str());
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelToStream_NameConflict) {
+  Model model = exampleModel();
+
+  // the Zone and the ZoneList share the ZoneAndZoneListNames reference list
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_FALSE(spaces.empty());
+  ASSERT_TRUE(spaces[0].thermalZone());
+  ASSERT_TRUE(spaces[0].spaceType());
+  std::string name = spaces[0].thermalZone()->name().get();
+  EXPECT_EQ(name, spaces[0].spaceType()->setName(name).get());
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream streamIdf;
+  EXPECT_TRUE(forwardTranslator.translateModelToStream(model, streamIdf));
+
+  OptionalIdfFile idfFile = IdfFile::load(streamIdf, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  EXPECT_EQ(workspace.numObjects(), idfFile->objects().size());
+
+  // one of the two is renamed, as in the Workspace
+  for (const OptionalIdfFile& idf : { OptionalIdfFile(workspace.toIdfFile()), idfFile }){
+    unsigned numZones = 0;
+    unsigned numNamed = 0;
+    for (const IdfObject& idfObject : idf->objects()){
+      if ((idfObject.iddObject().type() == IddObjectType::Zone) || (idfObject.iddObject().type() == IddObjectType::ZoneList)){
+        ++numZones;
+        if (idfObject.nameString() == name){
+          ++numNamed;
+        }
+      }
+    }
+    EXPECT_LT(1u, numZones);
+    EXPECT_EQ(1u, numNamed);
+  }
+
+  // in the stream the object translated first keeps the name, here the Zone
+  bool zoneNamed = false;
+  for (const IdfObject& idfObject : idfFile->getObjectsByType(IddObjectType::Zone)){
+    zoneNamed = zoneNamed || (idfObject.nameString() == name);
+  }
+  EXPECT_TRUE(zoneNamed);
+
+  // nothing is left to rename when the stream is read into a Workspace
+  Workspace streamWorkspace(*idfFile);
+  std::stringstream streamWorkspaceIdf;
+  streamWorkspaceIdf << streamWorkspace.toIdfFile();
+  EXPECT_EQ(streamIdf.str(), streamWorkspaceIdf.str());
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslationProfile) {
+  Model model = exampleModel();
+
+  // off by default
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  EXPECT_TRUE(forwardTranslator.translationProfile().empty());
+
+  forwardTranslator.setProfileTranslation(true);
+  workspace = forwardTranslator.translateModel(model);
+  Profiler profile = forwardTranslator.translationProfile();
+  EXPECT_FALSE(profile.empty());
+
+  EXPECT_EQ(1u, profile.numCalls("Copy Model"));
+  EXPECT_EQ(1u, profile.numCalls("Preprocess Model"));
+  EXPECT_EQ(1u, profile.numCalls("Translate Constructions"));
+  EXPECT_EQ(1u, profile.numCalls("Translate Schedules"));
+  EXPECT_EQ(1u, profile.numCalls("Translate Objects"));
+  EXPECT_LT(0u, profile.numCalls("Sort Objects"));
+  EXPECT_EQ(1u, profile.numCalls("Create Workspace"));
+  EXPECT_EQ(workspace.numObjects() + 1u, profile.count("Create Workspace")); // and the version object
+
+  // one stage per type of translated object
+  EXPECT_EQ(model.getConcreteModelObjects<ThermalZone>().size(), profile.numCalls("OS:ThermalZone"));
+  EXPECT_LT(0u, profile.count("OS:ThermalZone"));
+  EXPECT_LE(profile.totalSeconds("Translate Objects"), profile.totalSeconds());
+
+  // a new translation replaces the profile
+  std::stringstream ss;
+  EXPECT_TRUE(forwardTranslator.translateModelToStream(model, ss));
+  profile = forwardTranslator.translationProfile();
+  EXPECT_EQ(1u, profile.numCalls("Copy Model"));
+  EXPECT_EQ(0u, profile.numCalls("Create Workspace"));
+  EXPECT_EQ(1u, profile.numCalls("Write IDF"));
+
+  // objects translated ahead of time are recorded under their types as they are merged
+  ForwardTranslator parallelTranslator;
+  parallelTranslator.setNumThreads(4);
+  parallelTranslator.setProfileTranslation(true);
+  parallelTranslator.translateModel(model);
+  Profiler parallelProfile = parallelTranslator.translationProfile();
+  workspace = forwardTranslator.translateModel(model);
+  profile = forwardTranslator.translationProfile();
+  EXPECT_EQ(0u, profile.numCalls("Stage Objects"));
+  EXPECT_EQ(1u, parallelProfile.numCalls("Stage Objects"));
+  EXPECT_LT(0u, parallelProfile.count("Stage Objects"));
+  EXPECT_LT(0u, profile.numCalls("OS:Construction"));
+  EXPECT_EQ(profile.numCalls("OS:Construction"), parallelProfile.numCalls("OS:Construction"));
+  EXPECT_EQ(profile.count("OS:Construction"), parallelProfile.count("OS:Construction"));
+  EXPECT_EQ(profile.numCalls("OS:Material"), parallelProfile.numCalls("OS:Material"));
+}
+
 
 TEST_F(EnergyPlusFixture,ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
@@ -0,0 +1,218 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "EnergyPlusFixture.hpp"
+
+#include "../ForwardTranslator.hpp"
+#include "../IncrementalForwardTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Construction.hpp"
+#include "../../model/Construction_Impl.hpp"
+#include "../../model/CurveCubic.hpp"
+#include "../../model/CurveCubic_Impl.hpp"
+#include "../../model/ScheduleConstant.hpp"
+#include "../../model/ScheduleConstant_Impl.hpp"
+#include "../../model/ScheduleDay.hpp"
+#include "../../model/ScheduleDay_Impl.hpp"
+#include "../../model/ScheduleRule.hpp"
+#include "../../model/ScheduleRule_Impl.hpp"
+#include "../../model/ScheduleRuleset.hpp"
+#include "../../model/ScheduleRuleset_Impl.hpp"
+#include "../../model/SimpleGlazing.hpp"
+#include "../../model/SimpleGlazing_Impl.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/StandardOpaqueMaterial.hpp"
+#include "../../model/StandardOpaqueMaterial_Impl.hpp"
+#include "../../model/SubSurface.hpp"
+#include "../../model/SubSurface_Impl.hpp"
+#include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
+#include "../../model/ThermalZone.hpp"
+#include "../../model/ThermalZone_Impl.hpp"
+#include "../../model/YearDescription.hpp"
+#include "../../model/YearDescription_Impl.hpp"
+
+#include "../../utilities/idf/Workspace.hpp"
+#include "../../utilities/idf/WorkspaceObject.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
+#include "../../utilities/time/Date.hpp"
+#include "../../utilities/time/Time.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace openstudio::energyplus;
+using namespace openstudio::model;
+using namespace openstudio;
+
+namespace {
+
+  // the workspace as IDF text, objects in order
+  std::string idfText(const Workspace& workspace) {
+    std::stringstream ss;
+    ss << workspace.toIdfFile();
+    return ss.str();
+  }
+
+}
+
+TEST_F(EnergyPlusFixture, IncrementalForwardTranslator) {
+  Model model = exampleModel();
+
+  // a window construction of its own and objects to change between translations
+  SimpleGlazing glazing(model, 3.0, 0.4);
+  SimpleGlazing otherGlazing(model, 1.5, 0.3);
+  Construction windowConstruction(std::vector<FenestrationMaterial>{glazing});
+  boost::optional<SubSurface> window;
+  for (SubSurface& subSurface : model.getConcreteModelObjects<SubSurface>()) {
+    if (subSurface.subSurfaceType() == "FixedWindow") {
+      window = subSurface;
+    }
+  }
+  ASSERT_TRUE(window);
+  EXPECT_TRUE(window->setConstruction(windowConstruction));
+  CurveCubic curve(model);
+  ScheduleConstant schedule(model);
+  EXPECT_TRUE(schedule.setValue(1.0));
+  // added by the translation of a ScheduleRuleset, to the copy of the model it works on
+  ASSERT_FALSE(model.getOptionalUniqueModelObject<model::YearDescription>());
+
+  IncrementalForwardTranslator translator(model);
+  EXPECT_TRUE(translator.fullTranslationRequired());
+  Workspace workspace = translator.translateModel();
+  EXPECT_FALSE(translator.fullTranslationRequired());
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // nothing changed
+  EXPECT_TRUE(workspace == translator.translateModel());
+
+  // changed objects are replaced in the same workspace
+  EXPECT_TRUE(glazing.setUFactor(2.0));
+  EXPECT_TRUE(windowConstruction.setLayers(std::vector<Material>{otherGlazing}));
+  EXPECT_TRUE(curve.setCoefficient2x(2.0));
+  EXPECT_TRUE(schedule.setValue(0.5));
+  EXPECT_FALSE(translator.fullTranslationRequired());
+  EXPECT_TRUE(workspace == translator.translateModel());
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // a setpoint of a ScheduleRuleset changes its day schedule only
+  ScheduleRuleset heatingSchedule = model.getModelObjectByName<ScheduleRuleset>("Medium Office Heating Setpoint Schedule").get();
+  std::vector<ScheduleRule> rules = heatingSchedule.scheduleRules();
+  ASSERT_EQ(2u, rules.size());
+  EXPECT_TRUE(rules[0].daySchedule().addValue(Time(0, 22, 0, 0), 22.0));
+  EXPECT_FALSE(translator.fullTranslationRequired());
+  unsigned numObjects = model.numObjects();
+  std::stringstream modelText;
+  modelText << model.toIdfFile();
+  EXPECT_TRUE(workspace == translator.translateModel());
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // translating it again leaves the model as it was
+  EXPECT_EQ(numObjects, model.numObjects());
+  EXPECT_FALSE(model.getOptionalUniqueModelObject<model::YearDescription>());
+  std::stringstream retranslatedModelText;
+  retranslatedModelText << model.toIdfFile();
+  EXPECT_EQ(modelText.str(), retranslatedModelText.str());
+
+  // the days a rule applies to change the week schedules of its ScheduleRuleset
+  ScheduleRule saturdayRule = rules[0].applySaturday() ? rules[0] : rules[1];
+  ScheduleRule weekdaysRule = rules[0].applySaturday() ? rules[1] : rules[0];
+  EXPECT_TRUE(weekdaysRule.setApplyMonday(false));
+  EXPECT_FALSE(translator.fullTranslationRequired());
+  EXPECT_TRUE(workspace == translator.translateModel());
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  EXPECT_TRUE(saturdayRule.setApplySunday(true));
+  EXPECT_FALSE(translator.fullTranslationRequired());
+  EXPECT_TRUE(workspace == translator.translateModel());
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // so do its dates, the week schedules are named after them and so the whole model is translated
+  EXPECT_TRUE(saturdayRule.setStartDate(Date(MonthOfYear::Jun, 1)));
+  EXPECT_FALSE(translator.fullTranslationRequired());
+  Workspace translated = translator.translateModel();
+  EXPECT_FALSE(workspace == translated);
+  workspace = translated;
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // renamed objects are referred to by other objects
+  curve.setName("Renamed Curve");
+  EXPECT_TRUE(translator.fullTranslationRequired());
+  workspace = translator.translateModel();
+  EXPECT_FALSE(translator.fullTranslationRequired());
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // so are added objects
+  CurveCubic otherCurve(model);
+  EXPECT_TRUE(translator.fullTranslationRequired());
+  workspace = translator.translateModel();
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // other objects are translated with the whole model
+  ThermalZone zone = model.getConcreteModelObjects<ThermalZone>()[0];
+  EXPECT_TRUE(zone.setMultiplier(2));
+  EXPECT_TRUE(translator.fullTranslationRequired());
+  workspace = translator.translateModel();
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // including changes made without change signals
+  Space space = model.getConcreteModelObjects<Space>()[0];
+  EXPECT_TRUE(space.setXOrigin(space.xOrigin() + 1.0));
+  EXPECT_TRUE(translator.fullTranslationRequired());
+  workspace = translator.translateModel();
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+
+  // constructions of matched surfaces may be reversed depending on their layers
+  boost::optional<Surface> interiorSurface;
+  for (const Surface& surface : model.getConcreteModelObjects<Surface>()) {
+    if (surface.adjacentSurface()) {
+      interiorSurface = surface;
+    }
+  }
+  ASSERT_TRUE(interiorSurface);
+  StandardOpaqueMaterial gypsum(model, "Smooth", 0.0127);
+  StandardOpaqueMaterial insulation(model, "Smooth", 0.05);
+  Construction interiorConstruction(std::vector<OpaqueMaterial>{gypsum, insulation});
+  EXPECT_TRUE(interiorSurface->setConstruction(interiorConstruction));
+  EXPECT_TRUE(interiorSurface->adjacentSurface()->setConstruction(interiorConstruction));
+  workspace = translator.translateModel();
+  EXPECT_FALSE(translator.fullTranslationRequired());
+
+  std::vector<Material> layers = interiorConstruction.layers();
+  std::reverse(layers.begin(), layers.end());
+  EXPECT_TRUE(interiorConstruction.setLayers(layers));
+  EXPECT_TRUE(translator.fullTranslationRequired());
+  workspace = translator.translateModel();
+  EXPECT_EQ(idfText(ForwardTranslator().translateModel(model)), idfText(workspace));
+}
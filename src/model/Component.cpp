@@ -166,6 +166,10 @@ namespace detail {
     return boost::none;
   }
 
+  std::vector<Handle> Component_Impl::unusedResourceObjectHandles() const {
+    return std::vector<Handle>();
+  }
+
   std::vector<openstudio::IdfObject> Component_Impl::purgeUnusedResourceObjects() {
     return IdfObjectVector();
   }
@@ -130,6 +130,9 @@ namespace detail {
     /** Override to return boost::none. */
     virtual boost::optional<ComponentData> insertComponent(const Component& component) override;
 
+    /** Override to return empty vector. */
+    virtual std::vector<Handle> unusedResourceObjectHandles() const override;
+
     /** Override to return empty vector. */
     virtual std::vector<openstudio::IdfObject> purgeUnusedResourceObjects() override;
     virtual std::vector<openstudio::IdfObject> purgeUnusedResourceObjects(IddObjectType iddObjectType) override;
@@ -0,0 +1,166 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "FieldColumns.hpp"
+
+#include "../utilities/idf/WorkspaceObject.hpp"
+#include "../utilities/idd/IddObject.hpp"
+#include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include <limits>
+#include <unordered_map>
+
+namespace openstudio {
+namespace model {
+
+FieldColumns::FieldColumns(IddObjectType iddObjectType,
+                           const std::vector<unsigned>& fieldIndices,
+                           const std::vector<WorkspaceObject>& objects)
+  : m_iddObjectType(iddObjectType)
+{
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  m_handles.reserve(objects.size());
+  for (const WorkspaceObject& object : objects) {
+    OS_ASSERT(object.iddObject().type() == iddObjectType);
+    m_handles.push_back(object.handle());
+  }
+
+  for (unsigned fieldIndex : fieldIndices) {
+    Column column;
+    column.fieldIndex = fieldIndex;
+    column.doubles.reserve(objects.size());
+    column.stringIndices.reserve(objects.size());
+
+    // each distinct string is converted to a double only once
+    std::unordered_map<std::string, int> stringIndexMap;
+    std::vector<double> stringDoubles;
+
+    for (const WorkspaceObject& object : objects) {
+      boost::optional<std::string> value = object.getString(fieldIndex, false, true);
+      if (!value) {
+        column.doubles.push_back(nan);
+        column.stringIndices.push_back(-1);
+        continue;
+      }
+
+      auto inserted = stringIndexMap.insert(std::make_pair(*value, static_cast<int>(column.strings.size())));
+      if (inserted.second) {
+        double d = nan;
+        if (!(istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
+          try { d = boost::lexical_cast<double>(*value); }
+          catch (const std::exception&) {}
+        }
+        column.strings.push_back(*value);
+        stringDoubles.push_back(d);
+      }
+      column.stringIndices.push_back(inserted.first->second);
+      column.doubles.push_back(stringDoubles[inserted.first->second]);
+    }
+
+    if (!objects.empty() && objects.front().canBeSource(fieldIndex)) {
+      column.handles.reserve(objects.size());
+      for (const WorkspaceObject& object : objects) {
+        boost::optional<WorkspaceObject> target = object.getTarget(fieldIndex);
+        column.handles.push_back(target ? target->handle() : Handle());
+      }
+    }
+
+    m_columns.push_back(std::move(column));
+  }
+}
+
+IddObjectType FieldColumns::iddObjectType() const {
+  return m_iddObjectType;
+}
+
+std::vector<unsigned> FieldColumns::fieldIndices() const {
+  std::vector<unsigned> result;
+  for (const Column& column : m_columns) {
+    result.push_back(column.fieldIndex);
+  }
+  return result;
+}
+
+unsigned FieldColumns::numRows() const {
+  return m_handles.size();
+}
+
+std::vector<Handle> FieldColumns::handles() const {
+  return m_handles;
+}
+
+std::vector<double> FieldColumns::doubleColumn(unsigned fieldIndex) const {
+  return column(fieldIndex).doubles;
+}
+
+std::vector<int> FieldColumns::stringIndexColumn(unsigned fieldIndex) const {
+  return column(fieldIndex).stringIndices;
+}
+
+std::vector<std::string> FieldColumns::stringTable(unsigned fieldIndex) const {
+  return column(fieldIndex).strings;
+}
+
+std::vector<std::string> FieldColumns::stringColumn(unsigned fieldIndex) const {
+  const Column& c = column(fieldIndex);
+  std::vector<std::string> result;
+  result.reserve(c.stringIndices.size());
+  for (int i : c.stringIndices) {
+    if (i < 0) {
+      result.push_back(std::string());
+    } else {
+      result.push_back(c.strings[i]);
+    }
+  }
+  return result;
+}
+
+std::vector<Handle> FieldColumns::handleColumn(unsigned fieldIndex) const {
+  const Column& c = column(fieldIndex);
+  if (c.handles.empty()) {
+    return std::vector<Handle>(m_handles.size(), Handle());
+  }
+  return c.handles;
+}
+
+const FieldColumns::Column& FieldColumns::column(unsigned fieldIndex) const {
+  for (const Column& c : m_columns) {
+    if (c.fieldIndex == fieldIndex) {
+      return c;
+    }
+  }
+  LOG_AND_THROW("Field " << fieldIndex << " was not requested for this FieldColumns object.");
+}
+
+} // model
+} // openstudio
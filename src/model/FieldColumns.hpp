@@ -0,0 +1,117 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef MODEL_FIELDCOLUMNS_HPP
+#define MODEL_FIELDCOLUMNS_HPP
+
+#include "ModelAPI.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/idf/Handle.hpp"
+#include "../utilities/idd/IddEnums.hpp"
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+class WorkspaceObject;
+
+namespace model {
+
+/** FieldColumns holds the values of selected fields for all objects of a single IddObjectType
+ *  in column order, one contiguous array per field, with one row per object. Each field is
+ *  available as doubles (NaN where the field is empty, autosized, autocalculated or not
+ *  numeric), as indices into a table of distinct strings, and, for pointer fields, as the
+ *  handles of the pointed-to objects. Returned by Model::fieldColumns. */
+class MODEL_API FieldColumns {
+ public:
+  /** @name Constructors and Destructors */
+  //@{
+
+  /** Reads fieldIndices from objects, which must all be of type iddObjectType. */
+  FieldColumns(IddObjectType iddObjectType,
+               const std::vector<unsigned>& fieldIndices,
+               const std::vector<WorkspaceObject>& objects);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  IddObjectType iddObjectType() const;
+
+  std::vector<unsigned> fieldIndices() const;
+
+  unsigned numRows() const;
+
+  /** Returns the handle of the object in each row. */
+  std::vector<Handle> handles() const;
+
+  /** Returns the numeric value of fieldIndex in each row, NaN where there is none. */
+  std::vector<double> doubleColumn(unsigned fieldIndex) const;
+
+  /** Returns the index into stringTable(fieldIndex) of fieldIndex in each row, -1 where the
+   *  field is empty. */
+  std::vector<int> stringIndexColumn(unsigned fieldIndex) const;
+
+  /** Returns the distinct non-empty values of fieldIndex, in order of first appearance. */
+  std::vector<std::string> stringTable(unsigned fieldIndex) const;
+
+  /** Returns the string value of fieldIndex in each row, empty where the field is empty. For
+   *  pointer fields this is the name of the pointed-to object. */
+  std::vector<std::string> stringColumn(unsigned fieldIndex) const;
+
+  /** Returns the handle of the object pointed to by fieldIndex in each row, a null handle
+   *  where fieldIndex is not a pointer field or the pointer is not set. */
+  std::vector<Handle> handleColumn(unsigned fieldIndex) const;
+
+  //@}
+ private:
+  struct Column
+  {
+    unsigned fieldIndex;
+    std::vector<double> doubles;
+    std::vector<int> stringIndices;
+    std::vector<std::string> strings;
+    std::vector<Handle> handles;
+  };
+
+  const Column& column(unsigned fieldIndex) const;
+
+  IddObjectType m_iddObjectType;
+  std::vector<Handle> m_handles;
+  std::vector<Column> m_columns;
+
+  REGISTER_LOGGER("openstudio.model.FieldColumns");
+};
+
+} // model
+} // openstudio
+
+#endif // MODEL_FIELDCOLUMNS_HPP
@@ -50,11 +50,14 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
 
+#include <unordered_set>
+
 namespace openstudio {
 
 namespace model {
@@ -63,11 +66,15 @@ namespace detail {
   Loop_Impl::Loop_Impl(IddObjectType type, Model_Impl* model)
     : ParentObject_Impl(type,model)
   {
+    // the loop's own node fields define where the searches start and stop
+    this->Loop_Impl::onChange.connect<Loop_Impl, &Loop_Impl::clearCachedTopology>(this);
   }
 
   Loop_Impl::Loop_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ParentObject_Impl(idfObject, model, keepHandle)
   {
+    // the loop's own node fields define where the searches start and stop
+    this->Loop_Impl::onChange.connect<Loop_Impl, &Loop_Impl::clearCachedTopology>(this);
   }
 
   Loop_Impl::Loop_Impl(
@@ -76,6 +83,8 @@ namespace detail {
       bool keepHandle)
     : ParentObject_Impl(other,model,keepHandle)
   {
+    // the loop's own node fields define where the searches start and stop
+    this->Loop_Impl::onChange.connect<Loop_Impl, &Loop_Impl::clearCachedTopology>(this);
   }
 
   Loop_Impl::Loop_Impl(const Loop_Impl& other,
@@ -83,6 +92,8 @@ namespace detail {
       bool keepHandles)
     : ParentObject_Impl(other,model,keepHandles)
   {
+    // the loop's own node fields define where the searches start and stop
+    this->Loop_Impl::onChange.connect<Loop_Impl, &Loop_Impl::clearCachedTopology>(this);
   }
 
   const std::vector<std::string>& Loop_Impl::outputVariableNames() const
@@ -155,11 +166,11 @@ namespace detail {
 
   boost::optional<ModelObject> Loop_Impl::demandComponent(openstudio::Handle handle) const
   {
-    auto comps = demandComponents();
+    const LoopSideTopology& topology = cachedTopology(false);
 
-    auto it = std::find_if(comps.begin(), comps.end(), [&](const ModelObject & comp) {return (comp.handle() == handle);});
-    if ( it != comps.end() ) {
-      return *it;
+    auto it = topology.handleIndex.find(handle);
+    if ( it != topology.handleIndex.end() ) {
+      return topology.components[it->second];
     }
 
     return boost::none;
@@ -167,11 +178,11 @@ namespace detail {
 
   boost::optional<ModelObject> Loop_Impl::supplyComponent(openstudio::Handle handle) const
   {
-    auto comps = supplyComponents();
+    const LoopSideTopology& topology = cachedTopology(true);
 
-    auto it = std::find_if(comps.begin(), comps.end(), [&](const ModelObject & comp) {return (comp.handle() == handle);});
-    if ( it != comps.end() ) {
-      return *it;
+    auto it = topology.handleIndex.find(handle);
+    if ( it != topology.handleIndex.end() ) {
+      return topology.components[it->second];
     }
 
     return boost::none;
@@ -224,73 +235,92 @@ namespace detail {
     return result;
   }
 
+  // State of the depth first search in findModelObjects.
+  // The vectors keep the traversal order, the sets give constant time membership tests
+  // which matters on loops with hundreds of branches.
+  struct LoopSearchState {
+    std::vector<HVACComponent> visited;
+    std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > visitedHandles;
+    std::vector<HVACComponent> paths;
+    std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > pathHandles;
+
+    void push(const HVACComponent & comp) {
+      visited.push_back(comp);
+      visitedHandles.insert(comp.handle());
+    }
+
+    void pop() {
+      visitedHandles.erase(visited.back().handle());
+      visited.pop_back();
+    }
+
+    bool isVisited(const HVACComponent & comp) const {
+      return visitedHandles.find(comp.handle()) != visitedHandles.end();
+    }
+  };
+
   // Recursive depth first search
   // start algorithm with one source node in the visited vector
   // when complete, paths will be populated with all nodes between the source node and sink
-  void findModelObjects(const HVACComponent & sink, std::vector<HVACComponent> & visited, std::vector<HVACComponent> & paths, bool isDemandComponents)
+  void findModelObjects(const HVACComponent & sink, LoopSearchState & state)
   {
     boost::optional<HVACComponent> prev;
-    if( visited.size() >= 2u ) prev = visited.rbegin()[1];
+    if( state.visited.size() >= 2u ) prev = state.visited.rbegin()[1];
 
-    std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(prev);
+    std::vector<HVACComponent> nodes = state.visited.back().getImpl<HVACComponent_Impl>()->edges(prev);
 
     for(const auto & node : nodes)
     {
       // if it node has already been visited then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() )
+      if( state.isVisited(node) )
       {
         continue;
       }
       if( node == sink )
       {
-        visited.push_back(node);
+        state.push(node);
         // Avoid pushing duplicate nodes into paths
-        if( paths.empty() )
+        for( const auto & visitedit : state.visited )
         {
-          paths.insert(paths.end(), visited.begin(), visited.end());
-        }
-        else
-        {
-          for( const auto & visitedit : visited )
+          if( state.pathHandles.insert(visitedit.handle()).second )
           {
-            if( std::find(paths.begin(),paths.end(),visitedit) == paths.end() )
-            {
-              paths.push_back(visitedit);
-            }
+            state.paths.push_back(visitedit);
           }
         }
-        visited.pop_back();
+        state.pop();
       }
     }
 
     for(const auto & node : nodes)
     {
       // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() ||
-          node == sink )
+      if( state.isVisited(node) || node == sink )
       {
         continue;
       }
-      visited.push_back(node);
-      findModelObjects(sink, visited, paths, isDemandComponents);
-      visited.pop_back();
+      state.push(node);
+      findModelObjects(sink, state);
+      state.pop();
     }
   }
 
+  std::vector<HVACComponent> findModelObjects(const HVACComponent & source, const HVACComponent & sink)
+  {
+    if( source == sink ) {
+      return std::vector<HVACComponent>{source};
+    }
+
+    LoopSearchState state;
+    state.push(source);
+    findModelObjects(sink, state);
+    return state.paths;
+  }
+
   std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type ) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, true);
-    }
+    std::vector<HVACComponent> allPaths = findModelObjects(inletComp, outletComp);
     std::vector<ModelObject> _demandComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
     // Filter modelObjects for type
@@ -320,6 +350,16 @@ namespace detail {
   };
 
   std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const
+  {
+    return filterTopology(cachedTopology(true), type);
+  }
+
+  std::vector<ModelObject> Loop_Impl::demandComponents(openstudio::IddObjectType type) const
+  {
+    return filterTopology(cachedTopology(false), type);
+  }
+
+  std::vector<ModelObject> Loop_Impl::findSupplyComponents() const
   {
     std::vector<ModelObject> result;
 
@@ -328,8 +368,7 @@ namespace detail {
 
     for( auto const & t_supplyOutletNode : t_supplyOutletNodes ) {
       auto components = supplyComponents( t_supplyInletNode,
-                                          t_supplyOutletNode,
-                                          type );
+                                          t_supplyOutletNode );
       result.insert(result.end(),components.begin(),components.end());
     }
 
@@ -343,7 +382,7 @@ namespace detail {
     }
   }
 
-  std::vector<ModelObject> Loop_Impl::demandComponents(openstudio::IddObjectType type) const
+  std::vector<ModelObject> Loop_Impl::findDemandComponents() const
   {
     std::vector<ModelObject> result;
 
@@ -352,8 +391,7 @@ namespace detail {
 
     for( auto const & t_demandInletNode : t_demandInletNodes ) {
       auto components = demandComponents( t_demandInletNode,
-                                          t_demandOutletNode,
-                                          type );
+                                          t_demandOutletNode );
       result.insert(result.end(),components.begin(),components.end());
     }
 
@@ -367,6 +405,53 @@ namespace detail {
     }
   }
 
+  const Loop_Impl::LoopSideTopology& Loop_Impl::cachedTopology(bool supplySide) const
+  {
+    unsigned revision = model().getImpl<Model_Impl>()->hvacTopologyRevision();
+    if( revision != m_cachedTopologyRevision ) {
+      m_cachedSupplyTopology.reset();
+      m_cachedDemandTopology.reset();
+      m_cachedTopologyRevision = revision;
+    }
+
+    boost::optional<LoopSideTopology>& cache = supplySide ? m_cachedSupplyTopology : m_cachedDemandTopology;
+    if( ! cache ) {
+      LoopSideTopology topology;
+      topology.components = supplySide ? findSupplyComponents() : findDemandComponents();
+      for( size_t i = 0; i < topology.components.size(); ++i ) {
+        const ModelObject & comp = topology.components[i];
+        topology.handleIndex.emplace(comp.handle(), i);
+        topology.typeIndex[comp.iddObjectType()].push_back(i);
+      }
+      cache = std::move(topology);
+    }
+
+    return cache.get();
+  }
+
+  std::vector<ModelObject> Loop_Impl::filterTopology(const LoopSideTopology& topology, openstudio::IddObjectType type) const
+  {
+    if( type == IddObjectType::Catchall ) {
+      return topology.components;
+    }
+
+    std::vector<ModelObject> result;
+    auto it = topology.typeIndex.find(type);
+    if( it != topology.typeIndex.end() ) {
+      result.reserve(it->second.size());
+      for( const auto & i : it->second ) {
+        result.push_back(topology.components[i]);
+      }
+    }
+    return result;
+  }
+
+  void Loop_Impl::clearCachedTopology()
+  {
+    m_cachedSupplyTopology.reset();
+    m_cachedDemandTopology.reset();
+  }
+
   std::vector<ModelObject> Loop_Impl::components(openstudio::IddObjectType type)
   {
     std::vector<ModelObject> result;
@@ -383,16 +468,7 @@ namespace detail {
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, false);
-    }
+    std::vector<HVACComponent> allPaths = findModelObjects(inletComp, outletComp);
     std::vector<ModelObject> _supplyComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
 
     // Filter modelObjects for type
@@ -31,6 +31,11 @@
 #define MODEL_LOOP_IMPL_HPP
 
 #include "ParentObject_Impl.hpp"
+#include "ModelObject.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <unordered_map>
 
 namespace openstudio {
 
@@ -130,11 +135,36 @@ namespace detail {
 
     virtual AvailabilityManagerAssignmentList availabilityManagerAssignmentList() const = 0;
 
+    /** Drops the cached supply and demand component graphs, they will be rebuilt on next access. */
+    void clearCachedTopology();
 
   private:
 
     REGISTER_LOGGER("openstudio.model.Loop");
 
+    // Cached result of the depth first search over one side of the loop.
+    // components are in the same order the search produces them,
+    // handleIndex and typeIndex point into components.
+    struct LoopSideTopology {
+      std::vector<ModelObject> components;
+      std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid> > handleIndex;
+      std::map<IddObjectType, std::vector<size_t> > typeIndex;
+    };
+
+    // Returns the cached topology for the supply (or demand) side, rebuilding it if the model
+    // reports that connections have changed since it was built.
+    const LoopSideTopology& cachedTopology(bool supplySide) const;
+
+    std::vector<ModelObject> filterTopology(const LoopSideTopology& topology, openstudio::IddObjectType type) const;
+
+    // uncached searches over the whole supply or demand side
+    std::vector<ModelObject> findSupplyComponents() const;
+    std::vector<ModelObject> findDemandComponents() const;
+
+    mutable boost::optional<LoopSideTopology> m_cachedSupplyTopology;
+    mutable boost::optional<LoopSideTopology> m_cachedDemandTopology;
+    mutable unsigned m_cachedTopologyRevision = 0;
+
     // TODO: Make these const.
     boost::optional<ModelObject> supplyInletNodeAsModelObject();
     boost::optional<ModelObject> supplyOutletNodeAsModelObject();
@@ -37,6 +37,9 @@
 #include "ModelObject_Impl.hpp"
 #include "ResourceObject.hpp"
 #include "ResourceObject_Impl.hpp"
+#include "PlanarSurface_Impl.hpp"
+#include "Space_Impl.hpp"
+#include "SpaceType_Impl.hpp"
 
 // central list of all concrete ModelObject header files (_Impl and non-_Impl)
 // needed here for ::createObject
@@ -44,6 +47,17 @@
 
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/OS_Version_FieldEnums.hxx>
+#include <utilities/idd/OS_ElectricEquipment_FieldEnums.hxx>
+#include <utilities/idd/OS_ElectricEquipment_ITE_AirCooled_FieldEnums.hxx>
+#include <utilities/idd/OS_GasEquipment_FieldEnums.hxx>
+#include <utilities/idd/OS_HotWaterEquipment_FieldEnums.hxx>
+#include <utilities/idd/OS_Lights_FieldEnums.hxx>
+#include <utilities/idd/OS_Luminaire_FieldEnums.hxx>
+#include <utilities/idd/OS_OtherEquipment_FieldEnums.hxx>
+#include <utilities/idd/OS_People_FieldEnums.hxx>
+#include <utilities/idd/OS_SpaceInfiltration_DesignFlowRate_FieldEnums.hxx>
+#include <utilities/idd/OS_SpaceInfiltration_EffectiveLeakageArea_FieldEnums.hxx>
+#include <utilities/idd/OS_SteamEquipment_FieldEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
@@ -64,6 +78,10 @@
 
 #include <boost/regex.hpp>
 
+#include <cmath>
+#include <deque>
+#include <unordered_set>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -79,6 +97,8 @@ namespace detail {
     : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    this->Model_Impl::addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectAdded>(this);
+    this->Model_Impl::removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectRemoved>(this);
   }
 
   Model_Impl::Model_Impl(const IdfFile& idfFile)
@@ -90,6 +110,8 @@ namespace detail {
           << "data schema. (Attempted construction from IdfFile with IddFileType "
           << idfFile.iddFileType().valueDescription() << ".)");
     }
+    this->Model_Impl::addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectAdded>(this);
+    this->Model_Impl::removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectRemoved>(this);
   }
 
   Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace,
@@ -102,6 +124,8 @@ namespace detail {
         << "data schema. (Attempted construction from Workspace with IddFileType "
         << workspace.iddFileType().valueDescription() << ".)");
     }
+    this->Model_Impl::addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectAdded>(this);
+    this->Model_Impl::removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectRemoved>(this);
   }
 
   // copy constructor, used for clone
@@ -112,6 +136,8 @@ namespace detail {
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    this->Model_Impl::addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectAdded>(this);
+    this->Model_Impl::removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectRemoved>(this);
   }
 
   // copy constructor used for cloneSubset
@@ -124,6 +150,8 @@ namespace detail {
       m_workflowJSON(WorkflowJSON(other.m_workflowJSON))
   {
     // notice we are cloning the workflow and sqlfile too, if necessary
+    this->Model_Impl::addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectAdded>(this);
+    this->Model_Impl::removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::mf_objectRemoved>(this);
   }
   Workspace Model_Impl::clone(bool keepHandles) const {
     // copy everything but objects
@@ -831,15 +859,87 @@ namespace detail {
     return boost::none;
   }
 
+  std::vector<Handle> Model_Impl::unusedResourceObjectHandles() const {
+    typedef std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> HandleHashSet;
+
+    // every ResourceObject, along with the objects it owns through children(); owned
+    // objects are only reachable through their owner, so they never act as roots
+    std::vector<ResourceObject> resources = model().getModelObjects<ResourceObject>();
+    std::unordered_map<Handle, std::vector<ModelObject>, boost::hash<boost::uuids::uuid>> ownedObjects;
+    HandleHashSet ownedHandles;
+    for (const ResourceObject& resource : resources) {
+      std::vector<ModelObject>& owned = ownedObjects[resource.handle()];
+      for (const ModelObject& child : getRecursiveChildren(resource)) {
+        if (child.handle() != resource.handle()) {
+          owned.push_back(child);
+          ownedHandles.insert(child.handle());
+        }
+      }
+    }
+
+    // mark: start from all non-resource objects that are not owned by a resource
+    HandleHashSet reached;
+    std::deque<WorkspaceObject> queue;
+    for (const WorkspaceObject& object : objects()) {
+      Handle handle = object.handle();
+      if ((ownedObjects.find(handle) == ownedObjects.end()) && (ownedHandles.find(handle) == ownedHandles.end())) {
+        reached.insert(handle);
+        queue.push_back(object);
+      }
+    }
+
+    while (!queue.empty()) {
+      WorkspaceObject object = queue.front();
+      queue.pop_front();
+
+      for (const WorkspaceObject& target : object.targets()) {
+        if (reached.insert(target.handle()).second) {
+          queue.push_back(target);
+        }
+      }
+
+      // objects owned by a reached resource are reached as well
+      auto it = ownedObjects.find(object.handle());
+      if (it != ownedObjects.end()) {
+        for (const ModelObject& child : it->second) {
+          if (reached.insert(child.handle()).second) {
+            queue.push_back(child);
+          }
+        }
+      }
+    }
+
+    // sweep: unreached resources and whatever they own
+    std::vector<Handle> result;
+    HandleHashSet swept;
+    for (const ResourceObject& resource : resources) {
+      if (reached.find(resource.handle()) != reached.end()) {
+        continue;
+      }
+      if (swept.insert(resource.handle()).second) {
+        result.push_back(resource.handle());
+      }
+      for (const ModelObject& child : ownedObjects[resource.handle()]) {
+        if ((reached.find(child.handle()) == reached.end()) && swept.insert(child.handle()).second) {
+          result.push_back(child.handle());
+        }
+      }
+    }
+
+    return result;
+  }
+
   std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects() {
-    ResourceObjectVector resources = model().getModelObjects<ResourceObject>();
     IdfObjectVector removedObjects;
-    for (ResourceObject& resource : resources) {
-      // test for initialized first in case earlier .remove() got this one already
-      if ((resource.initialized()) && (resource.nonResourceObjectUseCount(true) == 0)) {
-        IdfObjectVector thisCallRemoved = resource.remove();
-        removedObjects.insert(removedObjects.end(),thisCallRemoved.begin(),thisCallRemoved.end());
+    for (const Handle& handle : unusedResourceObjectHandles()) {
+      // skip objects already removed along with their owner, or by the remove() override of another object
+      OptionalWorkspaceObject object = getObject(handle);
+      if (!object) {
+        continue;
       }
+      // remove through the object so that overrides such as ExternalFile::remove run
+      IdfObjectVector thisCallRemoved = object->cast<ModelObject>().remove();
+      removedObjects.insert(removedObjects.end(), thisCallRemoved.begin(), thisCallRemoved.end());
     }
     return removedObjects;
   }
@@ -877,6 +977,8 @@ namespace detail {
 
     sourceObject.setPointer(sourcePort,c.handle());
     targetObject.setPointer(targetPort,c.handle());
+
+    invalidateHVACTopology();
   }
 
   void Model_Impl::disconnect(ModelObject object,
@@ -1027,6 +1129,9 @@ namespace detail {
     clearCachedYearDescription(dummy);
     clearCachedWeatherFile(dummy);
     clearCachedPerformancePrecisionTradeoffs(dummy);
+    invalidateHVACTopology();
+    clearCachedResolvedConstructions();
+    clearCachedResolvedDefaultSchedules();
   }
 
   void Model_Impl::clearCachedBuilding(const Handle &)
@@ -1074,6 +1179,339 @@ namespace detail {
     m_cachedPerformancePrecisionTradeoffs.reset();
   }
 
+  unsigned Model_Impl::hvacTopologyRevision() const
+  {
+    return m_hvacTopologyRevision;
+  }
+
+  void Model_Impl::invalidateHVACTopology()
+  {
+    ++m_hvacTopologyRevision;
+  }
+
+  void Model_Impl::mf_objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const openstudio::IddObjectType& type, const openstudio::UUID&)
+  {
+    // Connections are the edges of the HVAC graph, any change to one of them may change loop topology
+    if (type == IddObjectType::OS_Connection) {
+      object.get()->WorkspaceObject_Impl::onChange.connect<Model_Impl, &Model_Impl::invalidateHVACTopology>(this);
+      invalidateHVACTopology();
+    }
+
+    // objects that take part in resolving default constructions
+    static const std::set<IddObjectType> constructionSearchTypes {
+      IddObjectType::OS_DefaultConstructionSet,
+      IddObjectType::OS_DefaultSurfaceConstructions,
+      IddObjectType::OS_DefaultSubSurfaceConstructions,
+      IddObjectType::OS_Building,
+      IddObjectType::OS_BuildingStory,
+      IddObjectType::OS_SpaceType,
+      IddObjectType::OS_Space,
+      IddObjectType::OS_Surface,
+      IddObjectType::OS_SubSurface,
+      IddObjectType::OS_ShadingSurfaceGroup,
+      IddObjectType::OS_ShadingSurface,
+      IddObjectType::OS_InteriorPartitionSurfaceGroup,
+      IddObjectType::OS_InteriorPartitionSurface
+    };
+    if (constructionSearchTypes.find(type) != constructionSearchTypes.end()) {
+      object.get()->WorkspaceObject_Impl::onChange.connect<Model_Impl, &Model_Impl::clearCachedResolvedConstructions>(this);
+      clearCachedResolvedConstructions();
+    }
+
+    // objects that take part in resolving default schedules
+    static const std::set<IddObjectType> scheduleSearchTypes {
+      IddObjectType::OS_DefaultScheduleSet,
+      IddObjectType::OS_Building,
+      IddObjectType::OS_BuildingStory,
+      IddObjectType::OS_SpaceType,
+      IddObjectType::OS_Space
+    };
+    if (scheduleSearchTypes.find(type) != scheduleSearchTypes.end()) {
+      object.get()->WorkspaceObject_Impl::onChange.connect<Model_Impl, &Model_Impl::clearCachedResolvedDefaultSchedules>(this);
+      clearCachedResolvedDefaultSchedules();
+    }
+  }
+
+  void Model_Impl::mf_objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const openstudio::IddObjectType&, const openstudio::UUID&)
+  {
+    // removing any object may leave dangling ports, connections or pointers to constructions, be conservative
+    invalidateHVACTopology();
+    clearCachedResolvedConstructions();
+    clearCachedResolvedDefaultSchedules();
+  }
+
+  void Model_Impl::clearCachedResolvedConstructions()
+  {
+    m_cachedResolvedConstructions.clear();
+  }
+
+  boost::optional<std::pair<ConstructionBase, int> > Model_Impl::resolvedConstructionWithSearchDistance(const PlanarSurface& planarSurface) const
+  {
+    auto it = m_cachedResolvedConstructions.find(planarSurface.handle());
+    if (it != m_cachedResolvedConstructions.end()) {
+      return it->second;
+    }
+
+    boost::optional<std::pair<ConstructionBase, int> > result = planarSurface.getImpl<PlanarSurface_Impl>()->constructionWithSearchDistance();
+    m_cachedResolvedConstructions.emplace(planarSurface.handle(), result);
+    return result;
+  }
+
+  std::map<Handle, ConstructionBase> Model_Impl::resolvedConstructions() const
+  {
+    Model m = model();
+
+    // resolves one surface against a list of default construction sets, hard assigned constructions win
+    auto resolve = [this](const PlanarSurface& planarSurface, const std::vector<std::pair<DefaultConstructionSet, int> >& defaultConstructionSets) {
+      if (m_cachedResolvedConstructions.find(planarSurface.handle()) != m_cachedResolvedConstructions.end()) {
+        return;
+      }
+      boost::optional<std::pair<ConstructionBase, int> > result;
+      if (!planarSurface.isConstructionDefaulted()) {
+        result = planarSurface.getImpl<PlanarSurface_Impl>()->constructionWithSearchDistance();
+      } else {
+        for (const auto& defaultConstructionSet : defaultConstructionSets) {
+          if (boost::optional<ConstructionBase> construction = defaultConstructionSet.first.getDefaultConstruction(planarSurface)) {
+            result = std::make_pair(*construction, defaultConstructionSet.second);
+            break;
+          }
+        }
+      }
+      m_cachedResolvedConstructions.emplace(planarSurface.handle(), result);
+    };
+
+    for (const Space& space : m.getConcreteModelObjects<Space>()) {
+      // the search list only depends on the space, build it once for all its surfaces
+      std::vector<std::pair<DefaultConstructionSet, int> > defaultConstructionSets = space.getImpl<Space_Impl>()->defaultConstructionSetsWithSearchDistance();
+
+      for (const Surface& surface : space.surfaces()) {
+        resolve(surface, defaultConstructionSets);
+        for (const SubSurface& subSurface : surface.subSurfaces()) {
+          resolve(subSurface, defaultConstructionSets);
+        }
+      }
+      for (const ShadingSurfaceGroup& shadingSurfaceGroup : space.shadingSurfaceGroups()) {
+        for (const ShadingSurface& shadingSurface : shadingSurfaceGroup.shadingSurfaces()) {
+          resolve(shadingSurface, defaultConstructionSets);
+        }
+      }
+      for (const InteriorPartitionSurfaceGroup& interiorPartitionSurfaceGroup : space.interiorPartitionSurfaceGroups()) {
+        for (const InteriorPartitionSurface& interiorPartitionSurface : interiorPartitionSurfaceGroup.interiorPartitionSurfaces()) {
+          resolve(interiorPartitionSurface, defaultConstructionSets);
+        }
+      }
+    }
+
+    // site and building shading surfaces only search the building's default construction sets
+    std::vector<std::pair<DefaultConstructionSet, int> > buildingConstructionSets;
+    if (boost::optional<Building> building = this->building()) {
+      if (boost::optional<DefaultConstructionSet> defaultConstructionSet = building->defaultConstructionSet()) {
+        buildingConstructionSets.push_back(std::make_pair(*defaultConstructionSet, 4));
+      }
+      if (boost::optional<SpaceType> spaceType = building->spaceType()) {
+        if (boost::optional<DefaultConstructionSet> defaultConstructionSet = spaceType->defaultConstructionSet()) {
+          buildingConstructionSets.push_back(std::make_pair(*defaultConstructionSet, 5));
+        }
+      }
+    }
+    for (const ShadingSurfaceGroup& shadingSurfaceGroup : m.getConcreteModelObjects<ShadingSurfaceGroup>()) {
+      if (!shadingSurfaceGroup.space()) {
+        for (const ShadingSurface& shadingSurface : shadingSurfaceGroup.shadingSurfaces()) {
+          resolve(shadingSurface, buildingConstructionSets);
+        }
+      }
+    }
+
+    // construction() also reconciles matched surfaces, surfaces outside of any space fall back to the per surface search
+    std::map<Handle, ConstructionBase> result;
+    for (const PlanarSurface& planarSurface : m.getModelObjects<PlanarSurface>()) {
+      if (boost::optional<ConstructionBase> construction = planarSurface.construction()) {
+        result.insert(std::make_pair(planarSurface.handle(), *construction));
+      }
+    }
+
+    return result;
+  }
+
+  void Model_Impl::clearCachedResolvedDefaultSchedules()
+  {
+    m_cachedResolvedDefaultSchedules.clear();
+  }
+
+  Model_Impl::DefaultScheduleVector Model_Impl::resolveDefaultSchedules(const std::vector<DefaultScheduleSet>& defaultScheduleSets)
+  {
+    static const int maxValue = *DefaultScheduleType::getValues().rbegin();
+
+    DefaultScheduleVector result(maxValue + 1);
+    for (int value : DefaultScheduleType::getValues()) {
+      DefaultScheduleType defaultScheduleType(value);
+      for (const DefaultScheduleSet& defaultScheduleSet : defaultScheduleSets) {
+        if (boost::optional<Schedule> schedule = defaultScheduleSet.getDefaultSchedule(defaultScheduleType)) {
+          result[value] = schedule;
+          break;
+        }
+      }
+    }
+    return result;
+  }
+
+  boost::optional<Schedule> Model_Impl::resolvedDefaultSchedule(const Space& space, const DefaultScheduleType& defaultScheduleType) const
+  {
+    auto it = m_cachedResolvedDefaultSchedules.find(space.handle());
+    if (it == m_cachedResolvedDefaultSchedules.end()) {
+      it = m_cachedResolvedDefaultSchedules.emplace(space.handle(), resolveDefaultSchedules(space.getImpl<Space_Impl>()->defaultScheduleSets())).first;
+    }
+    return it->second[defaultScheduleType.value()];
+  }
+
+  boost::optional<Schedule> Model_Impl::resolvedDefaultSchedule(const SpaceType& spaceType, const DefaultScheduleType& defaultScheduleType) const
+  {
+    auto it = m_cachedResolvedDefaultSchedules.find(spaceType.handle());
+    if (it == m_cachedResolvedDefaultSchedules.end()) {
+      it = m_cachedResolvedDefaultSchedules.emplace(spaceType.handle(), resolveDefaultSchedules(spaceType.getImpl<SpaceType_Impl>()->defaultScheduleSets())).first;
+    }
+    return it->second[defaultScheduleType.value()];
+  }
+
+  namespace {
+
+    // the schedule fields of each SpaceLoad type and the DefaultScheduleType they fall back to when empty, as in
+    // Lights_Impl::schedule(), People_Impl::numberofPeopleSchedule() and so on
+    struct SpaceLoadScheduleField {
+      IddObjectType::domain iddObjectType;
+      unsigned fieldIndex;
+      DefaultScheduleType::domain defaultScheduleType;
+    };
+
+    const std::vector<SpaceLoadScheduleField>& spaceLoadScheduleFields()
+    {
+      static const std::vector<SpaceLoadScheduleField> result{
+        {IddObjectType::OS_ElectricEquipment, OS_ElectricEquipmentFields::ScheduleName, DefaultScheduleType::ElectricEquipmentSchedule},
+        {IddObjectType::OS_ElectricEquipment_ITE_AirCooled, OS_ElectricEquipment_ITE_AirCooledFields::DesignPowerInputScheduleName,
+         DefaultScheduleType::DesignPowerInputScheduleName},
+        {IddObjectType::OS_ElectricEquipment_ITE_AirCooled, OS_ElectricEquipment_ITE_AirCooledFields::CPULoadingScheduleName,
+         DefaultScheduleType::CPULoadingScheduleName},
+        {IddObjectType::OS_GasEquipment, OS_GasEquipmentFields::ScheduleName, DefaultScheduleType::GasEquipmentSchedule},
+        {IddObjectType::OS_HotWaterEquipment, OS_HotWaterEquipmentFields::ScheduleName, DefaultScheduleType::HotWaterEquipmentSchedule},
+        {IddObjectType::OS_Lights, OS_LightsFields::ScheduleName, DefaultScheduleType::LightingSchedule},
+        {IddObjectType::OS_Luminaire, OS_LuminaireFields::ScheduleName, DefaultScheduleType::LightingSchedule},
+        {IddObjectType::OS_OtherEquipment, OS_OtherEquipmentFields::ScheduleName, DefaultScheduleType::OtherEquipmentSchedule},
+        {IddObjectType::OS_People, OS_PeopleFields::NumberofPeopleScheduleName, DefaultScheduleType::NumberofPeopleSchedule},
+        {IddObjectType::OS_People, OS_PeopleFields::ActivityLevelScheduleName, DefaultScheduleType::PeopleActivityLevelSchedule},
+        {IddObjectType::OS_SpaceInfiltration_DesignFlowRate, OS_SpaceInfiltration_DesignFlowRateFields::ScheduleName,
+         DefaultScheduleType::InfiltrationSchedule},
+        {IddObjectType::OS_SpaceInfiltration_EffectiveLeakageArea, OS_SpaceInfiltration_EffectiveLeakageAreaFields::ScheduleName,
+         DefaultScheduleType::InfiltrationSchedule},
+        {IddObjectType::OS_SteamEquipment, OS_SteamEquipmentFields::ScheduleName, DefaultScheduleType::SteamEquipmentSchedule},
+      };
+      return result;
+    }
+
+  }
+
+  std::map<Handle, std::map<DefaultScheduleType, Schedule> > Model_Impl::resolvedDefaultSchedules() const
+  {
+    std::map<Handle, std::map<DefaultScheduleType, Schedule> > result;
+
+    for (const SpaceLoad& spaceLoad : model().getModelObjects<SpaceLoad>()) {
+      IddObjectType iddObjectType = spaceLoad.iddObjectType();
+      boost::optional<Space> space = spaceLoad.space();
+      boost::optional<SpaceType> spaceType = spaceLoad.spaceType();
+
+      std::map<DefaultScheduleType, Schedule> schedules;
+      bool hasScheduleFields = false;
+      for (const SpaceLoadScheduleField& field : spaceLoadScheduleFields()) {
+        if (field.iddObjectType != iddObjectType.value()) {
+          continue;
+        }
+        hasScheduleFields = true;
+
+        DefaultScheduleType defaultScheduleType(field.defaultScheduleType);
+        // the load's own schedule wins, then the space over the space type, as in the load's schedule getters
+        boost::optional<Schedule> schedule = spaceLoad.getModelObjectTarget<Schedule>(field.fieldIndex);
+        if (!schedule) {
+          if (space) {
+            schedule = resolvedDefaultSchedule(*space, defaultScheduleType);
+          } else if (spaceType) {
+            schedule = resolvedDefaultSchedule(*spaceType, defaultScheduleType);
+          }
+        }
+        if (schedule) {
+          schedules.insert(std::make_pair(defaultScheduleType, *schedule));
+        }
+      }
+
+      if (hasScheduleFields) {
+        result.insert(std::make_pair(spaceLoad.handle(), schedules));
+      }
+    }
+
+    return result;
+  }
+
+  FieldColumns Model_Impl::fieldColumns(IddObjectType iddObjectType, const std::vector<unsigned>& fieldIndices) const
+  {
+    return FieldColumns(iddObjectType, fieldIndices, getObjectsByType(iddObjectType));
+  }
+
+  bool Model_Impl::setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<double>& values)
+  {
+    if (handles.size() != values.size()) {
+      LOG(Error, "Cannot set field column, " << handles.size() << " handles but " << values.size() << " values.");
+      return false;
+    }
+    bool result = true;
+    for (unsigned i = 0, n = handles.size(); i < n; ++i) {
+      OptionalWorkspaceObject object = getObject(handles[i]);
+      if (!object) {
+        result = false;
+      } else if (std::isnan(values[i])) {
+        result = object->setString(fieldIndex, "") && result;
+      } else {
+        result = object->setDouble(fieldIndex, values[i]) && result;
+      }
+    }
+    return result;
+  }
+
+  bool Model_Impl::setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<std::string>& values)
+  {
+    if (handles.size() != values.size()) {
+      LOG(Error, "Cannot set field column, " << handles.size() << " handles but " << values.size() << " values.");
+      return false;
+    }
+    bool result = true;
+    for (unsigned i = 0, n = handles.size(); i < n; ++i) {
+      OptionalWorkspaceObject object = getObject(handles[i]);
+      if (!object) {
+        result = false;
+      } else {
+        result = object->setString(fieldIndex, values[i]) && result;
+      }
+    }
+    return result;
+  }
+
+  bool Model_Impl::setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<Handle>& targets)
+  {
+    if (handles.size() != targets.size()) {
+      LOG(Error, "Cannot set field column, " << handles.size() << " handles but " << targets.size() << " targets.");
+      return false;
+    }
+    bool result = true;
+    for (unsigned i = 0, n = handles.size(); i < n; ++i) {
+      OptionalWorkspaceObject object = getObject(handles[i]);
+      if (!object) {
+        result = false;
+      } else if (targets[i].isNull()) {
+        result = object->setString(fieldIndex, "") && result;
+      } else {
+        result = object->setPointer(fieldIndex, targets[i]) && result;
+      }
+    }
+    return result;
+  }
+
   void Model_Impl::autosize() {
     for (auto optModelObj : objects()) {
       if (auto modelObj = optModelObj.optionalCast<HVACComponent>()) { // HVACComponent
@@ -1447,6 +1885,10 @@ boost::optional<ComponentData> Model::insertComponent(const Component& component
   return getImpl<detail::Model_Impl>()->insertComponent(component);
 }
 
+std::vector<Handle> Model::unusedResourceObjectHandles() const {
+  return getImpl<detail::Model_Impl>()->unusedResourceObjectHandles();
+}
+
 std::vector<openstudio::IdfObject> Model::purgeUnusedResourceObjects() {
   return getImpl<detail::Model_Impl>()->purgeUnusedResourceObjects();
 }
@@ -1455,6 +1897,30 @@ std::vector<openstudio::IdfObject> Model::purgeUnusedResourceObjects(IddObjectTy
   return getImpl<detail::Model_Impl>()->purgeUnusedResourceObjects(iddObjectType);
 }
 
+std::map<Handle, ConstructionBase> Model::resolvedConstructions() const {
+  return getImpl<detail::Model_Impl>()->resolvedConstructions();
+}
+
+std::map<Handle, std::map<DefaultScheduleType, Schedule> > Model::resolvedDefaultSchedules() const {
+  return getImpl<detail::Model_Impl>()->resolvedDefaultSchedules();
+}
+
+FieldColumns Model::fieldColumns(IddObjectType iddObjectType, const std::vector<unsigned>& fieldIndices) const {
+  return getImpl<detail::Model_Impl>()->fieldColumns(iddObjectType, fieldIndices);
+}
+
+bool Model::setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<double>& values) {
+  return getImpl<detail::Model_Impl>()->setFieldColumn(handles, fieldIndex, values);
+}
+
+bool Model::setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<std::string>& values) {
+  return getImpl<detail::Model_Impl>()->setFieldColumn(handles, fieldIndex, values);
+}
+
+bool Model::setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<Handle>& targets) {
+  return getImpl<detail::Model_Impl>()->setFieldColumn(handles, fieldIndex, targets);
+}
+
 void Model::addVersionObject() {
   getUniqueModelObject<Version>();
 }
@@ -63,6 +63,9 @@ class FoundationKivaSettings;
 class OutputControlFiles;
 class OutputTableSummaryReports;
 class PerformancePrecisionTradeoffs;
+class ConstructionBase;
+class DefaultScheduleType;
+class FieldColumns;
 
 namespace detail {
   class Model_Impl;
@@ -431,9 +434,16 @@ class MODEL_API Model : public openstudio::Workspace {
   boost::optional<ComponentData> insertComponent(const Component& component);
 
   // DLM@20110614: should we have a template method for this?
-  /** Removes all \link ResourceObject ResourceObjects\endlink with
-   *  nonResourceObjectUseCount() == 0. All objects removed in the course of the purge
-   *  are returned to support undos. Note that ResourceObjects may have children that
+  /** Returns the handles of all \link ResourceObject ResourceObjects\endlink that cannot be
+   *  reached from a non-resource object, along with the objects they own. Nothing is removed;
+   *  this is the set that purgeUnusedResourceObjects() would remove. */
+  std::vector<Handle> unusedResourceObjectHandles() const;
+
+  /** Removes all \link ResourceObject ResourceObjects\endlink that cannot be reached from a
+   *  non-resource object by following pointers. Resources that are only used by other unused
+   *  resources are removed as well. Each object is removed through its own remove(), so that for
+   *  instance an ExternalFile deletes its file and its ScheduleFiles. All objects removed in the course
+   *  of the purge are returned to support undos. Note that ResourceObjects may have children that
    *  are not ResourceObjects, and these may be removed as well. */
   std::vector<openstudio::IdfObject> purgeUnusedResourceObjects();
 
@@ -443,6 +453,36 @@ class MODEL_API Model : public openstudio::Workspace {
    *  are not ResourceObjects, and these may be removed as well. */
   std::vector<openstudio::IdfObject> purgeUnusedResourceObjects(IddObjectType iddObjectType);
 
+  /** Returns the construction of every PlanarSurface that has one, keyed by surface handle. Default constructions
+   *  are resolved in one top down pass over building, stories, space types and spaces rather than one search
+   *  per surface, and results are cached so later calls to PlanarSurface::construction() are cheap. */
+  std::map<Handle, ConstructionBase> resolvedConstructions() const;
+
+  /** For each SpaceLoad with schedule fields, keyed by handle, returns the schedule the load uses for each of its
+   *  schedule fields, keyed by the DefaultScheduleType the field falls back to (for instance LightingSchedule for
+   *  Lights, NumberofPeopleSchedule and PeopleActivityLevelSchedule for People). A schedule assigned to the load
+   *  takes precedence; otherwise the DefaultScheduleSets of the load's space or space type, story, building and
+   *  building space type are searched, as the load's schedule getters do. Fields without a schedule are not
+   *  included. Each space and space type is searched only once and results are cached, so that later calls to
+   *  getDefaultSchedule are cheap. */
+  std::map<Handle, std::map<DefaultScheduleType, Schedule> > resolvedDefaultSchedules() const;
+
+  /** Returns fieldIndices of every object of iddObjectType in a single call, one contiguous array per field with
+   *  one row per object. Numeric values are NaN where a field is empty or autosized, strings are interned per
+   *  field, and pointer fields are also available as handles. See FieldColumns. */
+  FieldColumns fieldColumns(IddObjectType iddObjectType, const std::vector<unsigned>& fieldIndices) const;
+
+  /** Sets fieldIndex of each object in handles to the matching entry of values, NaN clearing the field. Returns
+   *  false if the sizes do not match, in which case nothing is set, or if any object is missing or rejects its
+   *  value; the remaining objects are still set. */
+  bool setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<double>& values);
+
+  /** Sets fieldIndex of each object in handles to the matching entry of values, empty strings clearing the field. */
+  bool setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<std::string>& values);
+
+  /** Points fieldIndex of each object in handles at the matching entry of targets, null handles clearing the field. */
+  bool setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<Handle>& targets);
+
   // DLM@20110614: Kyle can you fill in here?
   /// Connects the sourcePort on the source ModelObject to the targetPort on the target ModelObject.
   void connect(ModelObject sourceObject,
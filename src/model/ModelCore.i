@@ -115,6 +115,8 @@
   #include <utilities/geometry/ThreeJS.hpp>
 
   #include <utilities/units/Unit.hpp>
+
+  #include <model/FieldColumns.hpp>
 %}
 
 // templates for non-ModelObjects
@@ -167,6 +169,7 @@ class Construction;
 
 // include initial objects
 %include <model/ModelObject.hpp>
+%include <model/FieldColumns.hpp>
 %include <model/Model.hpp>
 %include <model/ModelExtensibleGroup.hpp>
 %include <model/Component.hpp>
@@ -40,6 +40,10 @@
 #include "YearDescription.hpp"
 #include "WeatherFile.hpp"
 #include "PerformancePrecisionTradeoffs.hpp"
+#include "ConstructionBase.hpp"
+#include "DefaultScheduleSet.hpp"
+#include "Schedule.hpp"
+#include "FieldColumns.hpp"
 
 #include "../nano/nano_signal_slot.hpp" // Signal-Slot replacement
 
@@ -50,7 +54,9 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 
 #include <boost/optional.hpp>
+#include <boost/functional/hash.hpp>
 
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -74,6 +80,8 @@ class ComponentData;
 class Schedule;
 class Node;
 class SpaceType;
+class PlanarSurface;
+class Space;
 
 namespace detail {
 
@@ -213,10 +221,50 @@ namespace detail {
 
     std::string plenumSpaceTypeName() const;
 
+    /** Returns a counter that is incremented every time the HVAC connection topology of the model may have
+     *  changed, i.e. when a Connection object is added, modified or removed, or any object is removed.
+     *  Loops use this to know when their cached component graphs must be rebuilt. */
+    unsigned hvacTopologyRevision() const;
+
+    /** Returns planarSurface's construction along with its search distance, as PlanarSurface::constructionWithSearchDistance.
+     *  Results are cached per surface until a DefaultConstructionSet, space, space type, story, building or surface
+     *  related object changes. */
+    boost::optional<std::pair<ConstructionBase, int> > resolvedConstructionWithSearchDistance(const PlanarSurface& planarSurface) const;
+
+    /** Resolves the construction of every planar surface in one top down pass over the building, caching results
+     *  for later construction() calls. Surfaces without a construction are not included. */
+    std::map<Handle, ConstructionBase> resolvedConstructions() const;
+
+    /** Returns the default schedule of the given type for space, as Space::getDefaultSchedule. All schedule types
+     *  of a space are resolved together and cached until a DefaultScheduleSet, space, space type, story or building
+     *  changes. */
+    boost::optional<Schedule> resolvedDefaultSchedule(const Space& space, const DefaultScheduleType& defaultScheduleType) const;
+
+    /** Returns the default schedule of the given type for spaceType, as SpaceType::getDefaultSchedule. */
+    boost::optional<Schedule> resolvedDefaultSchedule(const SpaceType& spaceType, const DefaultScheduleType& defaultScheduleType) const;
+
+    /** For each SpaceLoad with schedule fields, returns the schedule the load uses for each of them, keyed by the
+     *  DefaultScheduleType the field falls back to. The load's own schedule takes precedence over the default
+     *  found by searching upwards from its space or space type. Fields without a schedule are not included. */
+    std::map<Handle, std::map<DefaultScheduleType, Schedule> > resolvedDefaultSchedules() const;
+
+    /** Returns the given fields of all objects of iddObjectType as contiguous columns. */
+    FieldColumns fieldColumns(IddObjectType iddObjectType, const std::vector<unsigned>& fieldIndices) const;
+
     //@}
     /** @name Setters */
     //@{
 
+    /** Sets fieldIndex of each object in handles to the matching entry of values. NaN clears the field. Returns
+     *  false if the sizes do not match, in which case nothing is set, or if any object is missing or rejects its value. */
+    bool setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<double>& values);
+
+    /** Sets fieldIndex of each object in handles to the matching entry of values. Empty strings clear the field. */
+    bool setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<std::string>& values);
+
+    /** Points fieldIndex of each object in handles at the matching entry of targets. Null handles clear the field. */
+    bool setFieldColumn(const std::vector<Handle>& handles, unsigned fieldIndex, const std::vector<Handle>& targets);
+
     /** Override to return false. IddFileType is always equal to IddFileType::OpenStudio. */
     virtual bool setIddFile(IddFileType iddFileType);
 
@@ -248,9 +296,16 @@ namespace detail {
     /** Inserts Component into Model and returns the primary object, if possible. */
     virtual boost::optional<ComponentData> insertComponent(const Component& component);
 
-    /** Removes all \link ResourceObject ResourceObjects\endlink with
-     *  nonResourceObjectUseCount() == 0. All objects removed in the course of the purge
-     *  are returned to support undos. Note that ResourceObjects may have children that
+    /** Returns the handles of all \link ResourceObject ResourceObjects\endlink that cannot be
+     *  reached from a non-resource object, along with the objects they own. Nothing is removed;
+     *  this is the set that purgeUnusedResourceObjects() would remove. */
+    virtual std::vector<Handle> unusedResourceObjectHandles() const;
+
+    /** Removes all \link ResourceObject ResourceObjects\endlink that cannot be reached from a
+     *  non-resource object by following pointers. Resources that are only used by other unused
+     *  resources are removed as well. Each object is removed through its own remove(), so that for
+     *  instance an ExternalFile deletes its file and its ScheduleFiles. All objects removed in the course
+     *  of the purge are returned to support undos. Note that ResourceObjects may have children that
      *  are not ResourceObjects, and these may be removed as well. */
     virtual std::vector<openstudio::IdfObject> purgeUnusedResourceObjects();
 
@@ -321,6 +376,18 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    unsigned m_hvacTopologyRevision = 0;
+
+    typedef std::unordered_map<Handle, boost::optional<std::pair<ConstructionBase, int> >, boost::hash<boost::uuids::uuid> > ResolvedConstructionMap;
+    mutable ResolvedConstructionMap m_cachedResolvedConstructions;
+
+    // default schedules of a Space or SpaceType, indexed by DefaultScheduleType value
+    typedef std::vector<boost::optional<Schedule> > DefaultScheduleVector;
+    typedef std::unordered_map<Handle, DefaultScheduleVector, boost::hash<boost::uuids::uuid> > ResolvedDefaultScheduleMap;
+    mutable ResolvedDefaultScheduleMap m_cachedResolvedDefaultSchedules;
+
+    static DefaultScheduleVector resolveDefaultSchedules(const std::vector<DefaultScheduleSet>& defaultScheduleSets);
+
   // private slots:
     void clearCachedData();
     void clearCachedBuilding(const Handle& handle);
@@ -332,6 +399,11 @@ namespace detail {
     void clearCachedRunPeriod(const Handle& handle);
     void clearCachedYearDescription(const Handle& handle);
     void clearCachedWeatherFile(const Handle& handle);
+    void invalidateHVACTopology();
+    void clearCachedResolvedConstructions();
+    void clearCachedResolvedDefaultSchedules();
+    void mf_objectAdded(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const openstudio::IddObjectType& type, const openstudio::UUID& handle);
+    void mf_objectRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const openstudio::IddObjectType& type, const openstudio::UUID& handle);
 
     typedef std::function<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>(Model_Impl *, const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>&, bool)> CopyConstructorFunction;
     typedef std::map<IddObjectType, CopyConstructorFunction> CopyConstructorMap;
@@ -30,6 +30,7 @@
 #include "PlanarSurface.hpp"
 #include "PlanarSurface_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "PlanarSurfaceGroup.hpp"
 #include "Space.hpp"
@@ -117,7 +118,7 @@ namespace model {
 
     boost::optional<ConstructionBase> PlanarSurface_Impl::construction() const
     {
-      boost::optional<std::pair<ConstructionBase, int> > result = this->constructionWithSearchDistance();
+      boost::optional<std::pair<ConstructionBase, int> > result = this->cachedConstructionWithSearchDistance();
       if (result){
         return result->first;
       }
@@ -627,6 +628,11 @@ namespace model {
       return result;
     }
 
+    boost::optional<std::pair<ConstructionBase, int> > PlanarSurface_Impl::cachedConstructionWithSearchDistance() const
+    {
+      return this->model().getImpl<Model_Impl>()->resolvedConstructionWithSearchDistance(getObject<PlanarSurface>());
+    }
+
     void PlanarSurface_Impl::clearCachedVariables()
     {
       m_cachedVertices.reset();
@@ -675,7 +681,7 @@ boost::optional<ConstructionBase> PlanarSurface::construction() const
 
 boost::optional<std::pair<ConstructionBase, int> > PlanarSurface::constructionWithSearchDistance() const
 {
-  return getImpl<detail::PlanarSurface_Impl>()->constructionWithSearchDistance();
+  return getImpl<detail::PlanarSurface_Impl>()->cachedConstructionWithSearchDistance();
 }
 
 bool PlanarSurface::isConstructionDefaulted() const
@@ -108,6 +108,9 @@ namespace detail {
 
     virtual boost::optional<std::pair<ConstructionBase, int> > constructionWithSearchDistance() const = 0;
 
+    /// Returns constructionWithSearchDistance() through the model's resolved construction cache.
+    boost::optional<std::pair<ConstructionBase, int> > cachedConstructionWithSearchDistance() const;
+
     virtual bool isConstructionDefaulted() const = 0;
 
     virtual boost::optional<PlanarSurfaceGroup> planarSurfaceGroup() const = 0;
@@ -233,6 +233,15 @@ namespace detail {
     return csvFile;
   }
 
+  std::vector<double> ScheduleFile_Impl::values() const {
+    int columnNumber = this->columnNumber();
+    char separator = columnSeparatorChar();
+    if ((columnNumber < 1) || (separator == '\0')) {
+      return std::vector<double>();
+    }
+    return CSVFile::readColumnAsDoubleVector(externalFile().filePath(), columnNumber - 1, rowstoSkipatTop(), separator);
+  }
+
   /* FIXME!
   openstudio::TimeSeries ScheduleFile_Impl::timeSeries(unsigned columnIndex) const
   { 
@@ -455,6 +464,10 @@ boost::optional<CSVFile> ScheduleFile::csvFile() const {
   return getImpl<detail::ScheduleFile_Impl>()->csvFile();
 }
 
+std::vector<double> ScheduleFile::values() const {
+  return getImpl<detail::ScheduleFile_Impl>()->values();
+}
+
 /* FIXME!
 openstudio::TimeSeries ScheduleFile::timeSeries(unsigned columnIndex) const {
   return getImpl<detail::ScheduleFile_Impl>()->timeSeries(columnIndex);
@@ -96,6 +96,11 @@ class MODEL_API ScheduleFile : public ScheduleInterval {
 
   boost::optional<CSVFile> csvFile() const;
 
+  /** Returns the values in columnNumber() of the external file below the first rowstoSkipatTop() rows. Only that
+   *  column is read, and results are reused until the file changes. Empty vector is returned if the file cannot be
+   *  read or any value is not numeric. */
+  std::vector<double> values() const;
+
   //@}
   /** @name Setters */
   //@{
@@ -115,6 +115,8 @@ namespace detail {
     
     boost::optional<CSVFile> csvFile() const;
 
+    virtual std::vector<double> values() const override;
+
     //@}
     /** @name Setters */
     //@{
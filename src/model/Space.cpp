@@ -554,7 +554,19 @@ namespace detail {
 
   boost::optional<std::pair<ConstructionBase, int> > Space_Impl::getDefaultConstructionWithSearchDistance(const PlanarSurface& planarSurface) const
   {
-    boost::optional<ConstructionBase> result;
+    for (const auto& defaultConstructionSet : this->defaultConstructionSetsWithSearchDistance()){
+      boost::optional<ConstructionBase> result = defaultConstructionSet.first.getDefaultConstruction(planarSurface);
+      if (result){
+        return std::make_pair(*result, defaultConstructionSet.second);
+      }
+    }
+
+    return boost::none;
+  }
+
+  std::vector<std::pair<DefaultConstructionSet, int> > Space_Impl::defaultConstructionSetsWithSearchDistance() const
+  {
+    std::vector<std::pair<DefaultConstructionSet, int> > result;
     boost::optional<DefaultConstructionSet> defaultConstructionSet;
     boost::optional<SpaceType> spaceType;
     boost::optional<BuildingStory> buildingStory;
@@ -563,10 +575,7 @@ namespace detail {
     // first check this object
     defaultConstructionSet = this->defaultConstructionSet();
     if (defaultConstructionSet){
-      result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-      if (result){
-        return std::make_pair(*result, 1);
-      }
+      result.push_back(std::make_pair(*defaultConstructionSet, 1));
     }
 
     // then check space type
@@ -574,10 +583,7 @@ namespace detail {
     if (spaceType && !this->isSpaceTypeDefaulted()){
       defaultConstructionSet = spaceType->defaultConstructionSet();
       if (defaultConstructionSet){
-        result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-        if (result){
-          return std::make_pair(*result, 2);
-        }
+        result.push_back(std::make_pair(*defaultConstructionSet, 2));
       }
     }
 
@@ -586,10 +592,7 @@ namespace detail {
     if (buildingStory){
       defaultConstructionSet = buildingStory->defaultConstructionSet();
       if (defaultConstructionSet){
-        result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-        if (result){
-          return std::make_pair(*result, 3);
-        }
+        result.push_back(std::make_pair(*defaultConstructionSet, 3));
       }
     }
 
@@ -598,10 +601,7 @@ namespace detail {
     if (building){
       defaultConstructionSet = building->defaultConstructionSet();
       if (defaultConstructionSet){
-        result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-        if (result){
-          return std::make_pair(*result, 4);
-        }
+        result.push_back(std::make_pair(*defaultConstructionSet, 4));
       }
 
       // then check building's space type
@@ -609,15 +609,12 @@ namespace detail {
       if (spaceType){
         defaultConstructionSet = spaceType->defaultConstructionSet();
         if (defaultConstructionSet){
-          result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-          if (result){
-            return std::make_pair(*result, 5);
-          }
+          result.push_back(std::make_pair(*defaultConstructionSet, 5));
         }
       }
     }
 
-    return boost::none;
+    return result;
   }
 
   bool Space_Impl::setDefaultConstructionSet(const DefaultConstructionSet& defaultConstructionSet)
@@ -637,7 +634,12 @@ namespace detail {
 
   boost::optional<Schedule> Space_Impl::getDefaultSchedule(const DefaultScheduleType& defaultScheduleType) const
   {
-    boost::optional<Schedule> result;
+    return this->model().getImpl<Model_Impl>()->resolvedDefaultSchedule(getObject<Space>(), defaultScheduleType);
+  }
+
+  std::vector<DefaultScheduleSet> Space_Impl::defaultScheduleSets() const
+  {
+    std::vector<DefaultScheduleSet> result;
     boost::optional<DefaultScheduleSet> defaultScheduleSet;
     boost::optional<SpaceType> spaceType;
     boost::optional<BuildingStory> buildingStory;
@@ -646,10 +648,7 @@ namespace detail {
     // first check this object
     defaultScheduleSet = this->defaultScheduleSet();
     if (defaultScheduleSet){
-      result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-      if (result){
-        return result;
-      }
+      result.push_back(*defaultScheduleSet);
     }
 
     // then check space type
@@ -657,10 +656,7 @@ namespace detail {
     if (spaceType){
       defaultScheduleSet = spaceType->defaultScheduleSet();
       if (defaultScheduleSet){
-        result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-        if (result){
-          return result;
-        }
+        result.push_back(*defaultScheduleSet);
       }
     }
 
@@ -669,10 +665,7 @@ namespace detail {
     if (buildingStory){
       defaultScheduleSet = buildingStory->defaultScheduleSet();
       if (defaultScheduleSet){
-        result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-        if (result){
-          return result;
-        }
+        result.push_back(*defaultScheduleSet);
       }
     }
 
@@ -681,10 +674,7 @@ namespace detail {
     if (building){
       defaultScheduleSet = building->defaultScheduleSet();
       if (defaultScheduleSet){
-        result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-        if (result){
-          return result;
-        }
+        result.push_back(*defaultScheduleSet);
       }
 
       // then check building's space type
@@ -692,15 +682,12 @@ namespace detail {
       if (spaceType){
         defaultScheduleSet = spaceType->defaultScheduleSet();
         if (defaultScheduleSet){
-          result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-          if (result){
-            return result;
-          }
+          result.push_back(*defaultScheduleSet);
         }
       }
     }
 
-    return boost::none;
+    return result;
   }
 
   bool Space_Impl::setDefaultScheduleSet(const DefaultScheduleSet& defaultScheduleSet)
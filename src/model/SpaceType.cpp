@@ -247,7 +247,12 @@ namespace detail {
 
   boost::optional<Schedule> SpaceType_Impl::getDefaultSchedule(const DefaultScheduleType& defaultScheduleType) const
   {
-    boost::optional<Schedule> result;
+    return this->model().getImpl<Model_Impl>()->resolvedDefaultSchedule(getObject<SpaceType>(), defaultScheduleType);
+  }
+
+  std::vector<DefaultScheduleSet> SpaceType_Impl::defaultScheduleSets() const
+  {
+    std::vector<DefaultScheduleSet> result;
     boost::optional<DefaultScheduleSet> defaultScheduleSet;
     boost::optional<Building> building;
     boost::optional<SpaceType> spaceType;
@@ -255,10 +260,7 @@ namespace detail {
     // first check this object
     defaultScheduleSet = this->defaultScheduleSet();
     if (defaultScheduleSet){
-      result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-      if (result){
-        return result;
-      }
+      result.push_back(*defaultScheduleSet);
     }
 
     // then check building
@@ -266,10 +268,7 @@ namespace detail {
     if (building){
       defaultScheduleSet = building->defaultScheduleSet();
       if (defaultScheduleSet){
-        result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-        if (result){
-          return result;
-        }
+        result.push_back(*defaultScheduleSet);
       }
 
       // then check building's space type
@@ -277,15 +276,12 @@ namespace detail {
       if (spaceType){
         defaultScheduleSet = spaceType->defaultScheduleSet();
         if (defaultScheduleSet){
-          result = defaultScheduleSet->getDefaultSchedule(defaultScheduleType);
-          if (result){
-            return result;
-          }
+          result.push_back(*defaultScheduleSet);
         }
       }
     }
 
-    return boost::none;
+    return result;
   }
 
   bool SpaceType_Impl::setDefaultScheduleSet(const DefaultScheduleSet& defaultScheduleSet)
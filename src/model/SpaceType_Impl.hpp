@@ -160,8 +160,12 @@ namespace detail {
     /// This space types's default schedule set
     /// The building's default schedule set
     /// The building's space type's default schedule set
+    /// Results are served from the model's resolved default schedule cache.
     boost::optional<Schedule> getDefaultSchedule(const DefaultScheduleType& defaultScheduleType) const;
 
+    /// Returns the default schedule sets searched by getDefaultSchedule, in search order.
+    std::vector<DefaultScheduleSet> defaultScheduleSets() const;
+
     /// Returns all InternalMass in this space type.
     std::vector<InternalMass> internalMass() const;
 
@@ -191,6 +191,10 @@ namespace detail {
     boost::optional<ConstructionBase> getDefaultConstruction(const PlanarSurface& planarSurface) const;
     boost::optional<std::pair<ConstructionBase, int> > getDefaultConstructionWithSearchDistance(const PlanarSurface& planarSurface) const;
 
+    /// Returns the default construction sets searched by getDefaultConstructionWithSearchDistance, in search order,
+    /// along with their search distance. Useful to resolve many surfaces of this space at once.
+    std::vector<std::pair<DefaultConstructionSet, int> > defaultConstructionSetsWithSearchDistance() const;
+
     /// Sets the default construction set for this space directly.
     bool setDefaultConstructionSet(const DefaultConstructionSet& defaultConstructionSet);
 
@@ -206,8 +210,12 @@ namespace detail {
     /// This space's building story's default schedule set
     /// This space's building's default schedule set
     /// This space's building's space type's default schedule set
+    /// Results are served from the model's resolved default schedule cache.
     boost::optional<Schedule> getDefaultSchedule(const DefaultScheduleType& defaultScheduleType) const;
 
+    /// Returns the default schedule sets searched by getDefaultSchedule, in search order.
+    std::vector<DefaultScheduleSet> defaultScheduleSets() const;
+
     /// Sets the default schedule set.
     bool setDefaultScheduleSet(const DefaultScheduleSet& defaultScheduleSet);
 
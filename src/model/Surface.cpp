@@ -230,7 +230,7 @@ namespace detail {
     // DLM: I am not sure we should be doing this here at all, maybe this method should just
     // return the same thing constructionWithSearchDistance does?
 
-    boost::optional<std::pair<ConstructionBase, int> > constructionWithSearchDistance = this->constructionWithSearchDistance();
+    boost::optional<std::pair<ConstructionBase, int> > constructionWithSearchDistance = this->cachedConstructionWithSearchDistance();
 
     model::OptionalSurface adjacentSurface = this->adjacentSurface();
     if (!adjacentSurface){
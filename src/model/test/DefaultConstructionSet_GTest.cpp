@@ -49,6 +49,7 @@
 #include "../ShadingSurface.hpp"
 #include "../ShadingSurfaceGroup.hpp"
 #include "../Space.hpp"
+#include "../Building.hpp"
 
 #include "../../utilities/geometry/Point3d.hpp"
 
@@ -591,3 +592,64 @@ TEST_F(ModelFixture, DefaultConstructionSet_CloneBadName)
   clone = defaultSurfaceConstructions.clone(model);
   EXPECT_EQ("*H.a.r.d.e.s.t*^\\1|-|8/_#($name$)?# 2", clone.name().get());
 }
+
+TEST_F(ModelFixture, DefaultConstructionSet_ResolvedConstructionCache)
+{
+  Model model;
+
+  Point3dVector points;
+  points.push_back(Point3d(0,1,0));
+  points.push_back(Point3d(0,0,0));
+  points.push_back(Point3d(1,0,0));
+
+  Space space(model);
+  Surface surface(points, model);
+  EXPECT_TRUE(surface.setSpace(space));
+  EXPECT_TRUE(surface.setSurfaceType("Wall"));
+  EXPECT_TRUE(surface.setOutsideBoundaryCondition("Outdoors"));
+
+  Construction wallConstruction(model);
+  Construction floorConstruction(model);
+  DefaultConstructionSet defaultConstructionSet(model);
+  DefaultSurfaceConstructions defaultSurfaceConstructions(model);
+  EXPECT_TRUE(defaultSurfaceConstructions.setWallConstruction(wallConstruction));
+  EXPECT_TRUE(defaultConstructionSet.setDefaultExteriorSurfaceConstructions(defaultSurfaceConstructions));
+
+  EXPECT_FALSE(surface.construction());
+  EXPECT_TRUE(model.resolvedConstructions().empty());
+
+  // assigning the set to the building invalidates the cache
+  EXPECT_TRUE(model.getUniqueModelObject<Building>().setDefaultConstructionSet(defaultConstructionSet));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(wallConstruction.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(4, surface.constructionWithSearchDistance()->second);
+
+  // assigning it to the space shortens the search
+  EXPECT_TRUE(space.setDefaultConstructionSet(defaultConstructionSet));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(1, surface.constructionWithSearchDistance()->second);
+
+  // surface type changes are picked up
+  EXPECT_TRUE(surface.setSurfaceType("Floor"));
+  EXPECT_FALSE(surface.construction());
+  EXPECT_TRUE(defaultSurfaceConstructions.setFloorConstruction(floorConstruction));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(floorConstruction.handle(), surface.construction()->handle());
+
+  // bulk resolution agrees with the per surface search
+  std::map<Handle, ConstructionBase> resolved = model.resolvedConstructions();
+  ASSERT_EQ(1u, resolved.size());
+  ASSERT_TRUE(resolved.find(surface.handle()) != resolved.end());
+  EXPECT_EQ(floorConstruction.handle(), resolved.find(surface.handle())->second.handle());
+
+  // removing the set clears everything
+  defaultConstructionSet.remove();
+  EXPECT_FALSE(surface.construction());
+  EXPECT_TRUE(model.resolvedConstructions().empty());
+
+  // hard assigned constructions always win
+  EXPECT_TRUE(surface.setConstruction(wallConstruction));
+  resolved = model.resolvedConstructions();
+  ASSERT_EQ(1u, resolved.size());
+  EXPECT_EQ(wallConstruction.handle(), resolved.find(surface.handle())->second.handle());
+}
@@ -39,6 +39,11 @@
 #include "../ScheduleConstant_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
 #include "../ScheduleCompact.hpp"
+#include "../Building.hpp"
+#include "../Space.hpp"
+#include "../SpaceType.hpp"
+#include "../Lights.hpp"
+#include "../LightsDefinition.hpp"
 
 #include <utilities/idd/OS_DefaultScheduleSet_FieldEnums.hxx>
 
@@ -173,3 +178,81 @@ TEST_F(ModelFixture, DefaultScheduleSet_ScheduleTypes) {
   EXPECT_TRUE(scheduleSet.setPointer(OS_DefaultScheduleSetFields::HoursofOperationScheduleName,alwaysOn.handle()));
   EXPECT_TRUE(scheduleSet.hoursofOperationSchedule());
 }
+
+TEST_F(ModelFixture, DefaultScheduleSet_ResolvedDefaultSchedules) {
+  Model model;
+
+  Space space(model);
+  SpaceType spaceType(model);
+  LightsDefinition definition(model);
+  Lights spaceLights(definition);
+  Lights spaceTypeLights(definition);
+  EXPECT_TRUE(spaceLights.setSpace(space));
+  EXPECT_TRUE(spaceTypeLights.setSpaceType(spaceType));
+
+  ScheduleConstant buildingSchedule(model);
+  ScheduleConstant spaceSchedule(model);
+  DefaultScheduleSet buildingSet(model);
+  DefaultScheduleSet spaceSet(model);
+  EXPECT_TRUE(buildingSet.setLightingSchedule(buildingSchedule));
+  EXPECT_TRUE(spaceSet.setLightingSchedule(spaceSchedule));
+
+  EXPECT_FALSE(spaceLights.schedule());
+  EXPECT_FALSE(spaceTypeLights.schedule());
+
+  // cache is invalidated when the building points to a new set
+  EXPECT_TRUE(model.getUniqueModelObject<Building>().setDefaultScheduleSet(buildingSet));
+  ASSERT_TRUE(spaceLights.schedule());
+  EXPECT_EQ(buildingSchedule.handle(), spaceLights.schedule()->handle());
+  ASSERT_TRUE(spaceTypeLights.schedule());
+  EXPECT_EQ(buildingSchedule.handle(), spaceTypeLights.schedule()->handle());
+
+  // and when the space does
+  EXPECT_TRUE(space.setDefaultScheduleSet(spaceSet));
+  ASSERT_TRUE(spaceLights.schedule());
+  EXPECT_EQ(spaceSchedule.handle(), spaceLights.schedule()->handle());
+  ASSERT_TRUE(spaceTypeLights.schedule());
+  EXPECT_EQ(buildingSchedule.handle(), spaceTypeLights.schedule()->handle());
+
+  // and when a set itself changes
+  buildingSet.resetLightingSchedule();
+  EXPECT_FALSE(spaceTypeLights.schedule());
+  EXPECT_TRUE(buildingSet.setLightingSchedule(buildingSchedule));
+  ScheduleConstant hoursSchedule(model);
+  EXPECT_TRUE(buildingSet.setHoursofOperationSchedule(hoursSchedule));
+
+  std::map<Handle, std::map<DefaultScheduleType, Schedule> > resolved = model.resolvedDefaultSchedules();
+  ASSERT_EQ(2u, resolved.size());
+
+  // only the types that apply to lights, hours of operation is not one of them
+  ASSERT_TRUE(resolved.find(spaceLights.handle()) != resolved.end());
+  std::map<DefaultScheduleType, Schedule> schedules = resolved.find(spaceLights.handle())->second;
+  ASSERT_EQ(1u, schedules.size());
+  ASSERT_TRUE(schedules.find(DefaultScheduleType::LightingSchedule) != schedules.end());
+  EXPECT_EQ(spaceSchedule.handle(), schedules.find(DefaultScheduleType::LightingSchedule)->second.handle());
+  EXPECT_TRUE(schedules.find(DefaultScheduleType::HoursofOperationSchedule) == schedules.end());
+
+  ASSERT_TRUE(resolved.find(spaceTypeLights.handle()) != resolved.end());
+  schedules = resolved.find(spaceTypeLights.handle())->second;
+  ASSERT_EQ(1u, schedules.size());
+  ASSERT_TRUE(schedules.find(DefaultScheduleType::LightingSchedule) != schedules.end());
+  EXPECT_EQ(buildingSchedule.handle(), schedules.find(DefaultScheduleType::LightingSchedule)->second.handle());
+
+  // a schedule assigned to the load takes precedence over the defaults, as in Lights::schedule
+  ScheduleConstant hardSchedule(model);
+  EXPECT_TRUE(spaceLights.setSchedule(hardSchedule));
+  resolved = model.resolvedDefaultSchedules();
+  ASSERT_TRUE(resolved.find(spaceLights.handle()) != resolved.end());
+  schedules = resolved.find(spaceLights.handle())->second;
+  ASSERT_EQ(1u, schedules.size());
+  ASSERT_TRUE(schedules.find(DefaultScheduleType::LightingSchedule) != schedules.end());
+  EXPECT_EQ(hardSchedule.handle(), schedules.find(DefaultScheduleType::LightingSchedule)->second.handle());
+  ASSERT_TRUE(spaceLights.schedule());
+  EXPECT_EQ(spaceLights.schedule()->handle(), schedules.find(DefaultScheduleType::LightingSchedule)->second.handle());
+  spaceLights.resetSchedule();
+
+  // removing a set clears the cache
+  spaceSet.remove();
+  ASSERT_TRUE(spaceLights.schedule());
+  EXPECT_EQ(buildingSchedule.handle(), spaceLights.schedule()->handle());
+}
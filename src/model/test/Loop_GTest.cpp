@@ -120,3 +120,37 @@ TEST_F(ModelFixture,Loop_DeleteUnitaryVAVChangeoverBypassAirLoopHVAC)
   EXPECT_EQ(3, inletComponents.size());
 
 }
+
+TEST_F(ModelFixture,Loop_CachedTopology)
+{
+  Model model = Model();
+
+  AirLoopHVAC airLoopHVAC(model);
+  Node supplyOutletNode = airLoopHVAC.supplyOutletNode();
+
+  std::vector<ModelObject> supplyComponents = airLoopHVAC.supplyComponents();
+  EXPECT_EQ(2u, supplyComponents.size());
+  EXPECT_TRUE(airLoopHVAC.supplyComponent(supplyOutletNode.handle()));
+
+  // Adding a component changes connections, the cached graph must be rebuilt
+  Schedule s = model.alwaysOnDiscreteSchedule();
+  FanConstantVolume fan(model, s);
+  EXPECT_FALSE(airLoopHVAC.supplyComponent(fan.handle()));
+  EXPECT_TRUE(fan.addToNode(supplyOutletNode));
+  EXPECT_TRUE(airLoopHVAC.supplyComponent(fan.handle()));
+  EXPECT_TRUE(airLoopHVAC.component(fan.handle()));
+  EXPECT_FALSE(airLoopHVAC.demandComponent(fan.handle()));
+  EXPECT_EQ(4u, airLoopHVAC.supplyComponents().size());
+  EXPECT_EQ(1u, airLoopHVAC.supplyComponents(FanConstantVolume::iddObjectType()).size());
+  EXPECT_EQ(3u, airLoopHVAC.supplyComponents(Node::iddObjectType()).size());
+  EXPECT_EQ(0u, airLoopHVAC.supplyComponents(CoilHeatingElectric::iddObjectType()).size());
+
+  // Repeated calls return the same, ordered result
+  EXPECT_EQ(airLoopHVAC.supplyComponents(), airLoopHVAC.supplyComponents());
+
+  // Removing a component invalidates the cache too
+  fan.remove();
+  EXPECT_FALSE(airLoopHVAC.supplyComponent(fan.handle()));
+  EXPECT_EQ(2u, airLoopHVAC.supplyComponents().size());
+  EXPECT_EQ(0u, airLoopHVAC.supplyComponents(FanConstantVolume::iddObjectType()).size());
+}
@@ -74,6 +74,7 @@
 #include "../FanConstantVolume_Impl.hpp"
 #include "../AirLoopHVAC.hpp"
 #include "../AirLoopHVAC_Impl.hpp"
+#include "../FieldColumns.hpp"
 
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/data/TimeSeries.hpp"
@@ -83,9 +84,13 @@
 #include "../../utilities/idf/ValidityReport.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/OS_Lights_FieldEnums.hxx>
+#include <utilities/idd/OS_Lights_Definition_FieldEnums.hxx>
 
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <cmath>
+
 using namespace openstudio::model;
 using namespace openstudio;
 /*
@@ -764,3 +769,74 @@ TEST_F(ModelFixture,Model_BadSwaps) {
   EXPECT_ANY_THROW(workspace.swap(model));
   EXPECT_ANY_THROW(model.swap(workspace));
 }
+
+TEST_F(ModelFixture, Model_FieldColumns) {
+  Model model;
+
+  LightsDefinition definition1(model);
+  EXPECT_TRUE(definition1.setLightingLevel(100.0));
+  LightsDefinition definition2(model);
+  EXPECT_TRUE(definition2.setLightingLevel(200.0));
+  LightsDefinition definition3(model);
+  EXPECT_TRUE(definition3.setWattsperSpaceFloorArea(10.0));
+
+  std::vector<unsigned> fieldIndices;
+  fieldIndices.push_back(OS_Lights_DefinitionFields::LightingLevel);
+  fieldIndices.push_back(OS_Lights_DefinitionFields::DesignLevelCalculationMethod);
+  FieldColumns columns = model.fieldColumns(IddObjectType::OS_Lights_Definition, fieldIndices);
+  EXPECT_EQ(IddObjectType(IddObjectType::OS_Lights_Definition), columns.iddObjectType());
+  EXPECT_EQ(fieldIndices, columns.fieldIndices());
+  ASSERT_EQ(3u, columns.numRows());
+  EXPECT_ANY_THROW(columns.doubleColumn(OS_Lights_DefinitionFields::FractionRadiant));
+
+  std::vector<Handle> handles = columns.handles();
+  std::vector<double> levels = columns.doubleColumn(OS_Lights_DefinitionFields::LightingLevel);
+  std::vector<std::string> methods = columns.stringColumn(OS_Lights_DefinitionFields::DesignLevelCalculationMethod);
+  ASSERT_EQ(3u, levels.size());
+  ASSERT_EQ(3u, methods.size());
+  EXPECT_EQ(2u, columns.stringTable(OS_Lights_DefinitionFields::DesignLevelCalculationMethod).size());
+  for (unsigned i = 0; i < 3; ++i) {
+    if (handles[i] == definition1.handle()) {
+      EXPECT_DOUBLE_EQ(100.0, levels[i]);
+      EXPECT_EQ("LightingLevel", methods[i]);
+    } else if (handles[i] == definition2.handle()) {
+      EXPECT_DOUBLE_EQ(200.0, levels[i]);
+      EXPECT_EQ("LightingLevel", methods[i]);
+    } else {
+      EXPECT_EQ(definition3.handle(), handles[i]);
+      EXPECT_TRUE(std::isnan(levels[i]));
+      EXPECT_EQ("Watts/Area", methods[i]);
+      EXPECT_EQ(-1, columns.stringIndexColumn(OS_Lights_DefinitionFields::LightingLevel)[i]);
+    }
+  }
+
+  // pointer fields are also available as handles
+  Lights lights1(definition1);
+  Lights lights2(definition2);
+  fieldIndices = std::vector<unsigned>(1u, OS_LightsFields::LightsDefinitionName);
+  FieldColumns lightsColumns = model.fieldColumns(IddObjectType::OS_Lights, fieldIndices);
+  ASSERT_EQ(2u, lightsColumns.numRows());
+  std::vector<Handle> lightsHandles = lightsColumns.handles();
+  std::vector<Handle> definitionHandles = lightsColumns.handleColumn(OS_LightsFields::LightsDefinitionName);
+  for (unsigned i = 0; i < 2; ++i) {
+    EXPECT_EQ(model.getModelObject<Lights>(lightsHandles[i])->definition().handle(), definitionHandles[i]);
+  }
+
+  // bulk setters
+  for (double& level : levels) {
+    level *= 2.0;
+  }
+  EXPECT_TRUE(model.setFieldColumn(handles, OS_Lights_DefinitionFields::LightingLevel, levels));
+  ASSERT_TRUE(definition1.lightingLevel());
+  EXPECT_DOUBLE_EQ(200.0, definition1.lightingLevel().get());
+  ASSERT_TRUE(definition2.lightingLevel());
+  EXPECT_DOUBLE_EQ(400.0, definition2.lightingLevel().get());
+  EXPECT_FALSE(definition3.lightingLevel());
+  EXPECT_FALSE(model.setFieldColumn(handles, OS_Lights_DefinitionFields::LightingLevel, std::vector<double>(2u, 1.0)));
+
+  std::swap(definitionHandles[0], definitionHandles[1]);
+  EXPECT_TRUE(model.setFieldColumn(lightsHandles, OS_LightsFields::LightsDefinitionName, definitionHandles));
+  for (unsigned i = 0; i < 2; ++i) {
+    EXPECT_EQ(definitionHandles[i], model.getModelObject<Lights>(lightsHandles[i])->definition().handle());
+  }
+}
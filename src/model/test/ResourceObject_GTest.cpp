@@ -40,6 +40,16 @@
 #include "../StandardsInformationConstruction_Impl.hpp"
 #include "../StandardOpaqueMaterial.hpp"
 #include "../StandardOpaqueMaterial_Impl.hpp"
+#include "../Lights.hpp"
+#include "../Lights_Impl.hpp"
+#include "../LightsDefinition.hpp"
+#include "../LightsDefinition_Impl.hpp"
+#include "../ScheduleConstant.hpp"
+#include "../ScheduleConstant_Impl.hpp"
+#include "../ExternalFile.hpp"
+#include "../ExternalFile_Impl.hpp"
+#include "../ScheduleFile.hpp"
+#include "../ScheduleFile_Impl.hpp"
 
 #include "../../utilities/core/Optional.hpp"
 
@@ -134,3 +144,74 @@ TEST_F(ModelFixture,ResourceObject_Clone) {
   EXPECT_EQ("Material with Changed Data",newConstruction.layers()[0].name().get());
   EXPECT_EQ("Material 1",anotherNewConstruction.layers()[0].name().get());
 }
+
+TEST_F(ModelFixture,ResourceObject_PurgeUnusedResourceObjects) {
+  Model model;
+
+  // construction -> material chain with no non-resource users
+  Construction construction(model);
+  StandardsInformationConstruction info = construction.standardsInformation();
+  StandardOpaqueMaterial material(model);
+  EXPECT_TRUE(construction.setLayers(MaterialVector(1u,material)));
+
+  // definition and schedule reached from a non-resource object
+  LightsDefinition definition(model);
+  Lights lights(definition);
+  ScheduleConstant schedule(model);
+  EXPECT_TRUE(lights.setSchedule(schedule));
+
+  // dry run reports the whole unused chain, including owned children, but removes nothing
+  unsigned numObjects = model.numObjects();
+  std::vector<Handle> handles = model.unusedResourceObjectHandles();
+  EXPECT_EQ(numObjects, model.numObjects());
+  ASSERT_EQ(3u, handles.size());
+  EXPECT_NE(handles.end(), std::find(handles.begin(), handles.end(), construction.handle()));
+  EXPECT_NE(handles.end(), std::find(handles.begin(), handles.end(), info.handle()));
+  EXPECT_NE(handles.end(), std::find(handles.begin(), handles.end(), material.handle()));
+
+  // a single purge removes the chain
+  IdfObjectVector removed = model.purgeUnusedResourceObjects();
+  EXPECT_EQ(3u, removed.size());
+  EXPECT_EQ(numObjects - 3u, model.numObjects());
+  EXPECT_FALSE(model.getModelObject<Construction>(construction.handle()));
+  EXPECT_FALSE(model.getModelObject<StandardOpaqueMaterial>(material.handle()));
+  EXPECT_TRUE(model.getModelObject<LightsDefinition>(definition.handle()));
+  EXPECT_TRUE(model.getModelObject<ScheduleConstant>(schedule.handle()));
+  EXPECT_TRUE(model.unusedResourceObjectHandles().empty());
+
+  // once the user goes away, its resources go too
+  lights.remove();
+  handles = model.unusedResourceObjectHandles();
+  EXPECT_NE(handles.end(), std::find(handles.begin(), handles.end(), definition.handle()));
+  EXPECT_NE(handles.end(), std::find(handles.begin(), handles.end(), schedule.handle()));
+  model.purgeUnusedResourceObjects();
+  EXPECT_FALSE(model.getModelObject<LightsDefinition>(definition.handle()));
+  EXPECT_FALSE(model.getModelObject<ScheduleConstant>(schedule.handle()));
+}
+
+TEST_F(ModelFixture,ResourceObject_PurgeUnusedExternalFile) {
+  Model model;
+
+  path p = resourcesPath() / toPath("model/schedulefile.csv");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<ExternalFile> externalFile = ExternalFile::getExternalFile(model, openstudio::toString(p));
+  ASSERT_TRUE(externalFile);
+  ScheduleFile schedule(*externalFile);
+  path filePath = externalFile->filePath();
+  EXPECT_NE(p, filePath);
+  EXPECT_TRUE(exists(filePath));
+
+  // neither object is used by a non-resource object
+  std::vector<Handle> handles = model.unusedResourceObjectHandles();
+  EXPECT_NE(handles.end(), std::find(handles.begin(), handles.end(), externalFile->handle()));
+  EXPECT_NE(handles.end(), std::find(handles.begin(), handles.end(), schedule.handle()));
+
+  // the purge goes through ExternalFile::remove, which deletes the copy of the file made for the model
+  IdfObjectVector removed = model.purgeUnusedResourceObjects();
+  EXPECT_EQ(2u, removed.size());
+  EXPECT_EQ(0u, model.getConcreteModelObjects<ExternalFile>().size());
+  EXPECT_EQ(0u, model.getConcreteModelObjects<ScheduleFile>().size());
+  EXPECT_FALSE(exists(filePath));
+  EXPECT_TRUE(exists(p));
+}
@@ -309,6 +309,14 @@ TEST_F(ModelFixture, ScheduleFile)
   schedule2.setRowstoSkipatTop(1);
   EXPECT_EQ(1, schedule2.rowstoSkipatTop());
 
+  std::vector<double> values = schedule2.values();
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_DOUBLE_EQ(8759.0, values[0]);
+  EXPECT_DOUBLE_EQ(0.0, values[8759]);
+  schedule2.setRowstoSkipatTop(0);
+  EXPECT_TRUE(schedule2.values().empty());
+  schedule2.setRowstoSkipatTop(1);
+
   ScheduleFile schedule3(*externalfile);
   EXPECT_EQ(3u, model.getConcreteModelObjects<ScheduleFile>().size());
   EXPECT_EQ(3u, externalfile->scheduleFiles().size());
@@ -85,7 +85,30 @@ namespace openstudio {
     return result;
   }
 
-  /// return 8 character hex checksum of file contents
+  /// return 8 character hex checksum of the size bytes starting at data
+  std::string checksum(const char* data, size_t size)
+  {
+    // same result as the istream version, runs of bytes that are not ignored are processed without copying them
+    boost::crc_32_type  crc;
+    const char* end = data + size;
+    const char* begin = data;
+    for (const char* p = data; p != end; ++p) {
+      if (openstudio::detail::checksumIgnore(*p)) {
+        crc.process_bytes(begin, p - begin);
+        begin = p + 1;
+      }
+    }
+    crc.process_bytes(begin, end - begin);
+
+    std::stringstream ss;
+    ss << std::hex << std::uppercase << crc.checksum();
+    std::string result = "00000000";
+    std::string checksum = ss.str();
+    result.replace(8-checksum.size(), checksum.size(), checksum);
+
+    return result;
+  }
+
   std::string checksum(const path& p)
   {
     std::string result = "00000000";
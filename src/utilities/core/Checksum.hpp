@@ -44,6 +44,9 @@ namespace openstudio {
   /// return 8 character hex checksum of istream
   UTILITIES_API std::string checksum(std::istream& is);
 
+  /// return 8 character hex checksum of the size bytes starting at data
+  UTILITIES_API std::string checksum(const char* data, size_t size);
+
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
@@ -50,6 +50,7 @@
 %include <utilities/core/UpdateManager.i>
 %include <utilities/core/UUID.i>
 %include <utilities/core/Checksum.i>
+%include <utilities/core/Profiler.i>
 %include <utilities/core/Optional.hpp>
 %include <utilities/core/UnzipFile.i>
 %include <utilities/core/ZipFile.i>
@@ -0,0 +1,258 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "Profiler.hpp"
+
+#include <json/json.h>
+
+namespace openstudio {
+
+namespace {
+
+  double toSeconds(std::int64_t nanoseconds) {
+    return static_cast<double>(nanoseconds) * 1.0e-9;
+  }
+
+  std::string writeJSON(const Json::Value& value, bool prettyPrint) {
+    Json::StreamWriterBuilder wbuilder;
+    if (prettyPrint) {
+      wbuilder["commentStyle"] = "All";
+      wbuilder["indentation"] = "   ";
+    } else {
+      wbuilder["commentStyle"] = "None";
+      wbuilder["indentation"] = "";
+    }
+    return Json::writeString(wbuilder, value);
+  }
+
+}
+
+Profiler::Profiler()
+  : m_start(std::chrono::steady_clock::now()), m_totalNanoseconds(0)
+{}
+
+void Profiler::startStage(const std::string& name)
+{
+  unsigned stageIndex;
+  auto it = m_stageIndices.find(name);
+  if (it == m_stageIndices.end()) {
+    stageIndex = static_cast<unsigned>(m_stages.size());
+    m_stageIndices.insert(std::make_pair(name, stageIndex));
+    m_stages.push_back(Stage());
+    m_stages.back().name = name;
+  } else {
+    stageIndex = it->second;
+  }
+  ++m_stages[stageIndex].numOpen;
+
+  OpenStage openStage;
+  openStage.event = m_events.size();
+  m_openStages.push_back(openStage);
+
+  // take the time last so that the bookkeeping above is not part of the stage
+  Event event;
+  event.stage = stageIndex;
+  event.startNanoseconds = nanosecondsSinceStart();
+  m_events.push_back(event);
+}
+
+void Profiler::endStage(unsigned count)
+{
+  if (m_openStages.empty()) {
+    return;
+  }
+
+  std::int64_t endNanoseconds = nanosecondsSinceStart();
+
+  OpenStage openStage = m_openStages.back();
+  m_openStages.pop_back();
+
+  Event& event = m_events[openStage.event];
+  event.durationNanoseconds = endNanoseconds - event.startNanoseconds;
+  event.count = count;
+
+  Stage& stage = m_stages[event.stage];
+  ++stage.numCalls;
+  stage.selfNanoseconds += event.durationNanoseconds - openStage.nestedNanoseconds;
+  stage.count += count;
+  --stage.numOpen;
+  if (stage.numOpen == 0) {
+    stage.totalNanoseconds += event.durationNanoseconds;
+  }
+
+  if (m_openStages.empty()) {
+    m_totalNanoseconds += event.durationNanoseconds;
+  } else {
+    m_openStages.back().nestedNanoseconds += event.durationNanoseconds;
+  }
+}
+
+void Profiler::clear()
+{
+  m_start = std::chrono::steady_clock::now();
+  m_stages.clear();
+  m_stageIndices.clear();
+  m_events.clear();
+  m_openStages.clear();
+  m_totalNanoseconds = 0;
+}
+
+bool Profiler::empty() const
+{
+  return m_events.empty();
+}
+
+std::vector<std::string> Profiler::stageNames() const
+{
+  std::vector<std::string> result;
+  for (const Stage& stage : m_stages) {
+    result.push_back(stage.name);
+  }
+  return result;
+}
+
+unsigned Profiler::numCalls(const std::string& name) const
+{
+  auto it = m_stageIndices.find(name);
+  if (it == m_stageIndices.end()) {
+    return 0;
+  }
+  return m_stages[it->second].numCalls;
+}
+
+double Profiler::totalSeconds(const std::string& name) const
+{
+  auto it = m_stageIndices.find(name);
+  if (it == m_stageIndices.end()) {
+    return 0.0;
+  }
+  return toSeconds(m_stages[it->second].totalNanoseconds);
+}
+
+double Profiler::selfSeconds(const std::string& name) const
+{
+  auto it = m_stageIndices.find(name);
+  if (it == m_stageIndices.end()) {
+    return 0.0;
+  }
+  return toSeconds(m_stages[it->second].selfNanoseconds);
+}
+
+unsigned Profiler::count(const std::string& name) const
+{
+  auto it = m_stageIndices.find(name);
+  if (it == m_stageIndices.end()) {
+    return 0;
+  }
+  return m_stages[it->second].count;
+}
+
+double Profiler::totalSeconds() const
+{
+  return toSeconds(m_totalNanoseconds);
+}
+
+std::string Profiler::toJSON(bool prettyPrint) const
+{
+  Json::Value stages(Json::arrayValue);
+  for (const Stage& stage : m_stages) {
+    Json::Value value;
+    value["name"] = stage.name;
+    value["calls"] = stage.numCalls;
+    value["total_seconds"] = toSeconds(stage.totalNanoseconds);
+    value["self_seconds"] = toSeconds(stage.selfNanoseconds);
+    value["count"] = stage.count;
+    stages.append(value);
+  }
+
+  Json::Value result;
+  result["total_seconds"] = toSeconds(m_totalNanoseconds);
+  result["stages"] = stages;
+
+  return writeJSON(result, prettyPrint);
+}
+
+std::string Profiler::toChromeTrace(bool prettyPrint) const
+{
+  Json::Value traceEvents(Json::arrayValue);
+  for (const Event& event : m_events) {
+    if (event.durationNanoseconds < 0) {
+      continue;
+    }
+    Json::Value value;
+    value["name"] = m_stages[event.stage].name;
+    value["ph"] = "X";
+    // timestamps are in microseconds
+    value["ts"] = static_cast<double>(event.startNanoseconds) * 1.0e-3;
+    value["dur"] = static_cast<double>(event.durationNanoseconds) * 1.0e-3;
+    value["pid"] = 0;
+    value["tid"] = 0;
+    value["args"]["count"] = event.count;
+    traceEvents.append(value);
+  }
+
+  Json::Value result;
+  result["traceEvents"] = traceEvents;
+  result["displayTimeUnit"] = "ms";
+
+  return writeJSON(result, prettyPrint);
+}
+
+std::int64_t Profiler::nanosecondsSinceStart() const
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+ProfilerStage::ProfilerStage(Profiler* profiler, const std::string& name)
+  : m_profiler(profiler), m_count(0)
+{
+  if (m_profiler) {
+    m_profiler->startStage(name);
+  }
+}
+
+ProfilerStage::~ProfilerStage()
+{
+  end();
+}
+
+void ProfilerStage::setCount(unsigned count)
+{
+  m_count = count;
+}
+
+void ProfilerStage::end()
+{
+  if (m_profiler) {
+    m_profiler->endStage(m_count);
+    m_profiler = nullptr;
+  }
+}
+
+} // openstudio
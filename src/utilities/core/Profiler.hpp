@@ -0,0 +1,157 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PROFILER_HPP
+#define UTILITIES_CORE_PROFILER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+/** Records the wall time spent in named stages of a process, such as the translation of a model, and the number of
+ *  objects each stage produced. Stages started before the current stage ends are nested in it, so a stage can be
+ *  a step of the process or a single object of a given type. Recorded stages are summarized by name in toJSON and
+ *  listed in order in toChromeTrace, which can be opened in chrome://tracing or Perfetto.
+ *
+ *  A Profiler is not thread safe, each thread should record into its own. Translators use ProfilerStage, which
+ *  does nothing when given no Profiler, so that profiling costs nothing unless it is enabled. */
+class UTILITIES_API Profiler {
+ public:
+
+  Profiler();
+
+  /** Starts a stage called name, nested in the current stage if there is one. */
+  void startStage(const std::string& name);
+
+  /** Ends the most recently started stage, adding count to the number of objects its stage produced. Does nothing
+   *  if no stage is open. */
+  void endStage(unsigned count = 0);
+
+  /** Removes all recorded stages, including open ones, and restarts the clock. */
+  void clear();
+
+  /** Returns true if no stage has been recorded. */
+  bool empty() const;
+
+  /** Returns the names of the recorded stages in the order they were first started. */
+  std::vector<std::string> stageNames() const;
+
+  /** Returns the number of times stage name ended. */
+  unsigned numCalls(const std::string& name) const;
+
+  /** Returns the wall time in seconds spent in stage name, including the stages nested in it. Time spent in a stage
+   *  nested in a stage of the same name is counted once. */
+  double totalSeconds(const std::string& name) const;
+
+  /** Returns the wall time in seconds spent in stage name, excluding the stages nested in it. */
+  double selfSeconds(const std::string& name) const;
+
+  /** Returns the sum of the counts stage name ended with. */
+  unsigned count(const std::string& name) const;
+
+  /** Returns the wall time in seconds spent in stages that were not nested in another stage. */
+  double totalSeconds() const;
+
+  /** Returns a summary of the recorded stages as a JSON object with a "total_seconds" member and a "stages" array,
+   *  which holds the "name", "calls", "total_seconds", "self_seconds" and "count" of each stage. */
+  std::string toJSON(bool prettyPrint = false) const;
+
+  /** Returns the recorded stages in the Chrome trace event format, one complete event per stage that ended, with
+   *  the count of the stage in its "args". */
+  std::string toChromeTrace(bool prettyPrint = false) const;
+
+ private:
+
+  struct Stage {
+    std::string name;
+    unsigned numCalls = 0;
+    std::int64_t totalNanoseconds = 0;
+    std::int64_t selfNanoseconds = 0;
+    unsigned count = 0;
+    // number of open stages of this name, so that recursion is not counted twice in totalNanoseconds
+    unsigned numOpen = 0;
+  };
+
+  struct Event {
+    unsigned stage = 0;
+    std::int64_t startNanoseconds = 0;
+    // -1 until the stage ends
+    std::int64_t durationNanoseconds = -1;
+    unsigned count = 0;
+  };
+
+  struct OpenStage {
+    std::size_t event = 0;
+    std::int64_t nestedNanoseconds = 0;
+  };
+
+  std::int64_t nanosecondsSinceStart() const;
+
+  std::chrono::steady_clock::time_point m_start;
+  std::vector<Stage> m_stages;
+  std::map<std::string, unsigned> m_stageIndices;
+  std::vector<Event> m_events;
+  std::vector<OpenStage> m_openStages;
+  std::int64_t m_totalNanoseconds;
+};
+
+/** Starts a stage of a Profiler when constructed and ends it when destroyed or when end is called. Does nothing if
+ *  profiler is null. */
+class UTILITIES_API ProfilerStage {
+ public:
+
+  ProfilerStage(Profiler* profiler, const std::string& name);
+
+  ~ProfilerStage();
+
+  ProfilerStage(const ProfilerStage& other) = delete;
+  ProfilerStage& operator=(const ProfilerStage& other) = delete;
+
+  /** Sets the number of objects the stage produced, reported when it ends. */
+  void setCount(unsigned count);
+
+  /** Ends the stage, if it has not ended yet. */
+  void end();
+
+ private:
+
+  Profiler* m_profiler;
+  unsigned m_count;
+};
+
+} // openstudio
+
+#endif // UTILITIES_CORE_PROFILER_HPP
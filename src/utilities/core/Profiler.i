@@ -0,0 +1,13 @@
+#ifndef UTILITIES_CORE_PROFILER_I
+#define UTILITIES_CORE_PROFILER_I
+
+%{
+  #include <utilities/core/Profiler.hpp>
+%}
+
+// stages are scoped in C++, use Profiler::startStage and endStage from other languages
+%ignore openstudio::ProfilerStage;
+
+%include <utilities/core/Profiler.hpp>
+
+#endif //UTILITIES_CORE_PROFILER_I
@@ -65,6 +65,16 @@ TEST(Checksum, Strings)
   EXPECT_EQ("F4CC67AC", checksum(string("Hi there\nGoodbye\n")));
 }
 
+TEST(Checksum, Buffers)
+{
+  EXPECT_EQ("00000000", checksum(nullptr, 0));
+
+  string s("Hi there\r\nGoodbye\r\n");
+  EXPECT_EQ("1AD514BA", checksum(s.data(), 8));
+  EXPECT_EQ("F4CC67AC", checksum(s.data(), s.size()));
+  EXPECT_EQ("17B88D3A", checksum(s.data(), s.size() - 2));
+}
+
 TEST(Checksum, Streams)
 {
   stringstream ss;
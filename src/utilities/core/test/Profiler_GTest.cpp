@@ -0,0 +1,126 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../Profiler.hpp"
+
+#include <json/json.h>
+
+#include <sstream>
+
+using openstudio::Profiler;
+using openstudio::ProfilerStage;
+
+TEST(Profiler, NestedStages)
+{
+  Profiler profiler;
+  EXPECT_TRUE(profiler.empty());
+
+  {
+    ProfilerStage outer(&profiler, "Outer");
+    for (unsigned i = 0; i < 3; ++i) {
+      ProfilerStage inner(&profiler, "Inner");
+      inner.setCount(2);
+      // a stage nested in a stage of the same name
+      ProfilerStage recursive(&profiler, "Inner");
+    }
+    outer.setCount(1);
+  }
+
+  // ending with no open stage does nothing
+  profiler.endStage();
+
+  EXPECT_FALSE(profiler.empty());
+  ASSERT_EQ(2u, profiler.stageNames().size());
+  EXPECT_EQ("Outer", profiler.stageNames()[0]);
+  EXPECT_EQ("Inner", profiler.stageNames()[1]);
+
+  EXPECT_EQ(1u, profiler.numCalls("Outer"));
+  EXPECT_EQ(6u, profiler.numCalls("Inner"));
+  EXPECT_EQ(0u, profiler.numCalls("Missing"));
+  EXPECT_EQ(1u, profiler.count("Outer"));
+  EXPECT_EQ(6u, profiler.count("Inner"));
+
+  EXPECT_LE(profiler.totalSeconds("Inner"), profiler.totalSeconds("Outer"));
+  EXPECT_LE(profiler.selfSeconds("Inner"), profiler.totalSeconds("Inner"));
+  EXPECT_DOUBLE_EQ(profiler.totalSeconds("Outer"), profiler.totalSeconds());
+  EXPECT_NEAR(profiler.totalSeconds("Outer"), profiler.selfSeconds("Outer") + profiler.totalSeconds("Inner"), 1.0e-9);
+
+  profiler.clear();
+  EXPECT_TRUE(profiler.empty());
+  EXPECT_TRUE(profiler.stageNames().empty());
+  EXPECT_EQ(0.0, profiler.totalSeconds());
+}
+
+TEST(Profiler, NullProfiler)
+{
+  ProfilerStage stage(nullptr, "Stage");
+  stage.setCount(1);
+  stage.end();
+  stage.end();
+}
+
+TEST(Profiler, Output)
+{
+  Profiler profiler;
+  {
+    ProfilerStage outer(&profiler, "Outer");
+    ProfilerStage inner(&profiler, "Inner");
+    inner.setCount(4);
+  }
+  // open stages are not reported
+  profiler.startStage("Open");
+
+  Json::CharReaderBuilder rbuilder;
+  std::string errors;
+
+  Json::Value summary;
+  std::istringstream ss(profiler.toJSON());
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, ss, &summary, &errors));
+  ASSERT_TRUE(summary["stages"].isArray());
+  ASSERT_EQ(3u, summary["stages"].size());
+  EXPECT_EQ("Inner", summary["stages"][1]["name"].asString());
+  EXPECT_EQ(1u, summary["stages"][1]["calls"].asUInt());
+  EXPECT_EQ(4u, summary["stages"][1]["count"].asUInt());
+  EXPECT_EQ(0u, summary["stages"][2]["calls"].asUInt());
+  EXPECT_DOUBLE_EQ(profiler.totalSeconds(), summary["total_seconds"].asDouble());
+
+  Json::Value trace;
+  std::istringstream ss2(profiler.toChromeTrace(true));
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, ss2, &trace, &errors));
+  ASSERT_TRUE(trace["traceEvents"].isArray());
+  ASSERT_EQ(2u, trace["traceEvents"].size());
+  EXPECT_EQ("Outer", trace["traceEvents"][0]["name"].asString());
+  EXPECT_EQ("X", trace["traceEvents"][0]["ph"].asString());
+  EXPECT_EQ("Inner", trace["traceEvents"][1]["name"].asString());
+  EXPECT_EQ(4u, trace["traceEvents"][1]["args"]["count"].asUInt());
+  EXPECT_LE(trace["traceEvents"][0]["ts"].asDouble(), trace["traceEvents"][1]["ts"].asDouble());
+  EXPECT_LE(trace["traceEvents"][1]["dur"].asDouble(), trace["traceEvents"][0]["dur"].asDouble());
+}
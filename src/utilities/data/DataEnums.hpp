@@ -235,6 +235,24 @@ OPENSTUDIO_ENUM(BuildingSector,
   ((Commercial)(NonResidential))
   ((Residential)));
 
+/** \class TimeSeriesAggregation
+ *  \brief How the values of a TimeSeries that fall in one interval are combined when resampling.
+ *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual macro call is:
+ *  \code
+OPENSTUDIO_ENUM(TimeSeriesAggregation,
+  ((Mean))
+  ((Sum))
+  ((Max))
+  ((Min))
+  ((First)));
+ *  \endcode */
+OPENSTUDIO_ENUM(TimeSeriesAggregation,
+  ((Mean))
+  ((Sum))
+  ((Max))
+  ((Min))
+  ((First)));
+
 } // openstudio
 
 #endif // UTILITIES_DATA_DATAENUMS_HPP
@@ -62,102 +62,109 @@ namespace openstudio{
     return !(lhs==rhs);
   }
 
-  /// linear interpolation of the function v = f(x, y) at point xi, yi
-  /// assumes that x and y are strictly increasing
-  double interp(const Vector& x, const Vector& y, const Matrix& v, double xi, double yi, InterpMethod interpMethod, ExtrapMethod extrapMethod)
-  {
-    double result = 0.0;
+  namespace {
 
-    size_t M = x.size();
-    size_t N = y.size();
-
-    if ((M != v.size1()) || (N != v.size2())){
-      return result;
+    // ublas stores a Matrix row by row in one contiguous array, the kernels below work on that storage directly
+    inline const double* rawData(const Matrix& m)
+    {
+      return m.data().begin();
     }
 
-    InterpInfo xInfo = interpInfo(x, xi);
+    inline double* rawData(Matrix& m)
+    {
+      return m.data().begin();
+    }
 
-    if (xInfo.extrapolated){
-      switch(extrapMethod){
-        case NoneExtrap:
-          // set all weights to zero
-          xInfo.wa = 0.0; xInfo.wb = 0.0;
-          break;
-        case NearestExtrap:
-          // pick closest point
-          // no-op
-          break;
-      }
-    }else{
-      switch(interpMethod){
-        case LinearInterp:
-          // linear interpolation
-          // no-op
-          break;
-        case NearestInterp:
-          // pick closest point
-          if(xInfo.wa > xInfo.wb){
-            xInfo.wa = 1.0; xInfo.wb = 0.0;
-          }else{
-            xInfo.wa = 0.0; xInfo.wb = 1.0;
-          }
-          break;
-        case HoldLastInterp:
-          // set to previous value
-          xInfo.wa = 1.0; xInfo.wb = 0.0;
-          break;
-        case HoldNextInterp:
-          // set to next value
-          xInfo.wa = 0.0; xInfo.wb = 1.0;
-          break;
-      }
+    inline const double* rawData(const Vector& v)
+    {
+      return v.data().begin();
     }
 
-    InterpInfo yInfo = interpInfo(y, yi);
+    inline double* rawData(Vector& v)
+    {
+      return v.data().begin();
+    }
 
-    if (yInfo.extrapolated){
-      switch(extrapMethod){
-        case NoneExtrap:
-          // set all weights to zero
-          yInfo.wa = 0.0; yInfo.wb = 0.0;
-          break;
-        case NearestExtrap:
-          // pick closest point
-          // no-op
-          break;
+    // interpolation weights along one axis, set so that the bilinear sum applies the interpolation and extrapolation methods
+    InterpInfo axisInfo(const Vector& x, double xi, InterpMethod interpMethod, ExtrapMethod extrapMethod)
+    {
+      InterpInfo info = interpInfo(x, xi);
+
+      if (info.extrapolated){
+        switch(extrapMethod){
+          case NoneExtrap:
+            // set all weights to zero
+            info.wa = 0.0; info.wb = 0.0;
+            break;
+          case NearestExtrap:
+            // pick closest point
+            // no-op
+            break;
+        }
+      }else{
+        switch(interpMethod){
+          case LinearInterp:
+            // linear interpolation
+            // no-op
+            break;
+          case NearestInterp:
+            // pick closest point
+            if(info.wa > info.wb){
+              info.wa = 1.0; info.wb = 0.0;
+            }else{
+              info.wa = 0.0; info.wb = 1.0;
+            }
+            break;
+          case HoldLastInterp:
+            // set to previous value
+            info.wa = 1.0; info.wb = 0.0;
+            break;
+          case HoldNextInterp:
+            // set to next value
+            info.wa = 0.0; info.wb = 1.0;
+            break;
+        }
       }
-    }else{
-      switch(interpMethod){
-        case LinearInterp:
-          // linear interpolation
-          // no-op
-          break;
-        case NearestInterp:
-          // pick closest point
-          if(yInfo.wa > yInfo.wb){
-            yInfo.wa = 1.0; yInfo.wb = 0.0;
-          }else{
-            yInfo.wa = 0.0; yInfo.wb = 1.0;
-          }
-          break;
-        case HoldLastInterp:
-          // set to previous value
-          yInfo.wa = 1.0; yInfo.wb = 0.0;
-          break;
-        case HoldNextInterp:
-          // set to next value
-          yInfo.wa = 0.0; yInfo.wb = 1.0;
-          break;
+
+      return info;
+    }
+
+    std::vector<InterpInfo> axisInfo(const Vector& x, const Vector& xi, InterpMethod interpMethod, ExtrapMethod extrapMethod)
+    {
+      std::vector<InterpInfo> result;
+      result.reserve(xi.size());
+      for (size_t i = 0; i < xi.size(); ++i){
+        result.push_back(axisInfo(x, xi[i], interpMethod, extrapMethod));
       }
+      return result;
     }
 
     // we have set weights appropriately so that here we can compute in the same way all the time
-    result = xInfo.wa*yInfo.wa*v(xInfo.ia, yInfo.ia) +
-             xInfo.wa*yInfo.wb*v(xInfo.ia, yInfo.ib) +
-             xInfo.wb*yInfo.wa*v(xInfo.ib, yInfo.ia) +
-             xInfo.wb*yInfo.wb*v(xInfo.ib, yInfo.ib);
+    inline double bilinear(const double* v, size_t N, const InterpInfo& xInfo, const InterpInfo& yInfo)
+    {
+      return xInfo.wa*yInfo.wa*v[xInfo.ia*N + yInfo.ia] +
+             xInfo.wa*yInfo.wb*v[xInfo.ia*N + yInfo.ib] +
+             xInfo.wb*yInfo.wa*v[xInfo.ib*N + yInfo.ia] +
+             xInfo.wb*yInfo.wb*v[xInfo.ib*N + yInfo.ib];
+    }
 
-    return result;
+  } // namespace
+
+  /// linear interpolation of the function v = f(x, y) at point xi, yi
+  /// assumes that x and y are strictly increasing
+  double interp(const Vector& x, const Vector& y, const Matrix& v, double xi, double yi, InterpMethod interpMethod, ExtrapMethod extrapMethod)
+  {
+    size_t M = x.size();
+    size_t N = y.size();
+
+    if ((M != v.size1()) || (N != v.size2())){
+      return 0.0;
+    }
+
+    InterpInfo xInfo = axisInfo(x, xi, interpMethod, extrapMethod);
+    InterpInfo yInfo = axisInfo(y, yi, interpMethod, extrapMethod);
+
+    return bilinear(rawData(v), N, xInfo, yInfo);
   }
 
   /// linear interpolation of the function v = f(x, y) at points xi, yi
@@ -165,15 +172,19 @@ namespace openstudio{
   Vector interp(const Vector& x, const Vector& y, const Matrix& v, const Vector& xi, double yi, InterpMethod interpMethod, ExtrapMethod extrapMethod)
   {
     size_t M = x.size();
+    size_t N = y.size();
 
-    Vector result(M);
+    Vector result(xi.size());
 
-    if (M != v.size1()){
+    if ((M != v.size1()) || (N != v.size2())){
       return result;
     }
 
-    for (unsigned i = 0; i < M; ++i){
-      result(i) = interp(x, y, v, xi(i), yi, interpMethod, extrapMethod);
+    // the weights along y are the same for every point
+    InterpInfo yInfo = axisInfo(y, yi, interpMethod, extrapMethod);
+    const double* pv = rawData(v);
+    for (size_t i = 0; i < xi.size(); ++i){
+      result[i] = bilinear(pv, N, axisInfo(x, xi[i], interpMethod, extrapMethod), yInfo);
     }
 
     return result;
@@ -183,16 +194,20 @@ namespace openstudio{
   /// assumes that x and y are strictly increasing
   Vector interp(const Vector& x, const Vector& y, const Matrix& v, double xi, const Vector& yi, InterpMethod interpMethod, ExtrapMethod extrapMethod)
   {
+    size_t M = x.size();
     size_t N = y.size();
 
-    Vector result(N);
+    Vector result(yi.size());
 
-    if (N != v.size2()){
+    if ((M != v.size1()) || (N != v.size2())){
       return result;
     }
 
-    for (unsigned j = 0; j < N; ++j){
-      result(j) = interp(x, y, v, xi, yi(j), interpMethod, extrapMethod);
+    // the weights along x are the same for every point
+    InterpInfo xInfo = axisInfo(x, xi, interpMethod, extrapMethod);
+    const double* pv = rawData(v);
+    for (size_t j = 0; j < yi.size(); ++j){
+      result[j] = bilinear(pv, N, xInfo, axisInfo(y, yi[j], interpMethod, extrapMethod));
     }
 
     return result;
@@ -205,15 +220,21 @@ namespace openstudio{
     size_t M = x.size();
     size_t N = y.size();
 
-    Matrix result(M, N);
+    Matrix result(xi.size(), yi.size());
 
     if ((M != v.size1()) || (N != v.size2())){
       return result;
     }
 
-    for (unsigned i = 0; i < M; ++i){
-      for (unsigned j = 0; j < N; ++j){
-        result(i,j) = interp(x, y, v, xi(i), yi(j), interpMethod, extrapMethod);
+    // weights along each axis are found once per row and column rather than once per point
+    std::vector<InterpInfo> xInfos = axisInfo(x, xi, interpMethod, extrapMethod);
+    std::vector<InterpInfo> yInfos = axisInfo(y, yi, interpMethod, extrapMethod);
+    const double* pv = rawData(v);
+    double* out = rawData(result);
+    size_t Nj = yi.size();
+    for (size_t i = 0; i < xInfos.size(); ++i){
+      for (size_t j = 0; j < Nj; ++j){
+        out[i*Nj + j] = bilinear(pv, N, xInfos[i], yInfos[j]);
       }
     }
 
@@ -223,13 +244,61 @@ namespace openstudio{
   /// matrix product
   Matrix prod(const Matrix& lop, const Matrix& rop)
   {
-    return boost::numeric::ublas::prod(lop, rop);
+    size_t M = lop.size1();
+    size_t K = lop.size2();
+    size_t N = rop.size2();
+    if (K != rop.size1()){
+      return boost::numeric::ublas::prod(lop, rop);
+    }
+
+    // i-k-j order walks both operands and the result along their rows
+    Matrix result(M, N, 0.0);
+    const double* a = rawData(lop);
+    const double* b = rawData(rop);
+    double* c = rawData(result);
+    for (size_t i = 0; i < M; ++i){
+      double* ci = c + i*N;
+      for (size_t k = 0; k < K; ++k){
+        double aik = a[i*K + k];
+        const double* bk = b + k*N;
+        for (size_t j = 0; j < N; ++j){
+          ci[j] += aik*bk[j];
+        }
+      }
+    }
+    return result;
   }
 
   /// vector product
   Vector prod(const Matrix& m, const Vector& v)
   {
-    return boost::numeric::ublas::prod(m, v);
+    size_t M = m.size1();
+    size_t N = m.size2();
+    if (N != v.size()){
+      return boost::numeric::ublas::prod(m, v);
+    }
+
+    Vector result(M);
+    const double* a = rawData(m);
+    const double* x = rawData(v);
+    double* out = rawData(result);
+    for (size_t i = 0; i < M; ++i){
+      // four partial sums so the loop is not serialized on one accumulator
+      const double* ai = a + i*N;
+      double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+      size_t j = 0;
+      for (; j + 4 <= N; j += 4){
+        s0 += ai[j]*x[j];
+        s1 += ai[j+1]*x[j+1];
+        s2 += ai[j+2]*x[j+2];
+        s3 += ai[j+3]*x[j+3];
+      }
+      for (; j < N; ++j){
+        s0 += ai[j]*x[j];
+      }
+      out[i] = (s0 + s1) + (s2 + s3);
+    }
+    return result;
   }
 
   /// outer product
@@ -304,25 +373,32 @@ namespace openstudio{
   /// sum
   double sum(const Matrix& matrix)
   {
-    double result = 0.0;
-    for (unsigned i = 0; i < matrix.size1(); ++i){
-      for (unsigned j = 0; j < matrix.size2(); ++j){
-        result += matrix(i,j);
-      }
+    size_t N = matrix.size1()*matrix.size2();
+    const double* a = rawData(matrix);
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    size_t i = 0;
+    for (; i + 4 <= N; i += 4){
+      s0 += a[i];
+      s1 += a[i+1];
+      s2 += a[i+2];
+      s3 += a[i+3];
     }
-    return result;
+    for (; i < N; ++i){
+      s0 += a[i];
+    }
+    return (s0 + s1) + (s2 + s3);
   }
 
   /// maximum
   double maximum(const Matrix& matrix)
   {
     double max = 0;
-    if ((matrix.size1() > 0) && (matrix.size2() > 0)){
-      max = matrix(0,0);
-      for (unsigned i = 0; i < matrix.size1(); ++i){
-        for (unsigned j = 0; j < matrix.size2(); ++j){
-          max = std::max(max, matrix(i,j));
-        }
+    size_t N = matrix.size1()*matrix.size2();
+    if (N > 0){
+      const double* a = rawData(matrix);
+      max = a[0];
+      for (size_t i = 1; i < N; ++i){
+        max = std::max(max, a[i]);
       }
     }
     return max;
@@ -332,12 +408,12 @@ namespace openstudio{
   double minimum(const Matrix& matrix)
   {
     double min = 0;
-    if ((matrix.size1() > 0) && (matrix.size2() > 0)){
-      min = matrix(0,0);
-      for (unsigned i = 0; i < matrix.size1(); ++i){
-        for (unsigned j = 0; j < matrix.size2(); ++j){
-          min = std::min(min, matrix(i,j));
-        }
+    size_t N = matrix.size1()*matrix.size2();
+    if (N > 0){
+      const double* a = rawData(matrix);
+      min = a[0];
+      for (size_t i = 1; i < N; ++i){
+        min = std::min(min, a[i]);
       }
     }
     return min;
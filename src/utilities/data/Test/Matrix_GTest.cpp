@@ -33,6 +33,7 @@
 #include "../Matrix.hpp"
 #include "../Vector.hpp"
 
+#include <chrono>
 #include <exception>
 #include <iostream>
 
@@ -151,6 +152,62 @@ TEST_F(DataFixture,Matrix_Prod)
 
 }
 
+TEST_F(DataFixture,Matrix_InterpGrid)
+{
+  Vector x = linspace(0.0, 4.0, 5);
+  Vector y = linspace(0.0, 2.0, 3);
+  Matrix v(5, 3);
+  for (unsigned i = 0; i < 5; ++i){
+    for (unsigned j = 0; j < 3; ++j){
+      v(i,j) = i*i + 10.0*j;
+    }
+  }
+
+  Vector xi = linspace(-0.5, 4.5, 11);
+  Vector yi = linspace(-0.5, 2.5, 7);
+  for (InterpMethod method : {LinearInterp, NearestInterp, HoldLastInterp, HoldNextInterp}){
+    for (ExtrapMethod extrap : {NoneExtrap, NearestExtrap}){
+      Matrix grid = interp(x, y, v, xi, yi, method, extrap);
+      Vector column = interp(x, y, v, xi, 0.75, method, extrap);
+      Vector row = interp(x, y, v, 1.25, yi, method, extrap);
+      ASSERT_EQ(xi.size(), grid.size1());
+      ASSERT_EQ(yi.size(), grid.size2());
+      ASSERT_EQ(xi.size(), column.size());
+      ASSERT_EQ(yi.size(), row.size());
+      for (unsigned i = 0; i < xi.size(); ++i){
+        for (unsigned j = 0; j < yi.size(); ++j){
+          EXPECT_DOUBLE_EQ(interp(x, y, v, xi(i), yi(j), method, extrap), grid(i,j));
+        }
+        EXPECT_DOUBLE_EQ(interp(x, y, v, xi(i), 0.75, method, extrap), column(i));
+      }
+      for (unsigned j = 0; j < yi.size(); ++j){
+        EXPECT_DOUBLE_EQ(interp(x, y, v, 1.25, yi(j), method, extrap), row(j));
+      }
+    }
+  }
+}
+
+TEST_F(DataFixture,Matrix_ProdLarge)
+{
+  Matrix A = randMatrix(-1.0, 1.0, 37, 23);
+  Matrix B = randMatrix(-1.0, 1.0, 23, 41);
+  Vector x = randVector(-1.0, 1.0, 23);
+
+  Matrix C = prod(A, B);
+  Matrix expectedC = boost::numeric::ublas::prod(A, B);
+  Vector y = prod(A, x);
+  Vector expectedY = boost::numeric::ublas::prod(A, x);
+
+  ASSERT_EQ(37u, C.size1());
+  ASSERT_EQ(41u, C.size2());
+  for (unsigned i = 0; i < 37; ++i){
+    for (unsigned j = 0; j < 41; ++j){
+      EXPECT_NEAR(expectedC(i,j), C(i,j), 1.0e-12);
+    }
+    EXPECT_NEAR(expectedY(i), y(i), 1.0e-12);
+  }
+}
+
 TEST_F(DataFixture,Matrix_OuterProd)
 {
   Vector x(2);
@@ -337,3 +394,55 @@ TEST_F(DataFixture, Matrix_FindConnectedComponents)
     EXPECT_EQ(2u, result[1][0]);
   }
 }
+
+TEST_F(DataFixture,DISABLED_Matrix_Benchmark)
+{
+  // matrix-vector and matrix-matrix products against ublas
+  Matrix A = randMatrix(-1.0, 1.0, 1000, 1000);
+  Vector x = randVector(-1.0, 1.0, 1000);
+
+  auto start = std::chrono::steady_clock::now();
+  Vector expectedY;
+  for (unsigned n = 0; n < 100; ++n){
+    expectedY = boost::numeric::ublas::prod(A, x);
+  }
+  double ublasSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  start = std::chrono::steady_clock::now();
+  Vector y;
+  for (unsigned n = 0; n < 100; ++n){
+    y = prod(A, x);
+  }
+  double prodSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_NEAR(expectedY(0), y(0), 1.0e-9);
+  std::cout << "100 products of a 1000x1000 Matrix and a Vector: " << ublasSeconds << " s with ublas, " << prodSeconds << " s with prod" << std::endl;
+
+  Matrix B = randMatrix(-1.0, 1.0, 300, 300);
+  start = std::chrono::steady_clock::now();
+  Matrix expectedC = boost::numeric::ublas::prod(B, B);
+  ublasSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  start = std::chrono::steady_clock::now();
+  Matrix C = prod(B, B);
+  prodSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_NEAR(expectedC(7,11), C(7,11), 1.0e-9);
+  std::cout << "Product of two 300x300 Matrix: " << ublasSeconds << " s with ublas, " << prodSeconds << " s with prod" << std::endl;
+
+  // an illuminance map sized grid interpolated onto a finer grid
+  Vector gx = linspace(0.0, 10.0, 100);
+  Vector gy = linspace(0.0, 10.0, 100);
+  Matrix v = randMatrix(0.0, 500.0, 100, 100);
+  Vector xi = linspace(0.0, 10.0, 400);
+  Vector yi = linspace(0.0, 10.0, 400);
+  start = std::chrono::steady_clock::now();
+  Matrix pointwise(400, 400);
+  for (unsigned i = 0; i < 400; ++i){
+    for (unsigned j = 0; j < 400; ++j){
+      pointwise(i,j) = interp(gx, gy, v, xi(i), yi(j));
+    }
+  }
+  double pointwiseSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  start = std::chrono::steady_clock::now();
+  Matrix grid = interp(gx, gy, v, xi, yi);
+  double gridSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_TRUE(pointwise == grid);
+  std::cout << "interp of a 400x400 grid: " << pointwiseSeconds << " s one point at a time, " << gridSeconds << " s as a grid" << std::endl;
+}
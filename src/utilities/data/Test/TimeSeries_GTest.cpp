@@ -35,6 +35,9 @@
 #include "../../time/Date.hpp"
 #include "../../time/Time.hpp"
 
+#include <chrono>
+#include <iostream>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -1187,6 +1190,311 @@ TEST_F(DataFixture, TimeSeries_Multiply8760)
 
 }
 
+TEST_F(DataFixture, TimeSeries_IntervalConstructor_CompactTimes)
+{
+  // A fixed interval series computes its times from the interval, check it against the same series with explicit times
+  Vector values(8760);
+  std::vector<long> secondsFromStart(8760);
+  for (unsigned i = 0; i < 8760; ++i) {
+    values(i) = i % 97;
+    secondsFromStart[i] = (i + 1) * 3600;
+  }
+  DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+
+  TimeSeries compact(firstReportDateTime, Time(0, 1, 0, 0), values, "W");
+  TimeSeries detailed(firstReportDateTime, secondsFromStart, values, "W");
+  ASSERT_TRUE(compact.intervalLength());
+  EXPECT_FALSE(detailed.intervalLength());
+
+  EXPECT_EQ(detailed.secondsFromFirstReport(), compact.secondsFromFirstReport());
+  EXPECT_EQ(detailed.dateTimes(), compact.dateTimes());
+  ASSERT_EQ(detailed.daysFromFirstReport().size(), compact.daysFromFirstReport().size());
+  for (unsigned i = 0; i < 8760; i += 101) {
+    EXPECT_EQ(detailed.secondsFromFirstReport(i), compact.secondsFromFirstReport(i));
+    EXPECT_EQ(detailed.daysFromFirstReport(i), compact.daysFromFirstReport(i));
+    EXPECT_EQ(detailed.daysFromFirstReport()[i], compact.daysFromFirstReport()[i]);
+    DateTime dateTime = firstReportDateTime + Time(0, i, 0, 0);
+    EXPECT_EQ(detailed.value(dateTime), compact.value(dateTime));
+  }
+  EXPECT_EQ(0, compact.secondsFromFirstReport(8760));
+  EXPECT_EQ(compact.outOfRangeValue(), compact.daysFromFirstReport(8760));
+
+  DateTime start(Date(MonthOfYear::Mar, 1, 2009), Time(0, 0, 30, 0));
+  DateTime end(Date(MonthOfYear::Mar, 31, 2009), Time(0, 12, 0, 0));
+  EXPECT_EQ(detailed.values(start, end).size(), compact.values(start, end).size());
+  EXPECT_EQ(detailed.integrate(), compact.integrate());
+  EXPECT_DOUBLE_EQ(detailed.averageValue(), compact.averageValue());
+
+  TimeSeries scaled = 2.0 * compact;
+  ASSERT_TRUE(scaled.intervalLength());
+  EXPECT_EQ(compact.dateTimes(), scaled.dateTimes());
+  EXPECT_EQ(2.0 * compact.values(5000), scaled.values(5000));
+}
+
+TEST_F(DataFixture, TimeSeries_Resample)
+{
+  // one day of 15 minute data
+  Vector values(96);
+  for (unsigned i = 0; i < 96; ++i) {
+    values(i) = i;
+  }
+  DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 0, 15, 0));
+  TimeSeries quarterHourly(firstReportDateTime, Time(0, 0, 15, 0), values, "W");
+
+  TimeSeries hourly = quarterHourly.resample(Time(0, 1, 0, 0));
+  ASSERT_TRUE(hourly.intervalLength());
+  EXPECT_EQ(Time(0, 1, 0, 0), *hourly.intervalLength());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0)), hourly.firstReportDateTime());
+  EXPECT_EQ(quarterHourly.startDateTime(), hourly.startDateTime());
+  ASSERT_EQ(24u, hourly.values().size());
+  EXPECT_EQ("W", hourly.units());
+  EXPECT_DOUBLE_EQ(1.5, hourly.values(0));
+  EXPECT_DOUBLE_EQ(93.5, hourly.values(23));
+  EXPECT_DOUBLE_EQ(quarterHourly.averageValue(), hourly.averageValue());
+
+  TimeSeries hourlySum = quarterHourly.resample(Time(0, 1, 0, 0), TimeSeriesAggregation::Sum);
+  EXPECT_DOUBLE_EQ(6.0, hourlySum.values(0));
+  EXPECT_DOUBLE_EQ(values(92) + values(93) + values(94) + values(95), hourlySum.values(23));
+  EXPECT_DOUBLE_EQ(3.0, quarterHourly.resample(Time(0, 1, 0, 0), TimeSeriesAggregation::Max).values(0));
+  EXPECT_DOUBLE_EQ(4.0, quarterHourly.resample(Time(0, 1, 0, 0), TimeSeriesAggregation::Min).values(1));
+  EXPECT_DOUBLE_EQ(8.0, quarterHourly.resample(Time(0, 1, 0, 0), TimeSeriesAggregation::First).values(2));
+
+  // a longer interval than the series covers has a single value
+  TimeSeries daily = quarterHourly.resample(Time(1, 0, 0, 0), TimeSeriesAggregation::Max);
+  ASSERT_EQ(1u, daily.values().size());
+  EXPECT_DOUBLE_EQ(95.0, daily.values(0));
+
+  // a shorter interval takes the value reported at the end of each interval
+  TimeSeries fiveMinutes = quarterHourly.resample(Time(0, 0, 5, 0));
+  ASSERT_EQ(288u, fiveMinutes.values().size());
+  DateTimeVector dateTimes = fiveMinutes.dateTimes();
+  for (unsigned i = 0; i < 288; ++i) {
+    EXPECT_EQ(quarterHourly.value(dateTimes[i]), fiveMinutes.values(i));
+  }
+
+  EXPECT_THROW(quarterHourly.resample(Time(0)), openstudio::Exception);
+}
+
+TEST_F(DataFixture, TimeSeries_AggregateByMonth)
+{
+  // one year of hourly ones
+  Vector values(8760, 1.0);
+  DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  TimeSeries hourly(firstReportDateTime, Time(0, 1, 0, 0), values, "W");
+
+  TimeSeries monthly = hourly.aggregateByMonth(TimeSeriesAggregation::Sum);
+  ASSERT_EQ(12u, monthly.values().size());
+  EXPECT_FALSE(monthly.intervalLength());
+  EXPECT_EQ(hourly.startDateTime(), monthly.startDateTime());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Feb, 1, 2009)), monthly.firstReportDateTime());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2010)), monthly.dateTimes().back());
+  EXPECT_DOUBLE_EQ(31 * 24, monthly.values(0));
+  EXPECT_DOUBLE_EQ(28 * 24, monthly.values(1));
+  EXPECT_DOUBLE_EQ(31 * 24, monthly.values(11));
+  EXPECT_DOUBLE_EQ(8760, sum(monthly.values()));
+
+  TimeSeries monthlyMean = hourly.aggregateByMonth();
+  for (unsigned i = 0; i < 12; ++i) {
+    EXPECT_DOUBLE_EQ(1.0, monthlyMean.values(i));
+  }
+}
+
+TEST_F(DataFixture, TimeSeries_Align)
+{
+  // an hourly series and a half hourly series that starts later
+  Vector hourlyValues(24);
+  for (unsigned i = 0; i < 24; ++i) {
+    hourlyValues(i) = i;
+  }
+  Vector halfHourlyValues(12);
+  for (unsigned i = 0; i < 12; ++i) {
+    halfHourlyValues(i) = 100 + i;
+  }
+  TimeSeries hourly(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0)), Time(0, 1, 0, 0), hourlyValues, "W");
+  TimeSeries halfHourly(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 6, 30, 0)), Time(0, 0, 30, 0), halfHourlyValues, "W");
+  halfHourly.setOutOfRangeValue(-1);
+
+  std::vector<TimeSeries> aligned = alignTimeSeries({hourly, halfHourly});
+  ASSERT_EQ(2u, aligned.size());
+  DateTimeVector dateTimes = aligned[0].dateTimes();
+  EXPECT_EQ(dateTimes, aligned[1].dateTimes());
+  ASSERT_EQ(24u + 6u, dateTimes.size());
+  EXPECT_EQ(hourly.startDateTime(), aligned[0].startDateTime());
+  for (unsigned k = 0; k < 2; ++k) {
+    const TimeSeries& original = (k == 0) ? hourly : halfHourly;
+    for (unsigned i = 0; i < dateTimes.size(); ++i) {
+      EXPECT_EQ(original.value(dateTimes[i]), aligned[k].values(i));
+    }
+  }
+  EXPECT_EQ(-1, aligned[1].values(0));
+  EXPECT_EQ(-1, aligned[1].outOfRangeValue());
+}
+
+TEST_F(DataFixture, DISABLED_TimeSeries_ResampleBenchmark)
+{
+  // one year of 15 minute data to hourly means, with resample and with a query per point
+  Vector values(8760 * 4);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    values(i) = i % 101;
+  }
+  TimeSeries quarterHourly(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 0, 15, 0)), Time(0, 0, 15, 0), values, "W");
+
+  auto start = std::chrono::steady_clock::now();
+  TimeSeries hourly = quarterHourly.resample(Time(0, 1, 0, 0));
+  double resampleSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  DateTimeVector dateTimes = quarterHourly.dateTimes();
+  Vector pointValues(8760);
+  for (unsigned i = 0; i < 8760; ++i) {
+    double total = 0;
+    for (unsigned j = 0; j < 4; ++j) {
+      total += quarterHourly.value(dateTimes[4 * i + j]);
+    }
+    pointValues(i) = total / 4;
+  }
+  double pointSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  for (unsigned i = 0; i < 8760; i += 97) {
+    EXPECT_DOUBLE_EQ(pointValues(i), hourly.values(i));
+  }
+  std::cout << "Resampled 35040 values to hourly in " << resampleSeconds << " s, point queries took " << pointSeconds << " s" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  TimeSeries monthly = quarterHourly.aggregateByMonth();
+  std::cout << "Aggregated 35040 values by month in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s" << std::endl;
+  EXPECT_EQ(12u, monthly.values().size());
+}
+
+TEST_F(DataFixture, TimeSeries_Expr)
+{
+  DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  Vector values1(8760);
+  Vector values2(8760);
+  for (unsigned i = 0; i < 8760; ++i) {
+    values1(i) = i % 24;
+    values2(i) = 0.5 * (i % 7);
+  }
+  TimeSeries hourly1(firstReportDateTime, Time(0, 1, 0, 0), values1, "W");
+  TimeSeries hourly2(firstReportDateTime, Time(0, 1, 0, 0), values2, "W");
+
+  // series on the same intervals
+  TimeSeriesExpr expr = 2.0 * TimeSeriesExpr(hourly1) - hourly2 / 4.0 + hourly1;
+  EXPECT_EQ(3u, expr.numTerms());
+  TimeSeries result = expr.evaluate();
+  ASSERT_TRUE(result.intervalLength());
+  EXPECT_EQ(firstReportDateTime, result.firstReportDateTime());
+  EXPECT_EQ("W", result.units());
+  ASSERT_EQ(8760u, result.values().size());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_DOUBLE_EQ(3.0 * values1(i) - 0.25 * values2(i), result.values(i));
+  }
+
+  // threads give the same values
+  TimeSeries threaded = expr.evaluate(4);
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(result.values(i), threaded.values(i));
+  }
+
+  // series on different times match the binary operators
+  Vector halfHourlyValues(48);
+  for (unsigned i = 0; i < 48; ++i) {
+    halfHourlyValues(i) = 100 + i;
+  }
+  TimeSeries halfHourly(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 6, 30, 0)), Time(0, 0, 30, 0), halfHourlyValues, "W");
+  TimeSeries expected = (hourly1 + halfHourly) - hourly2 * 3.0;
+  TimeSeries mixed = (TimeSeriesExpr(hourly1) + halfHourly - 3.0 * TimeSeriesExpr(hourly2)).evaluate(0);
+  EXPECT_EQ(expected.dateTimes(), mixed.dateTimes());
+  ASSERT_EQ(expected.values().size(), mixed.values().size());
+  for (unsigned i = 0; i < mixed.values().size(); ++i) {
+    EXPECT_DOUBLE_EQ(expected.values(i), mixed.values(i));
+  }
+
+  // weighted sums
+  TimeSeries weighted = weightedSum({hourly1, hourly2}, {0.5, 2.0}).evaluate();
+  EXPECT_DOUBLE_EQ(0.5 * values1(100) + 2.0 * values2(100), weighted.values(100));
+  EXPECT_THROW(weightedSum({hourly1, hourly2}, {1.0}), openstudio::Exception);
+
+  // different units cannot be combined
+  TimeSeries kW(firstReportDateTime, Time(0, 1, 0, 0), values1, "kW");
+  EXPECT_TRUE((TimeSeriesExpr(hourly1) + kW).evaluate().values().empty());
+  EXPECT_TRUE(TimeSeriesExpr().evaluate().values().empty());
+
+  // sum of a vector gives what adding the series one by one gives
+  TimeSeriesVector series{halfHourly, TimeSeries(firstReportDateTime, Time(0, 1, 0, 0), Vector(24, 1.0), "W"), halfHourly};
+  TimeSeries summed = openstudio::sum(series);
+  expected = (series[0] + series[1]) + series[2];
+  EXPECT_FALSE(summed.intervalLength());
+  EXPECT_FALSE(expected.intervalLength());
+  EXPECT_EQ(expected.startDateTime(), summed.startDateTime());
+  EXPECT_EQ(expected.dateTimes(), summed.dateTimes());
+  ASSERT_EQ(expected.values().size(), summed.values().size());
+  for (unsigned i = 0; i < summed.values().size(); ++i) {
+    EXPECT_DOUBLE_EQ(expected.values(i), summed.values(i));
+  }
+
+  // on the same intervals too, the sum has no interval length
+  summed = openstudio::sum({halfHourly, halfHourly});
+  EXPECT_FALSE(summed.intervalLength());
+  EXPECT_EQ(halfHourly.startDateTime(), summed.startDateTime());
+  EXPECT_EQ(halfHourly.dateTimes(), summed.dateTimes());
+  EXPECT_DOUBLE_EQ(2.0 * halfHourlyValues(47), summed.values(47));
+
+  // one series is returned as it is, and an empty first series gives an empty sum
+  summed = openstudio::sum({halfHourly});
+  ASSERT_TRUE(summed.intervalLength());
+  EXPECT_EQ(Time(0, 0, 30, 0), *summed.intervalLength());
+  EXPECT_EQ(halfHourly.dateTimes(), summed.dateTimes());
+  EXPECT_TRUE(openstudio::sum({TimeSeries(), halfHourly}).values().empty());
+  EXPECT_TRUE(openstudio::sum(TimeSeriesVector()).values().empty());
+}
+
+TEST_F(DataFixture, DISABLED_TimeSeries_ExprBenchmark)
+{
+  // sums of hourly series, as a chain of operators and as one expression
+  TimeSeriesVector series;
+  DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 1, 0, 0));
+  for (unsigned k = 0; k < 500; ++k) {
+    Vector values(8760);
+    for (unsigned i = 0; i < 8760; ++i) {
+      values(i) = (i + k) % 17;
+    }
+    series.push_back(TimeSeries(firstReportDateTime, Time(0, 1, 0, 0), values, "W"));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  TimeSeries chained = series.front();
+  for (unsigned k = 1; k < 10; ++k) {
+    chained = chained + series[k];
+  }
+  double chainedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  TimeSeriesExpr expr;
+  for (unsigned k = 0; k < 10; ++k) {
+    expr.add(series[k]);
+  }
+  TimeSeries fused = expr.evaluate();
+  double fusedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  for (unsigned i = 0; i < 8760; i += 97) {
+    EXPECT_DOUBLE_EQ(chained.values(i), fused.values(i));
+  }
+  std::cout << "Summed 10 series with operator+ in " << chainedSeconds << " s, with TimeSeriesExpr in " << fusedSeconds << " s" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  TimeSeries total = openstudio::sum(series);
+  std::cout << "Summed 500 series with sum in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s" << std::endl;
+
+  start = std::chrono::steady_clock::now();
+  TimeSeriesExpr all;
+  for (const TimeSeries& ts : series) {
+    all.add(ts);
+  }
+  TimeSeries threaded = all.evaluate(0);
+  std::cout << "Summed 500 series with TimeSeriesExpr on all cores in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s" << std::endl;
+  EXPECT_EQ(total.values(8759), threaded.values(8759));
+}
+
 TEST_F(DataFixture, TimeSeries_Yearly)
 {
   std::string units = "W";
@@ -32,6 +32,9 @@
 
 #include "../Vector.hpp"
 
+#include <chrono>
+#include <iostream>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -92,6 +95,34 @@ TEST_F(DataFixture,Vector_Interp)
 
 }
 
+TEST_F(DataFixture,Vector_InterpVector)
+{
+  Vector x = linspace(0.0, 10.0, 11);
+  Vector y(11);
+  for (unsigned i = 0; i < 11; ++i){
+    y(i) = i*i;
+  }
+
+  // increasing points, with repeats and points out of range
+  Vector xi = linspace(-1.0, 11.0, 49);
+  Vector yi = interp(x, y, xi, LinearInterp, NearestExtrap);
+  ASSERT_EQ(xi.size(), yi.size());
+  for (unsigned i = 0; i < xi.size(); ++i){
+    EXPECT_DOUBLE_EQ(interp(x, y, xi(i), LinearInterp, NearestExtrap), yi(i));
+  }
+
+  // points in any order
+  Vector unordered(4);
+  unordered(0) = 7.5; unordered(1) = 0.5; unordered(2) = 9.9; unordered(3) = 3.0;
+  for (InterpMethod method : {LinearInterp, NearestInterp, HoldLastInterp, HoldNextInterp}){
+    Vector result = interp(x, y, unordered, method, NoneExtrap);
+    ASSERT_EQ(4u, result.size());
+    for (unsigned i = 0; i < 4; ++i){
+      EXPECT_DOUBLE_EQ(interp(x, y, unordered(i), method, NoneExtrap), result(i));
+    }
+  }
+}
+
 TEST_F(DataFixture,Vector_Linspace)
 {
   Vector vector = linspace(1, 3, 3);
@@ -202,3 +233,56 @@ TEST_F(DataFixture,Vector_Statistics_MixedPositive)
   EXPECT_DOUBLE_EQ(sqrt(11.0), stdDev(vector));
 }
 
+
+TEST_F(DataFixture,DISABLED_Vector_Benchmark)
+{
+  Vector x = linspace(0.0, 8759.0, 8760);
+  Vector y = randVector(0.0, 1.0, 8760);
+  Vector xi = linspace(0.0, 8759.0, 100000);
+
+  // interp at each point separately and over the whole vector of points
+  auto start = std::chrono::steady_clock::now();
+  Vector pointwise(xi.size());
+  for (unsigned i = 0; i < xi.size(); ++i){
+    pointwise(i) = interp(x, y, xi(i));
+  }
+  double pointwiseSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  start = std::chrono::steady_clock::now();
+  Vector batch = interp(x, y, xi);
+  double batchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_TRUE(pointwise == batch);
+  std::cout << "interp of 100000 points: " << pointwiseSeconds << " s one at a time, " << batchSeconds << " s as a Vector" << std::endl;
+
+  // reductions over one million values, repeated
+  Vector a = randVector(0.0, 1.0, 1000000);
+  Vector b = randVector(0.0, 1.0, 1000000);
+  double ublasTotal = 0.0;
+  start = std::chrono::steady_clock::now();
+  for (unsigned n = 0; n < 100; ++n){
+    ublasTotal += boost::numeric::ublas::inner_prod(a, b);
+  }
+  double ublasSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  start = std::chrono::steady_clock::now();
+  double total = 0.0;
+  for (unsigned n = 0; n < 100; ++n){
+    total += dot(a, b);
+  }
+  double dotSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_NEAR(ublasTotal, total, 1.0e-9 * ublasTotal);
+  std::cout << "100 dot products of 1000000 values: " << ublasSeconds << " s with ublas, " << dotSeconds << " s with dot" << std::endl;
+
+  ublasTotal = 0.0;
+  start = std::chrono::steady_clock::now();
+  for (unsigned n = 0; n < 100; ++n){
+    ublasTotal += boost::numeric::ublas::sum(a) + *std::max_element(a.begin(), a.end());
+  }
+  ublasSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  total = 0.0;
+  start = std::chrono::steady_clock::now();
+  for (unsigned n = 0; n < 100; ++n){
+    total += sum(a) + maximum(a);
+  }
+  double sumSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_NEAR(ublasTotal, total, 1.0e-9 * ublasTotal);
+  std::cout << "100 sums and maximums of 1000000 values: " << ublasSeconds << " s with ublas and std::max_element, " << sumSeconds << " s with sum and maximum" << std::endl;
+}
@@ -30,6 +30,10 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <thread>
+
 
 using namespace std;
 using namespace boost;
@@ -38,34 +42,26 @@ namespace openstudio{
 
 namespace detail{
 
-TimeSeries_Impl::TimeSeries_Impl() :m_outOfRangeValue(0.0)
+TimeSeries_Impl::TimeSeries_Impl() : m_secondsPerInterval(0), m_outOfRangeValue(0.0)
 {}
 
 TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsPerInterval(intervalLength.totalSeconds()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (values.empty()) {
     LOG(Warn, "Creating empty timeseries");
   }
 
-  // length of interval in seconds
-  int secondsPerInterval = intervalLength.totalSeconds();
-
   // date and time of first report, end of the first reporting interval
   // DLM: startDate may or may not have baseYear defined
   m_firstReportDateTime = DateTime(startDate, intervalLength);
 
   m_startDateTime = DateTime(startDate, Time(0));
 
-  for (unsigned i = 0; i < values.size(); ++i) {
-    m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
-  }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+  // the times of a fixed interval series are computed from the interval rather than stored
   long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
+  if (!m_values.empty()) {
+    durationSeconds = secondsFromFirstReportAt(m_values.size() - 1);
   }
 
   // check for wrap around
@@ -80,29 +76,21 @@ TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLeng
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsPerInterval(intervalLength.totalSeconds()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (values.empty()) {
     LOG(Warn, "Creating empty timeseries");
   }
 
-  // length of interval in seconds
-  int secondsPerInterval = intervalLength.totalSeconds();
-
   // DLM: startDate may or may not have baseYear defined
   m_firstReportDateTime = DateTime(firstReportDateTime.date(), firstReportDateTime.time());
 
   m_startDateTime = m_firstReportDateTime - intervalLength;
 
-  for (unsigned i = 0; i < values.size(); ++i) {
-    m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
-  }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+  // the times of a fixed interval series are computed from the interval rather than stored
   long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
+  if (!m_values.empty()) {
+    durationSeconds = secondsFromFirstReportAt(m_values.size() - 1);
   }
 
   // check for wrap around
@@ -117,7 +105,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_secondsPerInterval(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (timeInDays.size() != values.size()) {
     LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
@@ -184,7 +172,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values, const std::string& units)
-  : m_secondsFromFirstReport(timeInDays.size()), m_secondsFromStart(values.size()), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(timeInDays.size()), m_secondsFromStart(values.size()), m_secondsPerInterval(0), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
 
   if (timeInDays.size() != values.size()) {
@@ -252,7 +240,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_secondsPerInterval(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   // DLM: this seems to be a pretty fragile constructor with a lot going on
 
@@ -362,7 +350,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_secondsPerInterval(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (timeInSeconds.size() != values.size()) {
     LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInSeconds.size() << ")");
@@ -430,11 +418,32 @@ OptionalTime TimeSeries_Impl::intervalLength() const
   return m_intervalLength;
 }
 
+bool TimeSeries_Impl::isCompact() const
+{
+  return m_intervalLength.is_initialized();
+}
+
+long TimeSeries_Impl::secondsFromFirstReportAt(unsigned i) const
+{
+  if (isCompact()) {
+    return i*m_secondsPerInterval;
+  }
+  return m_secondsFromFirstReport[i];
+}
+
+long TimeSeries_Impl::secondsFromStartAt(unsigned i) const
+{
+  if (isCompact()) {
+    return (i + 1)*m_secondsPerInterval;
+  }
+  return m_secondsFromStart[i];
+}
+
 DateTimeVector TimeSeries_Impl::dateTimes() const
 {
-  DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+  DateTimeVector dateTimeObjs(m_values.size());
+  for (unsigned i = 0; i < m_values.size(); i++) {
+    dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, secondsFromFirstReportAt(i));
   }
   return dateTimeObjs;
 }
@@ -442,9 +451,9 @@ DateTimeVector TimeSeries_Impl::dateTimes() const
 /// time in days from end of the first reporting interval
 Vector TimeSeries_Impl::daysFromFirstReport() const
 {
-  Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  Vector daysFromFirstReport(m_values.size());
+  for (unsigned i = 0; i < m_values.size(); i++) {
+    daysFromFirstReport[i] = Time(0, 0, 0, secondsFromFirstReportAt(i)).totalDays();
   }
   return daysFromFirstReport;
 }
@@ -453,8 +462,8 @@ Vector TimeSeries_Impl::daysFromFirstReport() const
 double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 {
   double value = m_outOfRangeValue;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  if (i < m_values.size()) {
+    value = Time(0, 0, 0, secondsFromFirstReportAt(i)).totalDays();
   }
   return value;
 }
@@ -462,6 +471,13 @@ double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 /// time in seconds from end of the first reporting interval
 std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const
 {
+  if (isCompact()) {
+    std::vector<long> result(m_values.size());
+    for (unsigned i = 0; i < m_values.size(); i++) {
+      result[i] = secondsFromFirstReportAt(i);
+    }
+    return result;
+  }
   return m_secondsFromFirstReport;
 }
 
@@ -470,8 +486,8 @@ long TimeSeries_Impl::secondsFromFirstReport(const unsigned& i) const
 {
   //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
   long value = 0;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = m_secondsFromFirstReport[i];
+  if (i < m_values.size()) {
+    value = secondsFromFirstReportAt(i);
   }
   return value;
 }
@@ -509,12 +525,12 @@ double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstRepor
 {
   double result = m_outOfRangeValue;
 
-  if (m_secondsFromFirstReport.empty()) {
+  if (m_values.empty()) {
     LOG(Debug, "Cannot compute value because timeseries is empty");
     return result;
   }
 
-  long duration = m_secondsFromFirstReport.back();
+  long duration = secondsFromFirstReportAt(m_values.size() - 1);
 
   if (m_intervalLength) {
 
@@ -665,13 +681,14 @@ Vector TimeSeries_Impl::values(const DateTime& startDateTime, const DateTime& en
   double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
   unsigned numValues = m_values.size();
-  OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+  OS_ASSERT(isCompact() || numValues == m_secondsFromFirstReport.size());
 
   Vector result(numValues);
   unsigned resultSize = 0;
   for (unsigned i = 0; i < numValues; ++i) {
-    if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) &&
-      (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
+    long secondsFromFirstReport = secondsFromFirstReportAt(i);
+    if ((secondsFromFirstReport >= startSecondsFromFirstReport) &&
+      (secondsFromFirstReport <= endSecondsFromFirstReport)) {
       result[resultSize] = m_values[i];
       ++resultSize;
     }
@@ -811,12 +828,127 @@ double TimeSeries_Impl::integrate() const
 
 double TimeSeries_Impl::averageValue() const
 {
-  if (m_secondsFromStart.size() > 0) {
-    return integrate() / m_secondsFromStart.back();
+  if (m_values.size() > 0) {
+    return integrate() / secondsFromStartAt(m_values.size() - 1);
   }
   return 0;
 }
 
+openstudio::DateTime TimeSeries_Impl::startDateTime() const
+{
+  return m_startDateTime;
+}
+
+double TimeSeries_Impl::aggregate(unsigned begin, unsigned end, const TimeSeriesAggregation& method) const
+{
+  OS_ASSERT(begin < end);
+  const double* values = &m_values[0];
+  double result = values[begin];
+  switch (method.value()) {
+    case TimeSeriesAggregation::Mean:
+    case TimeSeriesAggregation::Sum:
+      result = 0.0;
+      for (unsigned i = begin; i < end; ++i) {
+        result += values[i];
+      }
+      if (method == TimeSeriesAggregation::Mean) {
+        result /= (end - begin);
+      }
+      break;
+    case TimeSeriesAggregation::Max:
+      for (unsigned i = begin + 1; i < end; ++i) {
+        result = std::max(result, values[i]);
+      }
+      break;
+    case TimeSeriesAggregation::Min:
+      for (unsigned i = begin + 1; i < end; ++i) {
+        result = std::min(result, values[i]);
+      }
+      break;
+    default: // First
+      break;
+  }
+  return result;
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::resample(const Time& intervalLength, const TimeSeriesAggregation& method) const
+{
+  long secondsPerInterval = intervalLength.totalSeconds();
+  if (secondsPerInterval <= 0) {
+    LOG_AND_THROW("Cannot resample to an interval of " << intervalLength);
+  }
+
+  unsigned numValues = m_values.size();
+  if (numValues == 0) {
+    LOG(Warn, "Resampling an empty timeseries returns an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  // The times are sorted, so the values reported in each interval are a contiguous range and one pass over them
+  // finds all of the ranges. A value reported at the end of an interval belongs to that interval.
+  long firstIntervalSeconds = secondsFromStartAt(0);
+  unsigned numIntervals = (secondsFromStartAt(numValues - 1) - 1) / secondsPerInterval + 1;
+  Vector values(numIntervals);
+  unsigned begin = 0;
+  for (unsigned interval = 0; interval < numIntervals; ++interval) {
+    long intervalEnd = (interval + 1)*secondsPerInterval;
+    unsigned end = begin;
+    while (end < numValues && secondsFromStartAt(end) <= intervalEnd) {
+      ++end;
+    }
+    if (end > begin) {
+      values[interval] = aggregate(begin, end, method);
+    } else {
+      values[interval] = valueAtSecondsFromFirstReport(intervalEnd - firstIntervalSeconds);
+    }
+    begin = end;
+  }
+
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_startDateTime + intervalLength, intervalLength, values, m_units));
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::aggregateByMonth(const TimeSeriesAggregation& method) const
+{
+  unsigned numValues = m_values.size();
+  if (numValues == 0) {
+    LOG(Warn, "Aggregating an empty timeseries returns an empty timeseries");
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  // month of the first value, a report at midnight closes the previous day
+  DateTime firstReportInterval = m_firstReportDateTime - Time(0, 0, 0, 1);
+  int month = firstReportInterval.date().monthOfYear().value();
+  int year = firstReportInterval.date().year();
+  long firstIntervalSeconds = secondsFromStartAt(0);
+
+  DateTimeVector dateTimes(1, m_startDateTime);
+  std::vector<double> values;
+  unsigned begin = 0;
+  while (begin < numValues) {
+    if (month == 12) {
+      month = 1;
+      ++year;
+    } else {
+      ++month;
+    }
+    DateTime monthEnd(Date(MonthOfYear(month), 1, year));
+    long monthEndSeconds = (monthEnd - m_startDateTime).totalSeconds();
+    unsigned end = begin;
+    while (end < numValues && secondsFromStartAt(end) <= monthEndSeconds) {
+      ++end;
+    }
+    if (end > begin) {
+      values.push_back(aggregate(begin, end, method));
+    } else {
+      values.push_back(valueAtSecondsFromFirstReport(monthEndSeconds - firstIntervalSeconds));
+    }
+    dateTimes.push_back(monthEnd);
+    begin = end;
+  }
+
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, createVector(values), m_units));
+}
+
 } // detail
 
 TimeSeries::TimeSeries() :
@@ -862,6 +994,11 @@ openstudio::DateTime TimeSeries::firstReportDateTime() const
   return m_impl->firstReportDateTime();
 }
 
+openstudio::DateTime TimeSeries::startDateTime() const
+{
+  return m_impl->startDateTime();
+}
+
 openstudio::Vector TimeSeries::daysFromFirstReport() const
 {
   return m_impl->daysFromFirstReport();
@@ -961,6 +1098,16 @@ double TimeSeries::averageValue() const
   return m_impl->averageValue();
 }
 
+TimeSeries TimeSeries::resample(const Time& intervalLength, const TimeSeriesAggregation& method) const
+{
+  return TimeSeries(m_impl->resample(intervalLength, method));
+}
+
+TimeSeries TimeSeries::aggregateByMonth(const TimeSeriesAggregation& method) const
+{
+  return TimeSeries(m_impl->aggregateByMonth(method));
+}
+
 TimeSeries::TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl)
   : m_impl(impl)
 {}
@@ -972,16 +1119,308 @@ TimeSeries operator*(double d, const TimeSeries& series)
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector)
 {
-  TimeSeries result;
-  bool first = true;
+  if (timeSeriesVector.empty()) {
+    return TimeSeries();
+  }
+  if (timeSeriesVector.size() == 1u) {
+    return timeSeriesVector.front();
+  }
+  if (timeSeriesVector.front().values().empty()) {
+    LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
+      << "units are incompatible.");
+    return timeSeriesVector.front();
+  }
+
+  TimeSeriesExpr expr;
   for (const TimeSeries& ts : timeSeriesVector) {
-    if (first) { result = ts; } else { result = result + ts; }
-    if (result.values().empty()) {
-      LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
-        << "units are incompatible.");
-      break;
+    expr.add(ts);
+  }
+  TimeSeries result = expr.evaluate();
+  if (result.values().empty()) {
+    LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
+      << "units are incompatible.");
+    return result;
+  }
+
+  // a sum of series has always been reported at its times rather than on an interval, as operator+ does
+  if (OptionalTime intervalLength = result.intervalLength()) {
+    std::vector<long> secondsFromStart = result.secondsFromFirstReport();
+    long intervalSeconds = intervalLength->totalSeconds();
+    for (long& seconds : secondsFromStart) {
+      seconds += intervalSeconds;
+    }
+    result = TimeSeries(result.firstReportDateTime(), secondsFromStart, result.values(), result.units());
+  }
+  return result;
+}
+
+namespace {
+
+  // report times of each series in seconds from the earliest start of the series, and their sorted union
+  struct CommonTimeAxis
+  {
+    DateTime start;
+    std::vector<std::vector<long> > times;
+    std::vector<long> axis;
+  };
+
+  bool commonTimeAxis(const std::vector<const TimeSeries*>& series, CommonTimeAxis& result)
+  {
+    boost::optional<DateTime> start;
+    for (const TimeSeries* ts : series) {
+      if (!ts->values().empty() && (!start || ts->startDateTime() < *start)) {
+        start = ts->startDateTime();
+      }
+    }
+    if (!start) {
+      return false;
+    }
+
+    result.start = *start;
+    result.times.clear();
+    result.axis.clear();
+    for (const TimeSeries* ts : series) {
+      std::vector<long> seconds = ts->secondsFromFirstReport();
+      long offset = (ts->firstReportDateTime() - *start).totalSeconds();
+      for (long& s : seconds) {
+        s += offset;
+      }
+      std::vector<long> merged;
+      merged.reserve(result.axis.size() + seconds.size());
+      std::set_union(result.axis.begin(), result.axis.end(), seconds.begin(), seconds.end(), std::back_inserter(merged));
+      result.axis.swap(merged);
+      result.times.push_back(std::move(seconds));
+    }
+    result.axis.erase(std::unique(result.axis.begin(), result.axis.end()), result.axis.end());
+    return true;
+  }
+
+  // adds weight times the value of a series at axis[begin, end) to out, taking the next reported value as value() does
+  void accumulateOnAxis(const TimeSeries& ts, const Vector& values, const std::vector<long>& seconds,
+                        const std::vector<long>& axis, double weight, unsigned begin, unsigned end, double* out)
+  {
+    long earliest = seconds.empty() ? 0 : seconds.front();
+    OptionalTime intervalLength = ts.intervalLength();
+    if (intervalLength) {
+      earliest -= intervalLength->totalSeconds() - 1;
+    }
+    double outOfRange = weight * ts.outOfRangeValue();
+    unsigned j = std::lower_bound(seconds.begin(), seconds.end(), axis[begin]) - seconds.begin();
+    for (unsigned i = begin; i < end; ++i) {
+      while (j < seconds.size() && seconds[j] < axis[i]) {
+        ++j;
+      }
+      if (j == seconds.size() || axis[i] < earliest) {
+        out[i] += outOfRange;
+      } else {
+        out[i] += weight * values[j];
+      }
+    }
+  }
+
+  // runs f(begin, end) over chunks of [0, n) on up to numThreads threads
+  template <class F>
+  void forEachChunk(unsigned n, unsigned numThreads, F f)
+  {
+    // below this many values per thread the threads cost more than they save
+    const unsigned minChunkSize = 4096;
+    if (numThreads == 0) {
+      numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    unsigned numChunks = std::max(1u, std::min(numThreads, n / minChunkSize));
+    if (numChunks == 1) {
+      f(0u, n);
+      return;
     }
-    first = false;
+    unsigned chunkSize = (n + numChunks - 1) / numChunks;
+    std::vector<std::thread> threads;
+    for (unsigned begin = chunkSize; begin < n; begin += chunkSize) {
+      threads.emplace_back(f, begin, std::min(n, begin + chunkSize));
+    }
+    f(0u, std::min(n, chunkSize));
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+} // namespace
+
+std::vector<TimeSeries> alignTimeSeries(const std::vector<TimeSeries>& timeSeriesVector)
+{
+  std::vector<const TimeSeries*> series;
+  for (const TimeSeries& ts : timeSeriesVector) {
+    series.push_back(&ts);
+  }
+  CommonTimeAxis common;
+  if (!commonTimeAxis(series, common)) {
+    return timeSeriesVector;
+  }
+
+  // walk each series along the axis
+  std::vector<TimeSeries> result;
+  result.reserve(timeSeriesVector.size());
+  const std::vector<long>& axis = common.axis;
+  DateTime firstReportDateTime = common.start + Time(0, 0, 0, axis.front());
+  for (unsigned k = 0; k < timeSeriesVector.size(); ++k) {
+    const TimeSeries& ts = timeSeriesVector[k];
+    Vector values(axis.size(), 0.0);
+    accumulateOnAxis(ts, ts.values(), common.times[k], axis, 1.0, 0, axis.size(), &values[0]);
+    TimeSeries aligned(firstReportDateTime, axis, values, ts.units());
+    aligned.setOutOfRangeValue(ts.outOfRangeValue());
+    result.push_back(aligned);
+  }
+  return result;
+}
+
+TimeSeriesExpr::TimeSeriesExpr()
+{}
+
+TimeSeriesExpr::TimeSeriesExpr(const TimeSeries& series)
+{
+  add(series);
+}
+
+TimeSeriesExpr& TimeSeriesExpr::add(const TimeSeries& series, double weight)
+{
+  m_terms.push_back(std::make_pair(series, weight));
+  return *this;
+}
+
+TimeSeriesExpr& TimeSeriesExpr::operator+=(const TimeSeriesExpr& other)
+{
+  m_terms.insert(m_terms.end(), other.m_terms.begin(), other.m_terms.end());
+  return *this;
+}
+
+TimeSeriesExpr& TimeSeriesExpr::operator-=(const TimeSeriesExpr& other)
+{
+  for (const auto& term : other.m_terms) {
+    m_terms.push_back(std::make_pair(term.first, -term.second));
+  }
+  return *this;
+}
+
+TimeSeriesExpr& TimeSeriesExpr::operator*=(double d)
+{
+  for (auto& term : m_terms) {
+    term.second *= d;
+  }
+  return *this;
+}
+
+TimeSeriesExpr& TimeSeriesExpr::operator/=(double d)
+{
+  for (auto& term : m_terms) {
+    term.second /= d;
+  }
+  return *this;
+}
+
+unsigned TimeSeriesExpr::numTerms() const
+{
+  return m_terms.size();
+}
+
+TimeSeries TimeSeriesExpr::evaluate(unsigned numThreads) const
+{
+  if (m_terms.empty()) {
+    return TimeSeries();
+  }
+
+  const TimeSeries& first = m_terms.front().first;
+  std::string units = first.units();
+  for (const auto& term : m_terms) {
+    if (term.first.units() != units) {
+      LOG(Warn, "Combining timeseries with different units returns an empty timeseries");
+      return TimeSeries();
+    }
+  }
+
+  std::vector<Vector> values;
+  values.reserve(m_terms.size());
+  for (const auto& term : m_terms) {
+    values.push_back(term.first.values());
+  }
+
+  // series on the same fixed intervals are combined element by element
+  OptionalTime intervalLength = first.intervalLength();
+  bool sameIntervals = !values.front().empty();
+  for (unsigned k = 1; sameIntervals && k < m_terms.size(); ++k) {
+    const TimeSeries& ts = m_terms[k].first;
+    OptionalTime otherIntervalLength = ts.intervalLength();
+    sameIntervals = intervalLength && otherIntervalLength && (*intervalLength == *otherIntervalLength)
+      && (ts.firstReportDateTime() == first.firstReportDateTime()) && (values[k].size() == values.front().size());
+  }
+  if (sameIntervals) {
+    unsigned n = values.front().size();
+    Vector result(n, 0.0);
+    double* out = &result[0];
+    forEachChunk(n, numThreads, [&](unsigned begin, unsigned end) {
+      for (unsigned k = 0; k < m_terms.size(); ++k) {
+        double weight = m_terms[k].second;
+        const double* in = &values[k][0];
+        for (unsigned i = begin; i < end; ++i) {
+          out[i] += weight * in[i];
+        }
+      }
+    });
+    return TimeSeries(first.firstReportDateTime(), *intervalLength, result, units);
+  }
+
+  // otherwise every series is walked along the union of their report times
+  std::vector<const TimeSeries*> series;
+  for (const auto& term : m_terms) {
+    series.push_back(&term.first);
+  }
+  CommonTimeAxis common;
+  if (!commonTimeAxis(series, common)) {
+    return TimeSeries();
+  }
+  const std::vector<long>& axis = common.axis;
+  Vector result(axis.size(), 0.0);
+  double* out = &result[0];
+  forEachChunk(axis.size(), numThreads, [&](unsigned begin, unsigned end) {
+    for (unsigned k = 0; k < m_terms.size(); ++k) {
+      accumulateOnAxis(m_terms[k].first, values[k], common.times[k], axis, m_terms[k].second, begin, end, out);
+    }
+  });
+  return TimeSeries(common.start + Time(0, 0, 0, axis.front()), axis, result, units);
+}
+
+TimeSeriesExpr operator+(TimeSeriesExpr lhs, const TimeSeriesExpr& rhs)
+{
+  return lhs += rhs;
+}
+
+TimeSeriesExpr operator-(TimeSeriesExpr lhs, const TimeSeriesExpr& rhs)
+{
+  return lhs -= rhs;
+}
+
+TimeSeriesExpr operator*(TimeSeriesExpr expr, double d)
+{
+  return expr *= d;
+}
+
+TimeSeriesExpr operator*(double d, TimeSeriesExpr expr)
+{
+  return expr *= d;
+}
+
+TimeSeriesExpr operator/(TimeSeriesExpr expr, double d)
+{
+  return expr /= d;
+}
+
+TimeSeriesExpr weightedSum(const std::vector<TimeSeries>& timeSeriesVector, const std::vector<double>& weights)
+{
+  if (timeSeriesVector.size() != weights.size()) {
+    LOG_FREE_AND_THROW("openstudio.TimeSeriesExpr", "Number of weights (" << weights.size()
+      << ") must match number of timeseries (" << timeSeriesVector.size() << ")");
+  }
+  TimeSeriesExpr result;
+  for (unsigned i = 0; i < timeSeriesVector.size(); ++i) {
+    result.add(timeSeriesVector[i], weights[i]);
   }
   return result;
 }
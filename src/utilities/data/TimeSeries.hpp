@@ -33,6 +33,7 @@
 #include "../UtilitiesAPI.hpp"
 
 #include "Vector.hpp"
+#include "DataEnums.hpp"
 #include "../time/Date.hpp"
 #include "../time/Time.hpp"
 #include "../time/DateTime.hpp"
@@ -110,9 +111,26 @@ public:
 
   double averageValue() const;
 
+  openstudio::DateTime startDateTime() const;
+
+  std::shared_ptr<TimeSeries_Impl> resample(const Time& intervalLength, const TimeSeriesAggregation& method) const;
+
+  std::shared_ptr<TimeSeries_Impl> aggregateByMonth(const TimeSeriesAggregation& method) const;
+
 private:
 
+  // combines the values with index in [begin, end), which must not be empty
+  double aggregate(unsigned begin, unsigned end, const TimeSeriesAggregation& method) const;
+
   REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+  // true if the series has a fixed interval, in which case the time arrays below are not stored
+  bool isCompact() const;
+
+  // seconds from first report and from start at index i, computed from the interval for a compact series
+  long secondsFromFirstReportAt(unsigned i) const;
+  long secondsFromStartAt(unsigned i) const;
+
   // fully qualified first report date
   DateTime m_firstReportDateTime;
 
@@ -120,10 +138,14 @@ private:
   DateTime m_startDateTime;
 
   // integer seconds from first report date time, used for quick interpolation
+  // these are left empty for a fixed interval series, see isCompact
   std::vector<long> m_secondsFromFirstReport;
   Vector m_secondsFromFirstReportAsVector; // same as m_secondsFromFirstReport but stored as Vector
   std::vector<long> m_secondsFromStart;
 
+  // length of the reporting interval in seconds for a fixed interval series
+  long m_secondsPerInterval;
+
   // values reported at m_dateTimes
   Vector m_values;
 
@@ -230,6 +252,9 @@ public:
   /// Returns the date and time of first report value
   openstudio::DateTime firstReportDateTime() const;
 
+  /// Returns the date and time of the start of the series, the beginning of the first reporting interval
+  openstudio::DateTime startDateTime() const;
+
   /// Returns the vector of time in days from end of the first reporting interval
   openstudio::Vector daysFromFirstReport() const;
 
@@ -299,6 +324,15 @@ public:
   /** Compute the time series average value */
   double averageValue() const;
 
+  /** Resample the time series to a fixed interval. The intervals are counted from the start of the series, and each
+   *  value is combined with the others reported in the same interval using method. An interval in which no value is
+   *  reported takes the value of the series at the end of that interval, as returned by value(). */
+  TimeSeries resample(const Time& intervalLength, const TimeSeriesAggregation& method = TimeSeriesAggregation::Mean) const;
+
+  /** Combine the values reported in each calendar month using method. The result reports one value at the end of each
+   *  month, a value reported at midnight belongs to the day that ends at that time. */
+  TimeSeries aggregateByMonth(const TimeSeriesAggregation& method = TimeSeriesAggregation::Mean) const;
+
   //@}
 private:
 
@@ -323,9 +357,80 @@ UTILITIES_API TimeSeries operator*(double d, const TimeSeries& series);
 // We should be able to tackle double/TimeSeries after adding get/setQuantity to
 // IdfObject.
 
-// Helper function to add up all the TimeSeries in timeSeriesVector.
+// Helper function to add up all the TimeSeries in timeSeriesVector, evaluated in one pass as a TimeSeriesExpr. As with
+// operator+, the sum is reported at its times without an interval length, one series is returned as it is and an empty
+// first series gives an empty sum.
 UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
 
+/** Put the TimeSeries in timeSeriesVector on a common time axis, the union of the times at which they report values.
+ *  Each returned series has the value that value() gives at each of those times, so series that do not cover a time
+ *  have their out of range value there. The series are walked together in one pass, without a query per point. */
+UTILITIES_API std::vector<TimeSeries> alignTimeSeries(const std::vector<TimeSeries>& timeSeriesVector);
+
+/** TimeSeriesExpr is a lazily evaluated weighted sum of TimeSeries. Adding, subtracting and scaling expressions only
+ *  records the series and their weights, evaluate() then computes the result in a single pass into one vector of values,
+ *  rather than building an intermediate TimeSeries for each operation. The result has the value that the same
+ *  combination of value() gives at each time any of the series reports a value. */
+class UTILITIES_API TimeSeriesExpr
+{
+public:
+
+  /** @name Constructors */
+  //@{
+
+  /// Empty expression, evaluates to an empty TimeSeries
+  TimeSeriesExpr();
+
+  /// Expression holding series with a weight of one
+  TimeSeriesExpr(const TimeSeries& series);
+
+  //@}
+  /** @name Setters */
+  //@{
+
+  /// Add weight * series to the expression
+  TimeSeriesExpr& add(const TimeSeries& series, double weight = 1.0);
+
+  TimeSeriesExpr& operator+=(const TimeSeriesExpr& other);
+
+  TimeSeriesExpr& operator-=(const TimeSeriesExpr& other);
+
+  TimeSeriesExpr& operator*=(double d);
+
+  TimeSeriesExpr& operator/=(double d);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  /// Number of weighted series in the expression
+  unsigned numTerms() const;
+
+  /** Evaluate the expression. The values are computed in chunks on up to numThreads threads, zero uses one thread per
+   *  hardware core. Series with different units cannot be combined and give an empty TimeSeries. */
+  TimeSeries evaluate(unsigned numThreads = 1) const;
+
+  //@}
+private:
+
+  REGISTER_LOGGER("utilities.TimeSeriesExpr");
+
+  std::vector<std::pair<TimeSeries, double> > m_terms;
+};
+
+UTILITIES_API TimeSeriesExpr operator+(TimeSeriesExpr lhs, const TimeSeriesExpr& rhs);
+
+UTILITIES_API TimeSeriesExpr operator-(TimeSeriesExpr lhs, const TimeSeriesExpr& rhs);
+
+UTILITIES_API TimeSeriesExpr operator*(TimeSeriesExpr expr, double d);
+
+UTILITIES_API TimeSeriesExpr operator*(double d, TimeSeriesExpr expr);
+
+UTILITIES_API TimeSeriesExpr operator/(TimeSeriesExpr expr, double d);
+
+/** Expression for the sum of weights[i] * timeSeriesVector[i]. Throws if the vectors differ in length. */
+UTILITIES_API TimeSeriesExpr weightedSum(const std::vector<TimeSeries>& timeSeriesVector, const std::vector<double>& weights);
+
 /** Returns std::function pointer to sum(const std::vector<TimeSeries>&). */
 UTILITIES_API boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor();
 
@@ -37,6 +37,102 @@
 
 namespace openstudio{
 
+  namespace {
+
+    // ublas stores a Vector contiguously, the kernels below work on that storage directly so that they avoid the
+    // checked element access and expression templates and the compiler can vectorize the loops
+    inline const double* rawData(const Vector& v)
+    {
+      return v.data().begin();
+    }
+
+    inline double* rawData(Vector& v)
+    {
+      return v.data().begin();
+    }
+
+    // position of xi in x, searched from hint when the points are visited in increasing order
+    InterpInfo interpInfo(const double* x, size_t N, double xi, size_t& hint)
+    {
+      InterpInfo result;
+
+      if (x[0] == xi){
+        result.ia = 0; result.ib = 0; result.wa = 1.0; result.wb = 0.0; result.extrapolated = false;
+      }else if (xi < x[0]){
+        result.ia = 0; result.ib = 0; result.wa = 1.0; result.wb = 0.0; result.extrapolated = true;
+      }else if (x[N-1] == xi){
+        result.ia = N-1; result.ib = N-1; result.wa = 0.0; result.wb = 1.0; result.extrapolated = false;
+      }else if (xi > x[N-1]){
+        result.ia = N-1; result.ib = N-1; result.wa = 0.0; result.wb = 1.0; result.extrapolated = true;
+      }else{
+
+        // ((xi > x(0)) && (xi < x(N-1))), find the first x not less than xi
+        result.extrapolated = false;
+        size_t ib;
+        if ((hint > 0) && (hint < N) && (x[hint-1] < xi)){
+          // a few steps forward, then search the rest
+          ib = hint;
+          for (unsigned step = 0; (step < 8) && (x[ib] < xi); ++step){
+            ++ib;
+          }
+          if (x[ib] < xi){
+            ib = std::lower_bound(x + ib, x + N, xi) - x;
+          }
+        }else{
+          ib = std::lower_bound(x, x + N, xi) - x;
+        }
+        hint = ib;
+
+        result.ia = (unsigned)(ib-1);
+        result.ib = (unsigned)(ib);
+        result.wa = (x[result.ib]-xi)/(x[result.ib]-x[result.ia]);
+        result.wb = (xi-x[result.ia])/(x[result.ib]-x[result.ia]);
+      }
+
+      return result;
+    }
+
+    double interp(const InterpInfo& info, const double* y, InterpMethod interpMethod, ExtrapMethod extrapMethod)
+    {
+      double result = 0.0;
+
+      if (info.extrapolated){
+        switch(extrapMethod){
+          case NoneExtrap:
+            // set to zero
+            result = 0.0;
+            break;
+          case NearestExtrap:
+            // pick closest point
+            result = (info.wa > info.wb ? y[info.ia] : y[info.ib]);
+            break;
+        }
+      }else{
+        switch(interpMethod){
+          case LinearInterp:
+            // linear interpolation
+            result = info.wa*y[info.ia] + info.wb*y[info.ib];
+            break;
+          case NearestInterp:
+            // pick closest point
+            result = (info.wa > info.wb ? y[info.ia] : y[info.ib]);
+            break;
+          case HoldLastInterp:
+            // set to previous value
+            result = y[info.ia];
+            break;
+          case HoldNextInterp:
+            // set to next value
+            result = y[info.ib];
+            break;
+        }
+      }
+
+      return result;
+    }
+
+  } // namespace
+
   Vector createVector(const std::vector<double>& values) {
     size_t n = values.size();
     Vector result(n);
@@ -82,32 +178,8 @@ namespace openstudio{
   /// assumes that x is strictly increasing
   InterpInfo interpInfo(const Vector& x, double xi)
   {
-    size_t N = x.size();
-
-    InterpInfo result;
-
-    if (x(0) == xi){
-      result.ia = 0; result.ib = 0; result.wa = 1.0; result.wb = 0.0; result.extrapolated = false;
-    }else if (xi < x(0)){
-      result.ia = 0; result.ib = 0; result.wa = 1.0; result.wb = 0.0; result.extrapolated = true;
-    }else if (x(N-1) == xi){
-      result.ia = N-1; result.ib = N-1; result.wa = 0.0; result.wb = 1.0; result.extrapolated = false;
-    }else if (xi > x(N-1)){
-      result.ia = N-1; result.ib = N-1; result.wa = 0.0; result.wb = 1.0; result.extrapolated = true;
-    }else{
-
-      // ((xi > x(0)) && (xi < x(N-1)))
-      result.extrapolated = false;
-      Vector::const_iterator begin = x.begin();
-      Vector::const_iterator it = std::lower_bound(begin, x.end(), xi);
-
-      result.ia = (unsigned)(it-begin-1);
-      result.ib = (unsigned)(it-begin);
-      result.wa = (x(result.ib)-xi)/(x(result.ib)-x(result.ia));
-      result.wb = (xi-x(result.ia))/(x(result.ib)-x(result.ia));
-    }
-
-    return result;
+    size_t hint = 0;
+    return interpInfo(rawData(x), x.size(), xi, hint);
   }
 
   /// linear interpolation of the function y = f(x) at point xi
@@ -116,47 +188,12 @@ namespace openstudio{
 
     size_t N = x.size();
 
-    double result = 0.0;
-
     if (y.size() != N){
-      return result;
+      return 0.0;
     }
 
-    InterpInfo info = interpInfo(x, xi);
-
-    if (info.extrapolated){
-      switch(extrapMethod){
-        case NoneExtrap:
-          // set to zero
-          result = 0.0;
-          break;
-        case NearestExtrap:
-          // pick closest point
-          result = (info.wa > info.wb ? y(info.ia) : y(info.ib));
-          break;
-      }
-    }else{
-      switch(interpMethod){
-        case LinearInterp:
-          // linear interpolation
-          result = info.wa*y(info.ia) + info.wb*y(info.ib);
-          break;
-        case NearestInterp:
-          // pick closest point
-          result = (info.wa > info.wb ? y(info.ia) : y(info.ib));
-          break;
-        case HoldLastInterp:
-          // set to previous value
-          result = y(info.ia);
-          break;
-        case HoldNextInterp:
-          // set to next value
-          result = y(info.ib);
-          break;
-      }
-    }
-
-    return result;
+    size_t hint = 0;
+    return interp(interpInfo(rawData(x), N, xi, hint), rawData(y), interpMethod, extrapMethod);
   }
 
   /// linear interpolation of the function y = f(x) at points xi
@@ -164,15 +201,22 @@ namespace openstudio{
   Vector interp(const Vector& x, const Vector& y, const Vector& xi, InterpMethod interpMethod, ExtrapMethod extrapMethod){
 
     size_t N = x.size();
+    size_t Ni = xi.size();
 
-    Vector result(N);
+    Vector result(Ni);
 
     if (y.size() != N){
       return result;
     }
 
-    for (unsigned i = 0; i < N; ++i){
-      result(i) = interp(x, y, xi(i), interpMethod, extrapMethod);
+    // increasing points continue the search from the previous one
+    const double* px = rawData(x);
+    const double* py = rawData(y);
+    const double* pxi = rawData(xi);
+    double* out = rawData(result);
+    size_t hint = 0;
+    for (size_t i = 0; i < Ni; ++i){
+      out[i] = interp(interpInfo(px, N, pxi[i], hint), py, interpMethod, extrapMethod);
     }
 
     return result;
@@ -275,21 +319,54 @@ namespace openstudio{
   /// dot product
   double dot(const Vector& lhs, const Vector& rhs)
   {
-    return boost::numeric::ublas::inner_prod(lhs, rhs);
+    // four partial sums so the loop is not serialized on one accumulator
+    size_t N = std::min(lhs.size(), rhs.size());
+    const double* a = rawData(lhs);
+    const double* b = rawData(rhs);
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    size_t i = 0;
+    for (; i + 4 <= N; i += 4){
+      s0 += a[i]*b[i];
+      s1 += a[i+1]*b[i+1];
+      s2 += a[i+2]*b[i+2];
+      s3 += a[i+3]*b[i+3];
+    }
+    for (; i < N; ++i){
+      s0 += a[i]*b[i];
+    }
+    return (s0 + s1) + (s2 + s3);
   }
 
   /// sum
   double sum(const Vector& vector)
   {
-    return boost::numeric::ublas::sum(vector);
+    size_t N = vector.size();
+    const double* a = rawData(vector);
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    size_t i = 0;
+    for (; i + 4 <= N; i += 4){
+      s0 += a[i];
+      s1 += a[i+1];
+      s2 += a[i+2];
+      s3 += a[i+3];
+    }
+    for (; i < N; ++i){
+      s0 += a[i];
+    }
+    return (s0 + s1) + (s2 + s3);
   }
 
   /// maximum
   double maximum(const Vector& vector)
   {
     double max = 0;
-    if (vector.size() > 0){
-      max = *std::max_element(vector.begin(), vector.end());
+    size_t N = vector.size();
+    if (N > 0){
+      const double* a = rawData(vector);
+      max = a[0];
+      for (size_t i = 1; i < N; ++i){
+        max = (a[i] > max) ? a[i] : max;
+      }
     }
     return max;
   }
@@ -298,8 +375,13 @@ namespace openstudio{
   double minimum(const Vector& vector)
   {
     double min = 0;
-    if (vector.size() > 0){
-      min = *std::min_element(vector.begin(), vector.end());
+    size_t N = vector.size();
+    if (N > 0){
+      const double* a = rawData(vector);
+      min = a[0];
+      for (size_t i = 1; i < N; ++i){
+        min = (a[i] < min) ? a[i] : min;
+      }
     }
     return min;
   }
@@ -322,7 +404,7 @@ namespace openstudio{
     size_t N = vector.size();
     if (N > 0)
     {
-      double sumSquares = pow(boost::numeric::ublas::norm_2(vector), 2.0);
+      double sumSquares = dot(vector, vector);
       result = sumSquares/N - pow(mean(vector), 2);
     }
     return result;
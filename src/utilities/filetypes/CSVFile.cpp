@@ -38,85 +38,365 @@
 #include "../time/DateTime.hpp"
 
 #include <iostream>
+#include <cstdlib>
+#include <climits>
 
-#include <boost/regex.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 
 namespace openstudio{
 namespace detail{
 
+  namespace {
+
+    /** Splits [begin, end) into fields with a single pass state machine. Handler::field(columnIndex, begin, end,
+     *  quoted, hasEscapedQuotes) is called for each field and Handler::endRow() at the end of each row. Quoted
+     *  fields may contain delimiters, newlines and doubled quotes. A trailing newline does not start a new row. */
+    template <typename Handler>
+    void tokenize(const char* begin, const char* end, char delimiter, Handler& handler)
+    {
+      enum State { FieldStart, Unquoted, Quoted, QuoteInQuoted };
+
+      State state = FieldStart;
+      unsigned columnIndex = 0;
+      const char* fieldBegin = begin;
+      const char* fieldEnd = begin;
+      bool hasEscapedQuotes = false;
+      bool inRow = false;
+
+      auto endField = [&](bool quoted) {
+        handler.field(columnIndex, fieldBegin, fieldEnd, quoted, hasEscapedQuotes);
+        ++columnIndex;
+        hasEscapedQuotes = false;
+      };
+
+      auto endRow = [&](bool quoted) {
+        endField(quoted);
+        handler.endRow();
+        columnIndex = 0;
+        inRow = false;
+      };
+
+      for (const char* c = begin; c != end; ++c) {
+        // treat \r\n as \n outside of quotes
+        if ((*c == '\r') && (state != Quoted) && (c + 1 != end) && (*(c + 1) == '\n')) {
+          if (state == Unquoted) {
+            fieldEnd = c;
+          }
+          continue;
+        }
+
+        inRow = true;
+        switch (state) {
+        case FieldStart:
+          if (*c == '"') {
+            state = Quoted;
+            fieldBegin = c + 1;
+            fieldEnd = fieldBegin;
+          } else if (*c == delimiter) {
+            fieldBegin = fieldEnd = c;
+            endField(false);
+          } else if (*c == '\n') {
+            fieldBegin = fieldEnd = c;
+            endRow(false);
+          } else {
+            state = Unquoted;
+            fieldBegin = c;
+            fieldEnd = c + 1;
+          }
+          break;
+        case Unquoted:
+          if (*c == delimiter) {
+            endField(false);
+            state = FieldStart;
+          } else if (*c == '\n') {
+            endRow(false);
+            state = FieldStart;
+          } else {
+            fieldEnd = c + 1;
+          }
+          break;
+        case Quoted:
+          if (*c == '"') {
+            state = QuoteInQuoted;
+          } else {
+            fieldEnd = c + 1;
+          }
+          break;
+        case QuoteInQuoted:
+          if (*c == '"') {
+            // doubled quote, keep one
+            hasEscapedQuotes = true;
+            fieldEnd = c + 1;
+            state = Quoted;
+          } else if (*c == delimiter) {
+            endField(true);
+            state = FieldStart;
+          } else if (*c == '\n') {
+            endRow(true);
+            state = FieldStart;
+          } else {
+            // text after the closing quote, keep the quotes as part of the field
+            fieldEnd = c + 1;
+            state = Unquoted;
+          }
+          break;
+        }
+      }
+
+      if (inRow) {
+        endRow((state == Quoted) || (state == QuoteInQuoted));
+      }
+    }
+
+    std::string unescapeQuotes(const char* begin, const char* end)
+    {
+      std::string result;
+      result.reserve(end - begin);
+      for (const char* c = begin; c != end; ++c) {
+        result.push_back(*c);
+        if ((*c == '"') && (c + 1 != end) && (*(c + 1) == '"')) {
+          ++c;
+        }
+      }
+      return result;
+    }
+
+    bool isDigit(char c)
+    {
+      return (c >= '0') && (c <= '9');
+    }
+
+    /** Classifies an unquoted field as VariantType::Integer (-?digits that fit in an int), VariantType::Double
+     *  ([+-]?digits[.digits]) or VariantType::String, setting value for numeric fields. */
+    VariantType::domain classifyField(const char* begin, const char* end, double& value)
+    {
+      const char* c = begin;
+      bool hasPlus = false;
+      if ((c != end) && ((*c == '-') || (*c == '+'))) {
+        hasPlus = (*c == '+');
+        ++c;
+      }
+      const char* digitsBegin = c;
+      while ((c != end) && isDigit(*c)) {
+        ++c;
+      }
+      if (c == digitsBegin) {
+        return VariantType::String;
+      }
+
+      if ((c == end) && !hasPlus && ((c - digitsBegin) < 10)) {
+        long long i = 0;
+        for (const char* d = digitsBegin; d != end; ++d) {
+          i = 10 * i + (*d - '0');
+        }
+        if (*begin == '-') {
+          i = -i;
+        }
+        value = static_cast<double>(i);
+        return VariantType::Integer;
+      }
+
+      if (c != end) {
+        if (*c != '.') {
+          return VariantType::String;
+        }
+        ++c;
+        while ((c != end) && isDigit(*c)) {
+          ++c;
+        }
+        if (c != end) {
+          return VariantType::String;
+        }
+      }
+
+      // strtod needs a terminated string
+      char buffer[64];
+      size_t n = end - begin;
+      if (n < sizeof(buffer)) {
+        std::copy(begin, end, buffer);
+        buffer[n] = '\0';
+        value = std::strtod(buffer, nullptr);
+      } else {
+        value = std::strtod(std::string(begin, end).c_str(), nullptr);
+      }
+      return VariantType::Double;
+    }
+
+    /** Builds all columns of a file. */
+    struct ColumnsBuilder
+    {
+      std::vector<CSVColumn>& columns;
+      unsigned numRows;
+
+      void field(unsigned columnIndex, const char* begin, const char* end, bool quoted, bool hasEscapedQuotes)
+      {
+        if (columnIndex >= columns.size()) {
+          // pad the new column for all previous rows
+          CSVColumn column;
+          column.values.assign(numRows, 0.0);
+          column.types.assign(numRows, VariantType::String);
+          columns.push_back(std::move(column));
+        }
+        CSVColumn& column = columns[columnIndex];
+
+        double value = 0.0;
+        VariantType::domain type = quoted ? VariantType::String : classifyField(begin, end, value);
+        column.values.push_back(value);
+        column.types.push_back(static_cast<unsigned char>(type));
+        if ((type == VariantType::String) && (begin != end)) {
+          column.strings.emplace_hint(column.strings.end(), numRows,
+                                      hasEscapedQuotes ? unescapeQuotes(begin, end) : std::string(begin, end));
+        }
+      }
+
+      void endRow()
+      {
+        ++numRows;
+        for (CSVColumn& column : columns) {
+          if (column.types.size() < numRows) {
+            column.values.push_back(0.0);
+            column.types.push_back(VariantType::String);
+          }
+        }
+      }
+    };
+
+    /** Reads a single column of a file as doubles, ignoring all other fields. */
+    struct DoubleColumnReader
+    {
+      unsigned columnIndex;
+      unsigned numRowsToSkip;
+      unsigned rowIndex;
+      bool found;
+      bool ok;
+      std::vector<double> values;
+
+      void field(unsigned fieldIndex, const char* begin, const char* end, bool quoted, bool)
+      {
+        if ((fieldIndex != columnIndex) || (rowIndex < numRowsToSkip) || !ok) {
+          return;
+        }
+        found = true;
+        double value = 0.0;
+        if (quoted || (classifyField(begin, end, value) == VariantType::String)) {
+          ok = false;
+          return;
+        }
+        values.push_back(value);
+      }
+
+      void endRow()
+      {
+        if ((rowIndex >= numRowsToSkip) && !found) {
+          // row is too short
+          ok = false;
+        }
+        ++rowIndex;
+        found = false;
+      }
+    };
+
+    /** Maps the file at p and calls f(begin, end) on its contents. Returns false if the file cannot be read. */
+    template <typename Function>
+    bool withFileContents(const openstudio::path& p, uintmax_t fileSize, Function f)
+    {
+      if (fileSize == 0) {
+        f(nullptr, nullptr);
+        return true;
+      }
+      boost::iostreams::mapped_file_source file;
+      try {
+        file.open(p);
+      } catch (const std::exception&) {
+        return false;
+      }
+      if (!file.is_open()) {
+        return false;
+      }
+      f(file.data(), file.data() + file.size());
+      return true;
+    }
+
+  }
+
   CSVFile_Impl::CSVFile_Impl()
-  : m_numColumns(0)
+  : m_numRows(0)
   {
   }
 
   CSVFile_Impl::CSVFile_Impl(const std::string& s)
+    : m_numRows(0)
   {
-    std::istringstream ss(s);
-
-    // will throw on error
-    m_rows = parseRows(ss);
-      
-    assignNumColumns();
-    padRows();
+    parseColumns(s.data(), s.data() + s.size());
   }
 
   CSVFile_Impl::CSVFile_Impl(const openstudio::path& p)
+    : m_numRows(0)
   {
     if (!boost::filesystem::exists(p) || !boost::filesystem::is_regular_file(p)){
       LOG_AND_THROW("Path '" << p << "' is not a CSVFile file");
     }
 
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(p));
+    uintmax_t fileSize = boost::filesystem::file_size(p);
+    bool ok = withFileContents(p, fileSize, [this](const char* begin, const char* end) {
+      parseColumns(begin, end);
+    });
+    if (!ok) {
+      LOG_AND_THROW("Could not read CSVFile at path '" << p << "'");
+    }
 
-    // will throw on error
-    m_rows = parseRows(ifs);
-    
     m_path = p;
-    assignNumColumns();
-    padRows();
   }
 
   CSVFile CSVFile_Impl::clone() const
   {
-    CSVFile result(this->string());
-    if (m_path) {
-      result.setPath(*m_path);
-    }
-
-    return result;
+    std::shared_ptr<CSVFile_Impl> impl(new CSVFile_Impl(*this));
+    return CSVFile(impl);
   }
 
   std::string CSVFile_Impl::string() const
   {
-    static const boost::regex escapeItRegex(",");
-
-    std::string s;
     std::stringstream result;
-    for (const auto& row : m_rows) {
-      OS_ASSERT(row.size() == m_numColumns);
-      for (size_t i = 0; i < m_numColumns; ++i) {
-
-        switch (row[i].variantType().value()) {
+    unsigned numColumns = m_columns.size();
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      for (unsigned j = 0; j < numColumns; ++j) {
+        const CSVColumn& column = m_columns[j];
+
+        switch (column.types[i]) {
+        case VariantType::Boolean:
+          result << (column.values[i] != 0.0 ? "true" : "false");
+          break;
         case VariantType::Integer:
-          result << row[i].valueAsInteger();
+          result << static_cast<int>(column.values[i]);
           break;
         case VariantType::Double:
-          result << row[i].valueAsDouble();
+          result << column.values[i];
           break;
         case VariantType::String:
-          s = row[i].valueAsString();
-          if (boost::regex_match(s, escapeItRegex)) {
-            result << "\"" << s << "\"";
-          } else {
-            result << s;
+        {
+          auto it = column.strings.find(i);
+          if (it != column.strings.end()) {
+            const std::string& s = it->second;
+            if (s.find_first_of(",\"\n") != std::string::npos) {
+              result << "\"";
+              for (char c : s) {
+                if (c == '"') {
+                  result << '"';
+                }
+                result << c;
+              }
+              result << "\"";
+            } else {
+              result << s;
+            }
           }
           break;
+        }
         default:
           break;
         }
 
-        if (i < m_numColumns - 1) {
+        if (j < numColumns - 1) {
           result << ",";
         }
       }
@@ -164,147 +444,152 @@ namespace detail{
     return m_path;
   }
 
-  bool CSVFile_Impl::setPath(const openstudio::path& path) 
+  bool CSVFile_Impl::setPath(const openstudio::path& path)
   {
     m_path = path;
     return true;
   }
 
-  void CSVFile_Impl::resetPath() 
+  void CSVFile_Impl::resetPath()
   {
     m_path.reset();
   }
 
-  unsigned CSVFile_Impl::numColumns() const 
+  unsigned CSVFile_Impl::numColumns() const
   {
-    return m_numColumns;
+    return m_columns.size();
   }
 
-  unsigned CSVFile_Impl::numRows() const 
+  unsigned CSVFile_Impl::numRows() const
   {
-    return m_rows.size();
+    return m_numRows;
   }
 
-  std::vector<std::vector<Variant> > CSVFile_Impl::rows() const 
+  std::vector<std::vector<Variant> > CSVFile_Impl::rows() const
   {
-    return m_rows;
+    std::vector<std::vector<Variant> > result;
+    result.reserve(m_numRows);
+    unsigned numColumns = m_columns.size();
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      std::vector<Variant> row;
+      row.reserve(numColumns);
+      for (unsigned j = 0; j < numColumns; ++j) {
+        row.push_back(cell(i, j));
+      }
+      result.push_back(std::move(row));
+    }
+    return result;
   }
 
-  void CSVFile_Impl::addRow(const std::vector<Variant>& row) 
+  void CSVFile_Impl::addRow(const std::vector<Variant>& row)
   {
-    m_rows.push_back(row);
-    if (row.size() > m_numColumns) {
-      m_numColumns = row.size();
-      padRows();
+    while (m_columns.size() < row.size()) {
+      appendColumn();
     }
-      
-    while (m_rows[m_rows.size() - 1].size() < m_numColumns){
-      m_rows[m_rows.size() - 1].push_back(Variant(""));
+
+    for (unsigned j = 0; j < m_columns.size(); ++j) {
+      if (j < row.size()) {
+        appendCell(m_columns[j], row[j]);
+      } else {
+        appendEmptyCells(m_columns[j], 1);
+      }
     }
+    ++m_numRows;
   }
 
-  void CSVFile_Impl::setRows(const std::vector<std::vector<Variant> >& rows) 
+  void CSVFile_Impl::setRows(const std::vector<std::vector<Variant> >& rows)
   {
-    m_rows = rows;
-    assignNumColumns();
+    m_columns.clear();
+    m_numRows = 0;
+    for (const auto& row : rows) {
+      addRow(row);
+    }
   }
 
-  void CSVFile_Impl::clear() 
+  void CSVFile_Impl::clear()
   {
-    m_rows.clear();
+    m_columns.clear();
     m_path.reset();
-    m_numColumns = 0;
+    m_numRows = 0;
   }
 
-  unsigned CSVFile_Impl::addColumn(const std::vector<DateTime>& dateTimes) 
+  unsigned CSVFile_Impl::addColumn(const std::vector<DateTime>& dateTimes)
   {
     unsigned n = dateTimes.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(dateTimes[i].toISO8601()));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    CSVColumn column;
+    for (unsigned i = 0; i < n; ++i) {
+      appendCell(column, Variant(dateTimes[i].toISO8601()));
     }
+    appendEmptyCells(column, m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
-  unsigned CSVFile_Impl::addColumn(const Vector& values) 
+  unsigned CSVFile_Impl::addColumn(const Vector& values)
   {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
-    }
+    CSVColumn column;
+    column.values.assign(values.begin(), values.end());
+    column.types.assign(n, VariantType::Double);
+    appendEmptyCells(column, m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
-  unsigned CSVFile_Impl::addColumn(const std::vector<double>& values) 
+  unsigned CSVFile_Impl::addColumn(const std::vector<double>& values)
   {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
-    }
+    CSVColumn column;
+    column.values = values;
+    column.types.assign(n, VariantType::Double);
+    appendEmptyCells(column, m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
-  unsigned CSVFile_Impl::addColumn(const std::vector<std::string>& values) 
+  unsigned CSVFile_Impl::addColumn(const std::vector<std::string>& values)
   {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    CSVColumn column;
+    for (unsigned i = 0; i < n; ++i) {
+      appendCell(column, Variant(values[i]));
     }
+    appendEmptyCells(column, m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
-  std::vector<DateTime> CSVFile_Impl::getColumnAsDateTimes(unsigned columnIndex) const 
+  std::vector<DateTime> CSVFile_Impl::getColumnAsDateTimes(unsigned columnIndex) const
   {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<DateTime>();
     }
 
     std::vector<DateTime> result;
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (m_rows[i][columnIndex].variantType() != VariantType::String) {
-        LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
-        return std::vector<DateTime>();
+    const CSVColumn& column = m_columns[columnIndex];
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      boost::optional<DateTime> dateTime;
+      if (column.types[i] == VariantType::String) {
+        auto it = column.strings.find(i);
+        if (it != column.strings.end()) {
+          dateTime = DateTime::fromISO8601(it->second);
+        }
       }
 
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(m_rows[i][columnIndex].valueAsString());
       if (!dateTime) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return std::vector<DateTime>();
@@ -316,53 +601,43 @@ namespace detail{
   }
 
   std::vector<double> CSVFile_Impl::getColumnAsDoubleVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<double>();
     }
 
-    std::vector<double> result;
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-
-      boost::optional<double> value;
-      if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
-        value = m_rows[i][columnIndex].valueAsDouble();
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
-        value = m_rows[i][columnIndex].valueAsInteger();
-      }
-
-      if (!value) {
+    const CSVColumn& column = m_columns[columnIndex];
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if ((column.types[i] != VariantType::Double) && (column.types[i] != VariantType::Integer)) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a numeric value");
         return std::vector<double>();
       }
-      result.push_back(*value);
     }
 
-    return result;
+    return column.values;
   }
 
   std::vector<std::string> CSVFile_Impl::getColumnAsStringVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<std::string>();
     }
 
     std::vector<std::string> result;
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
+    const CSVColumn& column = m_columns[columnIndex];
+    for (unsigned i = 0; i < m_numRows; ++i) {
 
-      if (m_rows[i][columnIndex].variantType() == VariantType::String) {
-        result.push_back(m_rows[i][columnIndex].valueAsString());
-      }else if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
+      if (column.types[i] == VariantType::String) {
+        auto it = column.strings.find(i);
+        result.push_back(it == column.strings.end() ? std::string() : it->second);
+      } else if (column.types[i] == VariantType::Double) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsDouble();
+        ss << column.values[i];
         result.push_back(ss.str());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
+      } else if (column.types[i] == VariantType::Integer) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsInteger();
+        ss << static_cast<int>(column.values[i]);
         result.push_back(ss.str());
       }
     }
@@ -370,72 +645,105 @@ namespace detail{
     return result;
   }
 
-  // throws on error
-  std::vector<std::vector<Variant> > CSVFile_Impl::parseRows(std::istream& input) 
+  std::vector<double> CSVFile_Impl::readColumnAsDoubleVector(const openstudio::path& p, unsigned columnIndex,
+                                                             unsigned numRowsToSkip, char delimiter)
   {
-    std::vector<std::vector<Variant> > result;
-
-    // DLM: what conditions should make this throw?
+    if (!boost::filesystem::exists(p) || !boost::filesystem::is_regular_file(p)){
+      LOG(Warn, "Path '" << p << "' is not a CSVFile file");
+      return std::vector<double>();
+    }
 
-    // Excel formated CSV regex, \A[^,"]*(?=,)|(?:[^",]*"[^"]*"[^",]*)+|[^",]*"[^"]*\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\Z|\A[^,]*\Z
-    static const boost::regex csvRegex("\\A[^,\"]*(?=,)|(?:[^\",]*\"[^\"]*\"[^\",]*)+|[^\",]*\"[^\"]*\\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\\Z|\\A[^,]*\\Z");
-    static const boost::regex intRegex("^[-0-9]+$");
-    static const boost::regex doubleRegex("^[+-]?\\d+\\.?(\\d+)?$");
-    static const boost::regex quoteRegex("^\"(.*)\"$");
-    
-    std::string line;
-    while (std::getline(input, line)) {
-      std::vector<Variant> row;
-      boost::regex_token_iterator<std::string::iterator> it{line.begin(), line.end(), csvRegex, 0};
-      boost::regex_token_iterator<std::string::iterator> end;
-      while (it != end){
-        std::string value = *it;
-        if (boost::regex_match(value, intRegex)) {
-          row.push_back(Variant(std::stoi(value)));
-        } else if (boost::regex_match(value, doubleRegex)) {
-          row.push_back(Variant(std::stod(value)));
-        } else {
-          boost::smatch valueMatch;
-          if (boost::regex_search(value, valueMatch, quoteRegex)) {
-            row.push_back(Variant(valueMatch[1]));
-          } else {
-            row.push_back(Variant(value));
-          }
-        }
-        ++it;
-      }
-      result.push_back(row);
+    uintmax_t fileSize = boost::filesystem::file_size(p);
+    DoubleColumnReader reader{columnIndex, numRowsToSkip, 0, false, true, std::vector<double>()};
+    bool ok = withFileContents(p, fileSize, [&reader, delimiter](const char* begin, const char* end) {
+      tokenize(begin, end, delimiter, reader);
+    });
+    if (!ok) {
+      LOG(Warn, "Could not read CSVFile at path '" << p << "'");
+      return std::vector<double>();
+    }
+    if (!reader.ok) {
+      LOG(Warn, "Column " << columnIndex << " of '" << p << "' contains values that are not numeric");
+      return std::vector<double>();
     }
 
-    return result;
+    return reader.values;
   }
 
-  void CSVFile_Impl::assignNumColumns() 
+  void CSVFile_Impl::parseColumns(const char* begin, const char* end)
   {
-    m_numColumns = 0;
-    for (const auto& row : m_rows) {
-      m_numColumns = std::max<unsigned>(m_numColumns, row.size());
+    ColumnsBuilder builder{m_columns, 0};
+    tokenize(begin, end, ',', builder);
+    m_numRows = builder.numRows;
+  }
+
+  Variant CSVFile_Impl::cell(unsigned rowIndex, unsigned columnIndex) const
+  {
+    const CSVColumn& column = m_columns[columnIndex];
+    switch (column.types[rowIndex]) {
+    case VariantType::Boolean:
+      return Variant(column.values[rowIndex] != 0.0);
+    case VariantType::Integer:
+      return Variant(static_cast<int>(column.values[rowIndex]));
+    case VariantType::Double:
+      return Variant(column.values[rowIndex]);
+    default:
+      break;
     }
+    auto it = column.strings.find(rowIndex);
+    if (it == column.strings.end()) {
+      return Variant("");
+    }
+    return Variant(it->second);
   }
 
-  void CSVFile_Impl::ensureNumRows(unsigned numRows) 
+  void CSVFile_Impl::appendCell(CSVColumn& column, const Variant& value)
   {
-    // add empty cells to existing columns if needed
-    if (numRows > m_rows.size()) {
-      unsigned numRowsToAdd = numRows - m_rows.size();
-      std::vector<Variant> blankRow(m_numColumns, Variant(""));
-      for (unsigned i = 0; i < numRowsToAdd; ++i) {
-        m_rows.push_back(blankRow);
+    unsigned rowIndex = column.types.size();
+    switch (value.variantType().value()) {
+    case VariantType::Boolean:
+      column.values.push_back(value.valueAsBoolean() ? 1.0 : 0.0);
+      break;
+    case VariantType::Integer:
+      column.values.push_back(value.valueAsInteger());
+      break;
+    case VariantType::Double:
+      column.values.push_back(value.valueAsDouble());
+      break;
+    default:
+    {
+      column.values.push_back(0.0);
+      std::string s = value.valueAsString();
+      if (!s.empty()) {
+        column.strings.emplace_hint(column.strings.end(), rowIndex, s);
       }
+      break;
     }
-    OS_ASSERT(m_rows.size() >= numRows);
+    }
+    column.types.push_back(static_cast<unsigned char>(value.variantType().value()));
+  }
+
+  void CSVFile_Impl::appendEmptyCells(CSVColumn& column, unsigned n)
+  {
+    column.values.insert(column.values.end(), n, 0.0);
+    column.types.insert(column.types.end(), n, static_cast<unsigned char>(VariantType::String));
   }
 
-  void CSVFile_Impl::padRows() {
-    for (auto& row : m_rows) {
-      while (row.size() < m_numColumns) {
-        row.push_back(Variant(""));
+  void CSVFile_Impl::appendColumn()
+  {
+    CSVColumn column;
+    appendEmptyCells(column, m_numRows);
+    m_columns.push_back(std::move(column));
+  }
+
+  void CSVFile_Impl::ensureNumRows(unsigned numRows)
+  {
+    // add empty cells to existing columns if needed
+    if (numRows > m_numRows) {
+      for (CSVColumn& column : m_columns) {
+        appendEmptyCells(column, numRows - m_numRows);
       }
+      m_numRows = numRows;
     }
   }
 
@@ -578,6 +886,12 @@ std::vector<std::string> CSVFile::getColumnAsStringVector(unsigned columnIndex)
   return getImpl<detail::CSVFile_Impl>()->getColumnAsStringVector(columnIndex);
 }
 
+std::vector<double> CSVFile::readColumnAsDoubleVector(const openstudio::path& p, unsigned columnIndex,
+                                                      unsigned numRowsToSkip, char delimiter)
+{
+  return detail::CSVFile_Impl::readColumnAsDoubleVector(p, columnIndex, numRowsToSkip, delimiter);
+}
+
 std::ostream& operator<<(std::ostream& os, const CSVFile& CSVFile)
 {
   os << CSVFile.string();
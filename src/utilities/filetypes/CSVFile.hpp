@@ -46,7 +46,9 @@ namespace detail{
   class CSVFile_Impl;
 }
 
-/** Class for reading and writing CSV files. */
+/** Class for reading and writing CSV files. Files are parsed in a single pass over a memory mapped buffer and stored
+ *  by column, numeric cells in contiguous doubles. Files are read each time they are loaded, keep the CSVFile to
+ *  avoid parsing the same file again. */
 class UTILITIES_API CSVFile
 {
 public:
@@ -126,6 +128,12 @@ public:
   /** Get column as a Vector (first column is index 0). Numeric cells will be converted to strings. Empty vector is returned if column index is invalid.*/
   std::vector<std::string> getColumnAsStringVector(unsigned columnIndex) const;
 
+  /** Reads one column (first column is index 0) of the file at p as doubles, skipping the first numRowsToSkip rows.
+   *  Only that column is converted and stored. Empty vector is returned if the file cannot be read, a row is too
+   *  short or any cell is not a number. */
+  static std::vector<double> readColumnAsDoubleVector(const openstudio::path& p, unsigned columnIndex,
+                                                      unsigned numRowsToSkip = 0, char delimiter = ',');
+
 protected:
 
   // get the impl
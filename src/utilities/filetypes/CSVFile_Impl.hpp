@@ -36,10 +36,24 @@
 #include "../core/Path.hpp"
 #include "../data/Vector.hpp"
 
+#include <map>
+
 namespace openstudio{
 
 namespace detail {
 
+    /** Storage for one column of a CSVFile. Numeric cells are stored in contiguous doubles, strings are stored
+     *  sparsely since most columns of large files are numeric below a few header rows. */
+    struct CSVColumn
+    {
+      // value of each Double, Integer or Boolean cell, 0 for String cells
+      std::vector<double> values;
+      // VariantType of each cell
+      std::vector<unsigned char> types;
+      // value of each non-empty String cell, keyed by row
+      std::map<unsigned, std::string> strings;
+    };
+
     class UTILITIES_API CSVFile_Impl
     {
     public:
@@ -97,22 +111,29 @@ namespace detail {
       /** Get column as a Vector (first column is index 0). Numeric cells will be converted to strings. Empty vector is returned if column index is invalid.*/
       std::vector<std::string> getColumnAsStringVector(unsigned columnIndex) const;
 
+      static std::vector<double> readColumnAsDoubleVector(const openstudio::path& p, unsigned columnIndex,
+                                                          unsigned numRowsToSkip, char delimiter);
+
     private:
 
       REGISTER_LOGGER("openstudio.CSVFile");
 
-      // throws on error
-      std::vector<std::vector<Variant> > parseRows(std::istream& input);
+      // parses the buffer into m_columns
+      void parseColumns(const char* begin, const char* end);
 
-      void assignNumColumns();
+      Variant cell(unsigned rowIndex, unsigned columnIndex) const;
 
-      void ensureNumRows(unsigned numRows);
+      void appendCell(CSVColumn& column, const Variant& value);
+
+      void appendEmptyCells(CSVColumn& column, unsigned n);
 
-      void padRows();
+      void appendColumn();
+
+      void ensureNumRows(unsigned numRows);
 
       boost::optional<openstudio::path> m_path;
-      unsigned m_numColumns;
-      std::vector<std::vector<Variant> > m_rows;
+      unsigned m_numRows;
+      std::vector<CSVColumn> m_columns;
 
     };
 
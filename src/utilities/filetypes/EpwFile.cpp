@@ -37,6 +37,15 @@
 
 #include <fmt/format.h>
 
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
 namespace openstudio{
 
   static double psat(double T)
@@ -113,6 +122,30 @@ namespace openstudio{
     return 1.006*T + W*(2501 + 1.86*T); // Moist air specific enthalpy, eqn 32
   }
 
+  // The per-record equations of the moist air properties below are shared by AirState and EpwComputedColumns, which
+  // applies them to all of the records of the data columns at once
+
+  static double moistAirHumidityRatio(double pw, double p)
+  {
+    return 0.621945*pw / (p - pw); // Humidity ratio, eqn 22
+  }
+
+  static double moistAirEnthalpy(double T, double W)
+  {
+    return 1.006*T + W*(2501 + 1.86*T); // Moist air specific enthalpy, eqn 32
+  }
+
+  static double moistAirSpecificVolume(double T, double W, double p)
+  {
+    return 0.287042*(T + 273.15)*(1 + 1.607858*W) / p; // Specific volume, eqn 28
+  }
+
+  // Whether a Newton iteration that changed the temperature t (in C) by delta is done
+  static bool newtonConverged(double delta, double t, double deltaLimit)
+  {
+    return fabs(delta / (273.15 + t)) <= deltaLimit;
+  }
+
   // Using equation 35/37 in ASHRAE Fundamentals 2009 Ch. 1:
   //
   //  W = (A W*_s - B)/C
@@ -128,21 +161,18 @@ namespace openstudio{
   //  B = b (t - t*)
   //  C = c0 + c1 t + c2 t*
   //
-  static boost::optional<double> solveForWetBulb(double drybulb, double p, double W, double deltaLimit, int itermax)
-  {
-    double tstar = drybulb;
-    double Ap, Bp, Cp;
-    double a0, a1, b, c0, c1t, c2;
-    int i = 0;
-    a0 = 2501;
-    a1 = -2.326;
-    b = 1.006;
-    c0 = 2501;
-    c1t = 1.86*drybulb;
-    c2 = -4.186;
-    Ap = -2.326;
-    Bp = -1.006;
-    Cp = -4.186;
+  // Returns the Newton step from the wet bulb estimate tstar
+  static double wetBulbNewtonStep(double drybulb, double p, double W, double tstar)
+  {
+    double a0 = 2501;
+    double a1 = -2.326;
+    double b = 1.006;
+    double c0 = 2501;
+    double c1t = 1.86*drybulb;
+    double c2 = -4.186;
+    double Ap = -2.326;
+    double Bp = -1.006;
+    double Cp = -4.186;
     if (drybulb < 0) {
       a0 = 2830;
       a1 = -0.24;
@@ -152,22 +182,30 @@ namespace openstudio{
       Cp = -2.1;
     }
 
+    double A = a0 + a1*tstar;
+    double B = b*(drybulb - tstar);
+    double C = c0 + c1t + c2*tstar;
+    double pwsstar = psat(tstar);
+    double pwsstarp = psatp(tstar, pwsstar);
+    double deltap = p - pwsstar;
+    double Wsstar = 0.621945*pwsstar / deltap;
+    double Wsstarp = (0.621945*pwsstarp*deltap + 0.621945*pwsstar*pwsstarp) / (deltap*deltap);
+    double f = W*C - A*Wsstar + B;
+    double fp = W*Cp - A*Wsstarp - Ap*Wsstar + Bp;
+    return -f / fp;
+  }
+
+  static boost::optional<double> solveForWetBulb(double drybulb, double p, double W, double deltaLimit, int itermax)
+  {
+    double tstar = drybulb;
+    int i = 0;
+
     while (i < itermax) {
       i++;
-      double A = a0 + a1*tstar;
-      double B = b*(drybulb - tstar);
-      double C = c0 + c1t + c2*tstar;
-      double pwsstar = psat(tstar);
-      double pwsstarp = psatp(tstar, pwsstar);
-      double deltap = p - pwsstar;
-      double Wsstar = 0.621945*pwsstar / deltap;
-      double Wsstarp = (0.621945*pwsstarp*deltap + 0.621945*pwsstar*pwsstarp) / (deltap*deltap);
-      double f = W*C - A*Wsstar + B;
-      double fp = W*Cp - A*Wsstarp - Ap*Wsstar + Bp;
-      double delta = -f / fp;
+      double delta = wetBulbNewtonStep(drybulb, p, W, tstar);
       tstar += delta;
       // std::cout << i << " " << tstar << " " << delta / (273.15 + tstar) << std::endl;
-      if (fabs(delta / (273.15 + tstar)) <= deltaLimit) {
+      if (newtonConverged(delta, tstar, deltaLimit)) {
         return boost::optional<double>(tstar);
       }
     }
@@ -178,6 +216,15 @@ namespace openstudio{
   //
   //  psat(td) = pw
   //
+  // Returns the Newton step from the dew point estimate tdew
+  static double dewPointNewtonStep(double pw, double tdew)
+  {
+    double pws = psat(tdew);
+    double f = pws - pw;
+    double fp = psatp(tdew, pws);
+    return -f / fp;
+  }
+
   static boost::optional<double> solveForDewPoint(double drybulb, double pw, double deltaLimit, int itermax)
   {
     //double deltaLimit = percentChange*0.01;
@@ -186,13 +233,10 @@ namespace openstudio{
 
     while (i < itermax) {
       i++;
-      double pws = psat(tdew);
-      double f = pws - pw;
-      double fp = psatp(tdew, pws);
-      double delta = -f / fp;
+      double delta = dewPointNewtonStep(pw, tdew);
       tdew += delta;
       // std::cout << i << " " << tdew << " " << delta / (273.15 + tdew) << std::endl;
-      if (fabs(delta / (273.15 + tdew)) <= deltaLimit) {
+      if (newtonConverged(delta, tdew, deltaLimit)) {
         return boost::optional<double>(tdew);
       }
     }
@@ -208,10 +252,9 @@ namespace openstudio{
     // Compute moist air properties, eqns from ASHRAE Fundamentals 2009 Ch. 1, should probably just set all of these
     m_psat = psat(m_drybulb); // Water vapor saturation pressure (uses eqns 5 and 6)
     double pw = m_phi * m_psat; // Relative humidity, eqn 24
-    m_W = 0.621945 * pw / (m_pressure - pw); // Humidity ratio, eqn 22
-    // TODO: Use the function above
-    m_h = 1.006*m_drybulb + m_W*(2501 + 1.86*m_drybulb); // Moist air specific enthalpy, eqn 32
-    m_v = 0.287042*(m_drybulb + 273.15)*(1 + 1.607858*m_W) / m_pressure; // Specific volume, eqn 28
+    m_W = moistAirHumidityRatio(pw, m_pressure); // Humidity ratio, eqn 22
+    m_h = moistAirEnthalpy(m_drybulb, m_W); // Moist air specific enthalpy, eqn 32
+    m_v = moistAirSpecificVolume(m_drybulb, m_W, m_pressure); // Specific volume, eqn 28
     // Compute the dew point temperature here
     boost::optional<double> dewpoint = solveForDewPoint(m_drybulb, pw, 1e-4, 100);
     OS_ASSERT(dewpoint);
@@ -238,12 +281,12 @@ namespace openstudio{
     state.m_pressure = pressure;
     // Compute moist air properties, eqns from ASHRAE Fundamentals 2009 Ch. 1
     double pw = psat(dewpoint); // // Partial pressure of water vapor, eqn 38 (uses eqns 5 and 6)
-    state.m_W = 0.621945 * pw / (pressure - pw); // Humidity ratio, eqn 22
+    state.m_W = moistAirHumidityRatio(pw, pressure); // Humidity ratio, eqn 22
     state.m_psat = psat(drybulb); // Water vapor saturation pressure (uses eqns 5 and 6)
     //double Ws = 0.621945 * state.m_psat / (pressure - state.m_psat);
     state.m_phi = pw / state.m_psat; // Relative humidity, eqn 24
-    state.m_h = 1.006*drybulb + state.m_W*(2501 + 1.86*drybulb); // Moist air specific enthalpy, eqn 32
-    state.m_v = 0.287042*(drybulb + 273.15)*(1 + 1.607858*state.m_W) / pressure; // Specific volume, eqn 28
+    state.m_h = moistAirEnthalpy(drybulb, state.m_W); // Moist air specific enthalpy, eqn 32
+    state.m_v = moistAirSpecificVolume(drybulb, state.m_W, pressure); // Specific volume, eqn 28
     // Compute the wet bulb temperature here
     boost::optional<double> wetbulb = solveForWetBulb(drybulb, pressure, state.m_W, 1e-4, 100);
     if (!wetbulb) {
@@ -270,9 +313,9 @@ namespace openstudio{
     // Compute moist air properties, eqns from ASHRAE Fundamentals 2009 Ch. 1
     state.m_psat = psat(drybulb); // Water vapor saturation pressure (uses eqns 5 and 6)
     double pw = state.m_phi * state.m_psat; // Relative humidity, eqn 24
-    state.m_W = 0.621945 * pw / (pressure - pw); // Humidity ratio, eqn 22
-    state.m_h = 1.006*drybulb + state.m_W*(2501 + 1.86*drybulb); // Moist air specific enthalpy, eqn 32
-    state.m_v = 0.287042*(drybulb + 273.15)*(1 + 1.607858*state.m_W) / pressure; // Specific volume, eqn 28
+    state.m_W = moistAirHumidityRatio(pw, pressure); // Humidity ratio, eqn 22
+    state.m_h = moistAirEnthalpy(drybulb, state.m_W); // Moist air specific enthalpy, eqn 32
+    state.m_v = moistAirSpecificVolume(drybulb, state.m_W, pressure); // Specific volume, eqn 28
     // Compute the dew point temperature here
     boost::optional<double> dewpoint = solveForDewPoint(drybulb, pw, 1e-4, 100);
     if (!dewpoint) {
@@ -1637,6 +1680,204 @@ namespace openstudio{
     return value;
   }
 
+  // The rules of the EpwDataPoint setters for each weather field, also used when the data columns are parsed directly
+
+  // The value that EpwDataPoint stores for a missing value of a field
+  static const char* epwMissingValue(int field)
+  {
+    switch (field) {
+      case EpwDataField::DryBulbTemperature:
+      case EpwDataField::DewPointTemperature:
+        return "99.9";
+      case EpwDataField::AtmosphericStationPressure:
+      case EpwDataField::GlobalHorizontalIlluminance:
+      case EpwDataField::DirectNormalIlluminance:
+      case EpwDataField::DiffuseHorizontalIlluminance:
+        return "999999";
+      case EpwDataField::ExtraterrestrialHorizontalRadiation:
+      case EpwDataField::ExtraterrestrialDirectNormalRadiation:
+      case EpwDataField::HorizontalInfraredRadiationIntensity:
+      case EpwDataField::GlobalHorizontalRadiation:
+      case EpwDataField::DirectNormalRadiation:
+      case EpwDataField::DiffuseHorizontalRadiation:
+      case EpwDataField::ZenithLuminance:
+      case EpwDataField::Visibility:
+        return "9999";
+      case EpwDataField::CeilingHeight:
+        return "99999";
+      case EpwDataField::AerosolOpticalDepth:
+        return ".999";
+      case EpwDataField::TotalSkyCover:
+      case EpwDataField::OpaqueSkyCover:
+      case EpwDataField::DaysSinceLastSnowfall:
+      case EpwDataField::LiquidPrecipitationQuantity:
+        return "99";
+      case EpwDataField::PresentWeatherObservation:
+      case EpwDataField::PresentWeatherCodes:
+        return "0";
+      default: // RelativeHumidity, WindDirection, WindSpeed, PrecipitableWater, SnowDepth, Albedo and LiquidPrecipitationDepth
+        return "999";
+    }
+  }
+
+  // Whether the setters accept a value for a field, accepted values outside of the expected limits are logged
+  static bool acceptEpwFieldValue(int field, double value)
+  {
+    bool accept = true;
+    bool warn = false;
+    switch (field) {
+      case EpwDataField::DryBulbTemperature:
+      case EpwDataField::DewPointTemperature:
+        warn = -70 >= value || 70 <= value;
+        break;
+      case EpwDataField::RelativeHumidity:
+        accept = 0 <= value;
+        warn = 110 < value;
+        break;
+      case EpwDataField::AtmosphericStationPressure:
+        warn = 31000 >= value || 120000 <= value;
+        break;
+      case EpwDataField::ExtraterrestrialHorizontalRadiation:
+      case EpwDataField::ExtraterrestrialDirectNormalRadiation:
+      case EpwDataField::HorizontalInfraredRadiationIntensity:
+      case EpwDataField::GlobalHorizontalRadiation:
+      case EpwDataField::DirectNormalRadiation:
+      case EpwDataField::DiffuseHorizontalRadiation:
+        accept = 0 <= value && value != 9999;
+        break;
+      case EpwDataField::GlobalHorizontalIlluminance:
+      case EpwDataField::DirectNormalIlluminance:
+      case EpwDataField::DiffuseHorizontalIlluminance:
+        accept = 0 <= value && 999900 >= value;
+        break;
+      case EpwDataField::ZenithLuminance:
+        accept = 0 <= value && 9999 > value;
+        break;
+      case EpwDataField::WindDirection:
+        accept = 0 <= value && 360 >= value;
+        break;
+      case EpwDataField::WindSpeed:
+        accept = 0 <= value;
+        warn = 40 < value;
+        break;
+      case EpwDataField::TotalSkyCover:
+      case EpwDataField::OpaqueSkyCover:
+        accept = 0 <= value && 10 >= value;
+        break;
+      case EpwDataField::PresentWeatherObservation:
+      case EpwDataField::PresentWeatherCodes:
+        break;
+      case EpwDataField::Visibility:
+        accept = value != 9999;
+        break;
+      case EpwDataField::CeilingHeight:
+        accept = value != 99999;
+        break;
+      case EpwDataField::AerosolOpticalDepth:
+        accept = value != 0.999;
+        break;
+      case EpwDataField::DaysSinceLastSnowfall:
+      case EpwDataField::LiquidPrecipitationQuantity:
+        accept = value != 99;
+        break;
+      default: // PrecipitableWater, SnowDepth, Albedo and LiquidPrecipitationDepth
+        accept = value != 999;
+        break;
+    }
+    if (accept && warn) {
+      LOG_FREE(Warn, "openstudio.EpwFile", EpwDataField(field).valueName() << " value '" << value << "' not within the expected limits");
+    }
+    return accept;
+  }
+
+  // Whether the string setter of a field keeps the value as written by std::to_string rather than the text it was given
+  static bool epwFieldStoresToString(int field)
+  {
+    return field == EpwDataField::GlobalHorizontalRadiation || field == EpwDataField::WindSpeed;
+  }
+
+  // Number of decimals stored in EpwDataColumns for a value that is not written as a plain decimal number
+  static const uint8_t epwGenericDecimals = std::numeric_limits<uint8_t>::max();
+
+  // Writes a value stored in EpwDataColumns back out with its number of decimals. A value read from a plain decimal
+  // number is written from its integer mantissa, which gives the same digits as a fixed point format but is much faster.
+  static std::string formatEpwDecimals(double value, uint8_t decimals)
+  {
+    static const double scales[] = {1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9};
+    if (decimals == epwGenericDecimals) {
+      return fmt::format("{}", value);
+    }
+    if (decimals >= sizeof(scales) / sizeof(scales[0]) || !(std::abs(value) < 1.0e9)) {
+      return fmt::format("{:.{}f}", value, decimals);
+    }
+    long long mantissa = std::llround(value * scales[decimals]);
+    if (mantissa == 0 && std::signbit(value)) {
+      return fmt::format("{:.{}f}", value, decimals);
+    }
+    char digits[24];
+    char* end = std::to_chars(digits, digits + sizeof(digits), std::llabs(mantissa)).ptr;
+    size_t numDigits = end - digits;
+    std::string result;
+    result.reserve(numDigits + decimals + 3);
+    if (mantissa < 0) {
+      result += '-';
+    }
+    if (numDigits <= decimals) {
+      result.append(decimals + 1 - numDigits, '0');
+    }
+    result.append(digits, end);
+    if (decimals > 0) {
+      result.insert(result.size() - decimals, 1, '.');
+    }
+    return result;
+  }
+
+  static bool setEpwField(int field, double value, std::string& storage)
+  {
+    if (!acceptEpwFieldValue(field, value)) {
+      storage = epwMissingValue(field);
+      return false;
+    }
+    storage = std::to_string(value);
+    return true;
+  }
+
+  static bool setEpwField(int field, const std::string& text, std::string& storage)
+  {
+    bool ok;
+    double value = stringToDouble(text, &ok);
+    if (!ok || !acceptEpwFieldValue(field, value)) {
+      storage = epwMissingValue(field);
+      return false;
+    }
+    storage = epwFieldStoresToString(field) ? std::to_string(value) : text;
+    return true;
+  }
+
+  static bool setEpwField(int field, int value, int& storage)
+  {
+    if (!acceptEpwFieldValue(field, value)) {
+      storage = std::stoi(epwMissingValue(field));
+      return false;
+    }
+    storage = value;
+    return true;
+  }
+
+  static bool setEpwField(int field, const std::string& text, int& storage)
+  {
+    bool ok;
+    int value = stringToInteger(text, &ok);
+    if (!ok) {
+      // the present weather fields keep their value
+      if (field == EpwDataField::TotalSkyCover || field == EpwDataField::OpaqueSkyCover) {
+        storage = std::stoi(epwMissingValue(field));
+      }
+      return false;
+    }
+    return setEpwField(field, value, storage);
+  }
+
   Date EpwDataPoint::date() const
   {
     return Date(MonthOfYear(m_month), m_day, m_year);
@@ -1816,25 +2057,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setDryBulbTemperature(double value)
   {
-    if(-70 >= value || 70 <= value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "DryBulbTemperature value '" << value << "' not within the expected limits");
-    }
-    m_dryBulbTemperature = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::DryBulbTemperature, value, m_dryBulbTemperature);
   }
 
   bool EpwDataPoint::setDryBulbTemperature(const std::string &dryBulbTemperature)
   {
-    bool ok;
-    double value = stringToDouble(dryBulbTemperature, &ok);
-    if(!ok) {
-      m_dryBulbTemperature = "99.9";
-      return false;
-    } else if(-70 >= value || 70 <= value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "DryBulbTemperature value '" << value << "' not within the expected limits");
-    }
-    m_dryBulbTemperature = dryBulbTemperature;
-    return true;
+    return setEpwField(EpwDataField::DryBulbTemperature, dryBulbTemperature, m_dryBulbTemperature);
   }
 
   boost::optional<double> EpwDataPoint::dewPointTemperature() const
@@ -1847,25 +2075,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setDewPointTemperature(double value)
   {
-    if(-70 >= value || 70 <= value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "DewPointTemperature value '" << value << "' not within the expected limits");
-    }
-    m_dewPointTemperature = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::DewPointTemperature, value, m_dewPointTemperature);
   }
 
   bool EpwDataPoint::setDewPointTemperature(const std::string &dewPointTemperature)
   {
-    bool ok;
-    double value = stringToDouble(dewPointTemperature, &ok);
-    if(!ok) {
-      m_dewPointTemperature = "99.9";
-      return false;
-    } else if(-70 >= value || 70 <= value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "DewPointTemperature value '" << value << "' not within the expected limits");
-    }
-    m_dewPointTemperature = dewPointTemperature;
-    return true;
+    return setEpwField(EpwDataField::DewPointTemperature, dewPointTemperature, m_dewPointTemperature);
   }
 
   boost::optional<double> EpwDataPoint::relativeHumidity() const
@@ -1878,28 +2093,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setRelativeHumidity(double value)
   {
-    if(0 > value) {
-      m_relativeHumidity = "999";
-      return false;
-    } else if(110 < value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "RelativeHumidity value '" << value << "' not within the expected limits");
-    }
-    m_relativeHumidity = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::RelativeHumidity, value, m_relativeHumidity);
   }
 
   bool EpwDataPoint::setRelativeHumidity(const std::string &relativeHumidity)
   {
-    bool ok;
-    double value = stringToDouble(relativeHumidity, &ok);
-    if(!ok || 0 > value) {
-      m_relativeHumidity = "999";
-      return false;
-    } else if(110 < value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "RelativeHumidity value '" << value << "' not within the expected limits");
-    }
-    m_relativeHumidity = relativeHumidity;
-    return true;
+    return setEpwField(EpwDataField::RelativeHumidity, relativeHumidity, m_relativeHumidity);
   }
 
   boost::optional<double> EpwDataPoint::atmosphericStationPressure() const
@@ -1912,25 +2111,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setAtmosphericStationPressure(double value)
   {
-    if(31000 >= value || 120000 <= value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "AtmosphericStationPressure value '" << value << "' not within the expected limits");
-    }
-    m_atmosphericStationPressure = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::AtmosphericStationPressure, value, m_atmosphericStationPressure);
   }
 
   bool EpwDataPoint::setAtmosphericStationPressure(const std::string &atmosphericStationPressure)
   {
-    bool ok;
-    double value = stringToDouble(atmosphericStationPressure, &ok);
-    if(!ok) {
-      m_atmosphericStationPressure = "999999";
-      return false;
-    } else if(31000 >= value || 120000 <= value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "AtmosphericStationPressure value '" << value << "' not within the expected limits");
-    }
-    m_atmosphericStationPressure = atmosphericStationPressure;
-    return true;
+    return setEpwField(EpwDataField::AtmosphericStationPressure, atmosphericStationPressure, m_atmosphericStationPressure);
   }
 
   boost::optional<double> EpwDataPoint::extraterrestrialHorizontalRadiation() const
@@ -1943,24 +2129,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setExtraterrestrialHorizontalRadiation(double value)
   {
-    if(0 > value || value == 9999) {
-      m_extraterrestrialHorizontalRadiation = "9999";
-      return false;
-    }
-    m_extraterrestrialHorizontalRadiation = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::ExtraterrestrialHorizontalRadiation, value, m_extraterrestrialHorizontalRadiation);
   }
 
   bool EpwDataPoint::setExtraterrestrialHorizontalRadiation(const std::string &extraterrestrialHorizontalRadiation)
   {
-    bool ok;
-    double value = stringToDouble(extraterrestrialHorizontalRadiation, &ok);
-    if(!ok || 0 > value || value == 9999) {
-      m_extraterrestrialHorizontalRadiation = "9999";
-      return false;
-    }
-    m_extraterrestrialHorizontalRadiation = extraterrestrialHorizontalRadiation;
-    return true;
+    return setEpwField(EpwDataField::ExtraterrestrialHorizontalRadiation, extraterrestrialHorizontalRadiation, m_extraterrestrialHorizontalRadiation);
   }
 
   boost::optional<double> EpwDataPoint::extraterrestrialDirectNormalRadiation() const
@@ -1973,24 +2147,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setExtraterrestrialDirectNormalRadiation(double value)
   {
-    if(0 > value || value == 9999) {
-      m_extraterrestrialDirectNormalRadiation = "9999";
-      return false;
-    }
-    m_extraterrestrialDirectNormalRadiation = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::ExtraterrestrialDirectNormalRadiation, value, m_extraterrestrialDirectNormalRadiation);
   }
 
   bool EpwDataPoint::setExtraterrestrialDirectNormalRadiation(const std::string &extraterrestrialDirectNormalRadiation)
   {
-    bool ok;
-    double value = stringToDouble(extraterrestrialDirectNormalRadiation, &ok);
-    if(!ok || 0 > value || value == 9999) {
-      m_extraterrestrialDirectNormalRadiation = "9999";
-      return false;
-    }
-    m_extraterrestrialDirectNormalRadiation = extraterrestrialDirectNormalRadiation;
-    return true;
+    return setEpwField(EpwDataField::ExtraterrestrialDirectNormalRadiation, extraterrestrialDirectNormalRadiation, m_extraterrestrialDirectNormalRadiation);
   }
 
   boost::optional<double> EpwDataPoint::horizontalInfraredRadiationIntensity() const
@@ -2003,24 +2165,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setHorizontalInfraredRadiationIntensity(double value)
   {
-    if(0 > value || value == 9999) {
-      m_horizontalInfraredRadiationIntensity = "9999";
-      return false;
-    }
-    m_horizontalInfraredRadiationIntensity = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::HorizontalInfraredRadiationIntensity, value, m_horizontalInfraredRadiationIntensity);
   }
 
   bool EpwDataPoint::setHorizontalInfraredRadiationIntensity(const std::string &horizontalInfraredRadiationIntensity)
   {
-    bool ok;
-    double value = stringToDouble(horizontalInfraredRadiationIntensity, &ok);
-    if(!ok || 0 > value || value == 9999) {
-      m_horizontalInfraredRadiationIntensity = "9999";
-      return false;
-    }
-    m_horizontalInfraredRadiationIntensity = horizontalInfraredRadiationIntensity;
-    return true;
+    return setEpwField(EpwDataField::HorizontalInfraredRadiationIntensity, horizontalInfraredRadiationIntensity, m_horizontalInfraredRadiationIntensity);
   }
 
   boost::optional<double> EpwDataPoint::globalHorizontalRadiation() const
@@ -2033,23 +2183,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setGlobalHorizontalRadiation(double value)
   {
-    if(0 > value || value == 9999) {
-      m_globalHorizontalRadiation = "9999";
-      return false;
-    }
-    m_globalHorizontalRadiation = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::GlobalHorizontalRadiation, value, m_globalHorizontalRadiation);
   }
 
   bool EpwDataPoint::setGlobalHorizontalRadiation(const std::string &globalHorizontalRadiation)
   {
-    bool ok;
-    double value = stringToDouble(globalHorizontalRadiation, &ok);
-    if(!ok || 0 > value || value == 9999) {
-      m_globalHorizontalRadiation = "9999";
-      return false;
-    }
-    return setGlobalHorizontalRadiation(value);
+    return setEpwField(EpwDataField::GlobalHorizontalRadiation, globalHorizontalRadiation, m_globalHorizontalRadiation);
   }
 
   boost::optional<double> EpwDataPoint::directNormalRadiation() const
@@ -2062,24 +2201,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setDirectNormalRadiation(double value)
   {
-    if(0 > value || value == 9999) {
-      m_directNormalRadiation = "9999";
-      return false;
-    }
-    m_directNormalRadiation = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::DirectNormalRadiation, value, m_directNormalRadiation);
   }
 
   bool EpwDataPoint::setDirectNormalRadiation(const std::string &directNormalRadiation)
   {
-    bool ok;
-    double value = stringToDouble(directNormalRadiation, &ok);
-    if(!ok || 0 > value || value == 9999) {
-      m_directNormalRadiation = "9999";
-      return false;
-    }
-    m_directNormalRadiation = directNormalRadiation;
-    return true;
+    return setEpwField(EpwDataField::DirectNormalRadiation, directNormalRadiation, m_directNormalRadiation);
   }
 
   boost::optional<double> EpwDataPoint::diffuseHorizontalRadiation() const
@@ -2092,24 +2219,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setDiffuseHorizontalRadiation(double value)
   {
-    if(0 > value || value == 9999) {
-      m_diffuseHorizontalRadiation = "9999";
-      return false;
-    }
-    m_diffuseHorizontalRadiation = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::DiffuseHorizontalRadiation, value, m_diffuseHorizontalRadiation);
   }
 
   bool EpwDataPoint::setDiffuseHorizontalRadiation(const std::string &diffuseHorizontalRadiation)
   {
-    bool ok;
-    double value = stringToDouble(diffuseHorizontalRadiation, &ok);
-    if(!ok || 0 > value || value == 9999) {
-      m_diffuseHorizontalRadiation = "9999";
-      return false;
-    }
-    m_diffuseHorizontalRadiation = diffuseHorizontalRadiation;
-    return true;
+    return setEpwField(EpwDataField::DiffuseHorizontalRadiation, diffuseHorizontalRadiation, m_diffuseHorizontalRadiation);
   }
 
   boost::optional<double> EpwDataPoint::globalHorizontalIlluminance() const
@@ -2122,24 +2237,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setGlobalHorizontalIlluminance(double value)
   {
-    if(0 > value || 999900 < value) {
-      m_globalHorizontalIlluminance = "999999";
-      return false;
-    }
-    m_globalHorizontalIlluminance = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::GlobalHorizontalIlluminance, value, m_globalHorizontalIlluminance);
   }
 
   bool EpwDataPoint::setGlobalHorizontalIlluminance(const std::string &globalHorizontalIlluminance)
   {
-    bool ok;
-    double value = stringToDouble(globalHorizontalIlluminance, &ok);
-    if(!ok || 0 > value || 999900 < value) {
-      m_globalHorizontalIlluminance = "999999";
-      return false;
-    }
-    m_globalHorizontalIlluminance = globalHorizontalIlluminance;
-    return true;
+    return setEpwField(EpwDataField::GlobalHorizontalIlluminance, globalHorizontalIlluminance, m_globalHorizontalIlluminance);
   }
 
   boost::optional<double> EpwDataPoint::directNormalIlluminance() const
@@ -2152,24 +2255,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setDirectNormalIlluminance(double value)
   {
-    if(0 > value || 999900 < value) {
-      m_directNormalIlluminance = "999999";
-      return false;
-    }
-    m_directNormalIlluminance = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::DirectNormalIlluminance, value, m_directNormalIlluminance);
   }
 
   bool EpwDataPoint::setDirectNormalIlluminance(const std::string &directNormalIlluminance)
   {
-    bool ok;
-    double value = stringToDouble(directNormalIlluminance, &ok);
-    if(!ok || 0 > value || 999900 < value) {
-      m_directNormalIlluminance = "999999";
-      return false;
-    }
-    m_directNormalIlluminance = directNormalIlluminance;
-    return true;
+    return setEpwField(EpwDataField::DirectNormalIlluminance, directNormalIlluminance, m_directNormalIlluminance);
   }
 
   boost::optional<double> EpwDataPoint::diffuseHorizontalIlluminance() const
@@ -2182,24 +2273,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setDiffuseHorizontalIlluminance(double value)
   {
-    if(0 > value || 999900 < value) {
-      m_diffuseHorizontalIlluminance = "999999";
-      return false;
-    }
-    m_diffuseHorizontalIlluminance = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::DiffuseHorizontalIlluminance, value, m_diffuseHorizontalIlluminance);
   }
 
   bool EpwDataPoint::setDiffuseHorizontalIlluminance(const std::string &diffuseHorizontalIlluminance)
   {
-    bool ok;
-    double value = stringToDouble(diffuseHorizontalIlluminance, &ok);
-    if(!ok || 0 > value || 999900 < value) {
-      m_diffuseHorizontalIlluminance = "999999";
-      return false;
-    }
-    m_diffuseHorizontalIlluminance = diffuseHorizontalIlluminance;
-    return true;
+    return setEpwField(EpwDataField::DiffuseHorizontalIlluminance, diffuseHorizontalIlluminance, m_diffuseHorizontalIlluminance);
   }
 
   boost::optional<double> EpwDataPoint::zenithLuminance() const
@@ -2212,24 +2291,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setZenithLuminance(double value)
   {
-    if(0 > value || 9999 <= value) {
-      m_zenithLuminance = "9999";
-      return false;
-    }
-    m_zenithLuminance = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::ZenithLuminance, value, m_zenithLuminance);
   }
 
   bool EpwDataPoint::setZenithLuminance(const std::string &zenithLuminance)
   {
-    bool ok;
-    double value = stringToDouble(zenithLuminance, &ok);
-    if(!ok || 0 > value || 9999 <= value) {
-      m_zenithLuminance = "9999";
-      return false;
-    }
-    m_zenithLuminance = zenithLuminance;
-    return true;
+    return setEpwField(EpwDataField::ZenithLuminance, zenithLuminance, m_zenithLuminance);
   }
 
   boost::optional<double> EpwDataPoint::windDirection() const
@@ -2242,24 +2309,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setWindDirection(double value)
   {
-    if(0 > value || 360 < value) {
-      m_windDirection = "999";
-      return false;
-    }
-    m_windDirection = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::WindDirection, value, m_windDirection);
   }
 
   bool EpwDataPoint::setWindDirection(const std::string &windDirection)
   {
-    bool ok;
-    double value = stringToDouble(windDirection, &ok);
-    if(!ok || 0 > value || 360 < value) {
-      m_windDirection = "999";
-      return false;
-    }
-    m_windDirection = windDirection;
-    return true;
+    return setEpwField(EpwDataField::WindDirection, windDirection, m_windDirection);
   }
 
   boost::optional<double> EpwDataPoint::windSpeed() const
@@ -2272,27 +2327,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setWindSpeed(double value)
   {
-    if(0 > value) {
-      m_windSpeed = "999";
-      return false;
-    } else if(40 < value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "WindSpeed value '" << value << "' not within the expected limits");
-    }
-    m_windSpeed = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::WindSpeed, value, m_windSpeed);
   }
 
   bool EpwDataPoint::setWindSpeed(const std::string &windSpeed)
   {
-    bool ok;
-    double value = stringToDouble(windSpeed, &ok);
-    if(!ok || 0 > value) {
-      m_windSpeed = "999";
-      return false;
-    } else if(40 < value) {
-      LOG_FREE(Warn, "openstudio.EpwFile", "WindSpeed value '" << value << "' not within the expected limits");
-    }
-    return setWindSpeed(value);
+    return setEpwField(EpwDataField::WindSpeed, windSpeed, m_windSpeed);
   }
 
   int EpwDataPoint::totalSkyCover() const
@@ -2302,23 +2342,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setTotalSkyCover(int value)
   {
-    if(0 > value || 10 < value) {
-      m_totalSkyCover = 99;
-      return false;
-    }
-    m_totalSkyCover = value;
-    return true;
+    return setEpwField(EpwDataField::TotalSkyCover, value, m_totalSkyCover);
   }
 
   bool EpwDataPoint::setTotalSkyCover(const std::string &totalSkyCover)
   {
-    bool ok;
-    int value = stringToInteger(totalSkyCover, &ok);
-    if(!ok || 0 > value || 10 < value) {
-      m_totalSkyCover = 99;
-      return false;
-    }
-    return setTotalSkyCover(value);
+    return setEpwField(EpwDataField::TotalSkyCover, totalSkyCover, m_totalSkyCover);
   }
 
   int EpwDataPoint::opaqueSkyCover() const
@@ -2328,23 +2357,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setOpaqueSkyCover(int value)
   {
-    if(0 > value || 10 < value) {
-      m_opaqueSkyCover = 99;
-      return false;
-    }
-    m_opaqueSkyCover = value;
-    return true;
+    return setEpwField(EpwDataField::OpaqueSkyCover, value, m_opaqueSkyCover);
   }
 
   bool EpwDataPoint::setOpaqueSkyCover(const std::string &opaqueSkyCover)
   {
-    bool ok;
-    int value = stringToInteger(opaqueSkyCover, &ok);
-    if(!ok || 0 > value || 10 < value) {
-      m_opaqueSkyCover = 99;
-      return false;
-    }
-    return setOpaqueSkyCover(value);
+    return setEpwField(EpwDataField::OpaqueSkyCover, opaqueSkyCover, m_opaqueSkyCover);
   }
 
   boost::optional<double> EpwDataPoint::visibility() const
@@ -2357,24 +2375,12 @@ namespace openstudio{
 
   bool EpwDataPoint::setVisibility(double value)
   {
-    if(value == 9999) {
-      m_visibility = "9999";
-      return false;
-    }
-    m_visibility = std::to_string(value);
-    return true;
+    return setEpwField(EpwDataField::Visibility, value, m_visibility);
   }
 
   bool EpwDataPoint::setVisibility(const std::string &visibility)
   {
-    bool ok;
-    double value = stringToDouble(visibility, &ok);
-    if(!ok || value == 9999) {
-      m_visibility = "9999";
-      return false;
-    }
-    m_visibility = visibility;
-    return true;
+    return setEpwField(EpwDataField::Visibility, visibility, m_visibility);
   }
 
   boost::optional<double> EpwDataPoint::ceilingHeight() const
@@ -2392,14 +2398,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setCeilingHeight(const std::string &ceilingHeight)
   {
-    bool ok;
-    double value = stringToDouble(ceilingHeight, &ok);
-    if(!ok || value == 99999) {
-      m_ceilingHeight = "99999";
-      return false;
-    }
-    m_ceilingHeight = ceilingHeight;
-    return true;
+    return setEpwField(EpwDataField::CeilingHeight, ceilingHeight, m_ceilingHeight);
   }
 
   int EpwDataPoint::presentWeatherObservation() const
@@ -2414,13 +2413,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setPresentWeatherObservation(const std::string &presentWeatherObservation)
   {
-    bool ok;
-    int value = stringToInteger(presentWeatherObservation, &ok);
-    if(!ok) {
-      return false;
-    }
-    m_presentWeatherObservation = value;
-    return true;
+    return setEpwField(EpwDataField::PresentWeatherObservation, presentWeatherObservation, m_presentWeatherObservation);
   }
 
   int EpwDataPoint::presentWeatherCodes() const
@@ -2435,13 +2428,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setPresentWeatherCodes(const std::string &presentWeatherCodes)
   {
-    bool ok;
-    int value = stringToInteger(presentWeatherCodes, &ok);
-    if(!ok) {
-      return false;
-    }
-    m_presentWeatherCodes = value;
-    return true;
+    return setEpwField(EpwDataField::PresentWeatherCodes, presentWeatherCodes, m_presentWeatherCodes);
   }
 
   boost::optional<double> EpwDataPoint::precipitableWater() const
@@ -2459,14 +2446,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setPrecipitableWater(const std::string &precipitableWater)
   {
-    bool ok;
-    double value = stringToDouble(precipitableWater, &ok);
-    if(!ok || value == 999) {
-      m_precipitableWater = "999";
-      return false;
-    }
-    m_precipitableWater = precipitableWater;
-    return true;
+    return setEpwField(EpwDataField::PrecipitableWater, precipitableWater, m_precipitableWater);
   }
 
   boost::optional<double> EpwDataPoint::aerosolOpticalDepth() const
@@ -2484,14 +2464,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setAerosolOpticalDepth(const std::string &aerosolOpticalDepth)
   {
-    bool ok;
-    double value = stringToDouble(aerosolOpticalDepth, &ok);
-    if(!ok || value == 0.999) {
-      m_aerosolOpticalDepth = ".999";
-      return false;
-    }
-    m_aerosolOpticalDepth = aerosolOpticalDepth;
-    return true;
+    return setEpwField(EpwDataField::AerosolOpticalDepth, aerosolOpticalDepth, m_aerosolOpticalDepth);
   }
 
   boost::optional<double> EpwDataPoint::snowDepth() const
@@ -2509,14 +2482,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setSnowDepth(const std::string &snowDepth)
   {
-    bool ok;
-    double value = stringToDouble(snowDepth, &ok);
-    if(!ok || value == 999) {
-      m_snowDepth = "999";
-      return false;
-    }
-    m_snowDepth = snowDepth;
-    return true;
+    return setEpwField(EpwDataField::SnowDepth, snowDepth, m_snowDepth);
   }
 
   boost::optional<double> EpwDataPoint::daysSinceLastSnowfall() const
@@ -2534,14 +2500,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setDaysSinceLastSnowfall(const std::string &daysSinceLastSnowfall)
   {
-    bool ok;
-    double value = stringToDouble(daysSinceLastSnowfall, &ok);
-    if(!ok || value == 99) {
-      m_daysSinceLastSnowfall = "99";
-      return false;
-    }
-    m_daysSinceLastSnowfall = daysSinceLastSnowfall;
-    return true;
+    return setEpwField(EpwDataField::DaysSinceLastSnowfall, daysSinceLastSnowfall, m_daysSinceLastSnowfall);
   }
 
   boost::optional<double> EpwDataPoint::albedo() const
@@ -2559,14 +2518,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setAlbedo(const std::string &albedo)
   {
-    bool ok;
-    double value = stringToDouble(albedo, &ok);
-    if(!ok || value == 999) {
-      m_albedo = "999";
-      return false;
-    }
-    m_albedo = albedo;
-    return true;
+    return setEpwField(EpwDataField::Albedo, albedo, m_albedo);
   }
 
   boost::optional<double> EpwDataPoint::liquidPrecipitationDepth() const
@@ -2584,14 +2536,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setLiquidPrecipitationDepth(const std::string &liquidPrecipitationDepth)
   {
-    bool ok;
-    double value = stringToDouble(liquidPrecipitationDepth, &ok);
-    if(!ok || value == 999) {
-      m_liquidPrecipitationDepth = "999";
-      return false;
-    }
-    m_liquidPrecipitationDepth = liquidPrecipitationDepth;
-    return true;
+    return setEpwField(EpwDataField::LiquidPrecipitationDepth, liquidPrecipitationDepth, m_liquidPrecipitationDepth);
   }
 
   boost::optional<double> EpwDataPoint::liquidPrecipitationQuantity() const
@@ -2609,14 +2554,7 @@ namespace openstudio{
 
   bool EpwDataPoint::setLiquidPrecipitationQuantity(const std::string &liquidPrecipitationQuantity)
   {
-    bool ok;
-    double value = stringToDouble(liquidPrecipitationQuantity, &ok);
-    if(!ok || value == 99) {
-      m_liquidPrecipitationQuantity = "99";
-      return false;
-    }
-    m_liquidPrecipitationQuantity = liquidPrecipitationQuantity;
-    return true;
+    return setEpwField(EpwDataField::LiquidPrecipitationQuantity, liquidPrecipitationQuantity, m_liquidPrecipitationQuantity);
   }
 
   boost::optional<AirState> EpwDataPoint::airState() const
@@ -2705,6 +2643,545 @@ namespace openstudio{
     return boost::none;
   }
 
+  EpwDataColumns::EpwDataColumns()
+    : m_columns(EpwDataField::LiquidPrecipitationQuantity + 1), m_missing(EpwDataField::LiquidPrecipitationQuantity + 1),
+      m_decimals(EpwDataField::LiquidPrecipitationQuantity + 1)
+  {}
+
+  unsigned EpwDataColumns::numRecords() const
+  {
+    return m_years.size();
+  }
+
+  bool EpwDataColumns::empty() const
+  {
+    return m_years.empty();
+  }
+
+  const std::vector<int>& EpwDataColumns::years() const
+  {
+    return m_years;
+  }
+
+  const std::vector<int>& EpwDataColumns::months() const
+  {
+    return m_months;
+  }
+
+  const std::vector<int>& EpwDataColumns::days() const
+  {
+    return m_days;
+  }
+
+  const std::vector<int>& EpwDataColumns::hours() const
+  {
+    return m_hours;
+  }
+
+  const std::vector<int>& EpwDataColumns::minutes() const
+  {
+    return m_minutes;
+  }
+
+  const std::vector<std::string>& EpwDataColumns::dataSourceandUncertaintyFlags() const
+  {
+    return m_dataSourceandUncertaintyFlags;
+  }
+
+  Date EpwDataColumns::date(unsigned record) const
+  {
+    return Date(MonthOfYear(m_months[record]), m_days[record], m_years[record]);
+  }
+
+  Time EpwDataColumns::time(unsigned record) const
+  {
+    return Time(0, m_hours[record], m_minutes[record]);
+  }
+
+  DateTime EpwDataColumns::dateTime(unsigned record) const
+  {
+    return DateTime(date(record), time(record));
+  }
+
+  bool EpwDataColumns::isNumeric(EpwDataField field)
+  {
+    return field.value() >= EpwDataField::DryBulbTemperature;
+  }
+
+  const std::vector<double>& EpwDataColumns::column(EpwDataField field) const
+  {
+    if (!isNumeric(field)) {
+      LOG_FREE_AND_THROW("openstudio.EpwFile", "EPW data field '" << field.valueDescription() << "' is not stored as a numeric column");
+    }
+    return m_columns[field.value()];
+  }
+
+  const std::vector<uint64_t>& EpwDataColumns::missingMask(EpwDataField field) const
+  {
+    if (!isNumeric(field)) {
+      LOG_FREE_AND_THROW("openstudio.EpwFile", "EPW data field '" << field.valueDescription() << "' is not stored as a numeric column");
+    }
+    return m_missing[field.value()];
+  }
+
+  bool EpwDataColumns::isMissing(EpwDataField field, unsigned record) const
+  {
+    const std::vector<uint64_t>& mask = missingMask(field);
+    return (mask[record / 64] >> (record % 64)) & 1u;
+  }
+
+  boost::optional<double> EpwDataColumns::value(EpwDataField field, unsigned record) const
+  {
+    if (isMissing(field, record)) {
+      return boost::none;
+    }
+    return m_columns[field.value()][record];
+  }
+
+  boost::optional<AirState> EpwDataColumns::airState(unsigned record) const
+  {
+    boost::optional<double> drybulb = value(EpwDataField::DryBulbTemperature, record);
+    if (!drybulb) {
+      return boost::none; // Have to have dry bulb
+    }
+    boost::optional<double> pressure = value(EpwDataField::AtmosphericStationPressure, record);
+    if (!pressure) {
+      return boost::none; // Have to have pressure
+    }
+    boost::optional<double> RH = value(EpwDataField::RelativeHumidity, record);
+    if (RH) {
+      return AirState::fromDryBulbRelativeHumidityPressure(drybulb.get(), RH.get(), pressure.get());
+    }
+    boost::optional<double> dewpoint = value(EpwDataField::DewPointTemperature, record);
+    if (dewpoint) {
+      return AirState::fromDryBulbDewPointPressure(drybulb.get(), dewpoint.get(), pressure.get());
+    }
+    return boost::none;
+  }
+
+  EpwDataPoint EpwDataColumns::dataPoint(unsigned record) const
+  {
+    // The strings of an empty data point hold the missing value of every field
+    static const std::vector<std::string> missingStrings = EpwDataPoint().toEpwStrings();
+    std::vector<std::string> list = missingStrings;
+    list[EpwDataField::DataSourceandUncertaintyFlags] = m_dataSourceandUncertaintyFlags[record];
+    for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+      if (!((m_missing[field][record / 64] >> (record % 64)) & 1u)) {
+        list[field] = formatEpwDecimals(m_columns[field][record], m_decimals[field][record]);
+      }
+    }
+    boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(m_years[record], m_months[record], m_days[record],
+      m_hours[record], m_minutes[record], list);
+    OS_ASSERT(pt);
+    return std::move(pt.get());
+  }
+
+  void EpwDataColumns::clear()
+  {
+    *this = EpwDataColumns();
+  }
+
+  void EpwDataColumns::reserve(unsigned numRecords)
+  {
+    m_years.reserve(numRecords);
+    m_months.reserve(numRecords);
+    m_days.reserve(numRecords);
+    m_hours.reserve(numRecords);
+    m_minutes.reserve(numRecords);
+    m_dataSourceandUncertaintyFlags.reserve(numRecords);
+    for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+      m_columns[field].reserve(numRecords);
+      m_missing[field].reserve((numRecords + 63) / 64);
+      m_decimals[field].reserve(numRecords);
+    }
+  }
+
+  void EpwDataColumns::appendRecord(int year, int month, int day, int hour, int minute, const std::string& dataSourceandUncertaintyFlags,
+    const double* values, const bool* missing, const uint8_t* decimals)
+  {
+    unsigned record = numRecords();
+    m_years.push_back(year);
+    m_months.push_back(month);
+    m_days.push_back(day);
+    m_hours.push_back(hour);
+    m_minutes.push_back(minute);
+    m_dataSourceandUncertaintyFlags.push_back(dataSourceandUncertaintyFlags);
+    for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+      std::vector<uint64_t>& mask = m_missing[field];
+      if (record % 64 == 0) {
+        mask.push_back(0);
+      }
+      if (missing[field]) {
+        m_columns[field].push_back(std::numeric_limits<double>::quiet_NaN());
+        mask.back() |= uint64_t(1) << (record % 64);
+      } else {
+        m_columns[field].push_back(values[field]);
+      }
+      m_decimals[field].push_back(decimals[field]);
+    }
+  }
+
+  EpwComputedColumns::EpwComputedColumns()
+    : m_columns(EpwComputedField::SpecificVolume + 1)
+  {}
+
+  EpwComputedColumns::EpwComputedColumns(const EpwDataColumns& columns)
+    : m_columns(EpwComputedField::SpecificVolume + 1)
+  {
+    // The same equations as AirState, applied one step at a time to all of the records so that every loop runs over
+    // contiguous arrays without optionals or object construction
+    const unsigned n = columns.numRecords();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::vector<double>& column : m_columns) {
+      column.assign(n, nan);
+    }
+    if (n == 0) {
+      return;
+    }
+
+    // Missing values are NaN in the data columns, and NaN fails every range check below
+    const double* drybulb = columns.column(EpwDataField::DryBulbTemperature).data();
+    const double* dewpoint = columns.column(EpwDataField::DewPointTemperature).data();
+    const double* RH = columns.column(EpwDataField::RelativeHumidity).data();
+    const double* pressure = columns.column(EpwDataField::AtmosphericStationPressure).data();
+
+    double* psatColumn = m_columns[EpwComputedField::SaturationPressure].data();
+    double* enthalpy = m_columns[EpwComputedField::Enthalpy].data();
+    double* W = m_columns[EpwComputedField::HumidityRatio].data();
+    double* wetbulb = m_columns[EpwComputedField::WetBulbTemperature].data();
+    double* density = m_columns[EpwComputedField::Density].data();
+    double* specificVolume = m_columns[EpwComputedField::SpecificVolume].data();
+
+    // Which records have a state, and whether it comes from the relative humidity or the dew point, as in
+    // EpwDataColumns::airState and the AirState factory methods
+    std::vector<unsigned char> valid(n);
+    std::vector<unsigned char> fromRH(n);
+    for (unsigned i = 0; i < n; ++i) {
+      bool haveRH = !std::isnan(RH[i]);
+      bool drybulbOk = drybulb[i] >= -100.0 && drybulb[i] <= 200.0;
+      bool humidityOk = haveRH ? (RH[i] >= 0.0 && RH[i] <= 100.0) : (dewpoint[i] >= -100.0 && dewpoint[i] <= 200.0);
+      fromRH[i] = haveRH;
+      valid[i] = drybulbOk && humidityOk && !std::isnan(pressure[i]);
+    }
+
+    // Saturation pressure only needs the dry bulb temperature, eqns 5 and 6
+    for (unsigned i = 0; i < n; ++i) {
+      if (drybulb[i] >= -100.0 && drybulb[i] <= 200.0) {
+        psatColumn[i] = psat(drybulb[i]);
+      }
+    }
+
+    // Partial pressure of water vapor, eqn 24 with relative humidity or eqn 38 with the dew point
+    std::vector<double> pw(n, nan);
+    for (unsigned i = 0; i < n; ++i) {
+      if (valid[i]) {
+        pw[i] = fromRH[i] ? (0.01*RH[i]) * psatColumn[i] : psat(dewpoint[i]);
+      }
+    }
+
+    // Humidity ratio (eqn 22), enthalpy (eqn 32) and specific volume (eqn 28)
+    for (unsigned i = 0; i < n; ++i) {
+      double w = moistAirHumidityRatio(pw[i], pressure[i]);
+      double v = moistAirSpecificVolume(drybulb[i], w, pressure[i]);
+      W[i] = w;
+      enthalpy[i] = moistAirEnthalpy(drybulb[i], w);
+      specificVolume[i] = v;
+      density[i] = 1.0 / v;
+    }
+
+    // AirState also solves for the dew point when it is given the relative humidity, and has no state if that fails
+    std::vector<unsigned> active;
+    active.reserve(n);
+    for (unsigned i = 0; i < n; ++i) {
+      if (valid[i] && fromRH[i]) {
+        active.push_back(i);
+      }
+    }
+    std::vector<double> tdew(n);
+    for (unsigned i : active) {
+      tdew[i] = drybulb[i];
+    }
+    for (int iter = 0; iter < 100 && !active.empty(); ++iter) {
+      unsigned numActive = 0;
+      for (unsigned i : active) {
+        double delta = dewPointNewtonStep(pw[i], tdew[i]);
+        tdew[i] += delta;
+        if (!newtonConverged(delta, tdew[i], 1e-4)) {
+          active[numActive++] = i;
+        }
+      }
+      active.resize(numActive);
+    }
+    for (unsigned i : active) {
+      valid[i] = false;
+    }
+
+    // Wet bulb temperature, solved with the Newton steps of solveForWetBulb for all records at once
+    active.clear();
+    for (unsigned i = 0; i < n; ++i) {
+      if (valid[i]) {
+        active.push_back(i);
+        wetbulb[i] = drybulb[i];
+      }
+    }
+    for (int iter = 0; iter < 100 && !active.empty(); ++iter) {
+      unsigned numActive = 0;
+      for (unsigned i : active) {
+        double delta = wetBulbNewtonStep(drybulb[i], pressure[i], W[i], wetbulb[i]);
+        wetbulb[i] += delta;
+        if (!newtonConverged(delta, wetbulb[i], 1e-4)) {
+          active[numActive++] = i;
+        }
+      }
+      active.resize(numActive);
+    }
+    for (unsigned i : active) {
+      valid[i] = false;
+    }
+
+    // Records without a state have no value for anything but the saturation pressure
+    for (unsigned i = 0; i < n; ++i) {
+      if (!valid[i]) {
+        enthalpy[i] = nan;
+        W[i] = nan;
+        wetbulb[i] = nan;
+        density[i] = nan;
+        specificVolume[i] = nan;
+      }
+    }
+  }
+
+  unsigned EpwComputedColumns::numRecords() const
+  {
+    return m_columns[EpwComputedField::SaturationPressure].size();
+  }
+
+  bool EpwComputedColumns::empty() const
+  {
+    return m_columns[EpwComputedField::SaturationPressure].empty();
+  }
+
+  const std::vector<double>& EpwComputedColumns::column(EpwComputedField field) const
+  {
+    return m_columns[field.value()];
+  }
+
+  boost::optional<double> EpwComputedColumns::value(EpwComputedField field, unsigned record) const
+  {
+    double value = m_columns[field.value()][record];
+    if (std::isnan(value)) {
+      return boost::none;
+    }
+    return value;
+  }
+
+  namespace {
+
+    const char dataCacheMagic[8] = {'O', 'S', 'E', 'P', 'W', 'D', 'A', 'T'};
+    const uint32_t dataCacheVersion = 2;
+    const uint32_t dataCacheByteOrder = 0x01020304;
+
+    typedef std::pair<const char*, const char*> FieldRange;
+
+    // Reads the next line of [pos, end) the same way std::getline does
+    bool nextLine(const char*& pos, const char* end, const char*& lineBegin, const char*& lineEnd)
+    {
+      if (pos == end) {
+        return false;
+      }
+      lineBegin = pos;
+      lineEnd = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+      if (lineEnd) {
+        pos = lineEnd + 1;
+      } else {
+        lineEnd = end;
+        pos = end;
+      }
+      return true;
+    }
+
+    // Splits a line on commas the same way splitString does, without copying the fields
+    void splitFields(const char* begin, const char* end, std::vector<FieldRange>& fields)
+    {
+      fields.clear();
+      if (begin == end) {
+        return;
+      }
+      const char* start = begin;
+      for (const char* p = begin; p != end; ++p) {
+        if (*p == ',') {
+          fields.emplace_back(start, p);
+          start = p + 1;
+        }
+      }
+      fields.emplace_back(start, end);
+    }
+
+    bool fieldEquals(const FieldRange& field, const char* text)
+    {
+      size_t n = std::strlen(text);
+      return size_t(field.second - field.first) == n && std::memcmp(field.first, text, n) == 0;
+    }
+
+    // Same result as stringToInteger, plain integers are converted with from_chars and anything else goes through std::stoi
+    bool fieldToInteger(const FieldRange& field, int& value)
+    {
+      std::from_chars_result result = std::from_chars(field.first, field.second, value);
+      if (result.ec == std::errc() && result.ptr == field.second) {
+        return true;
+      }
+      bool ok;
+      value = stringToInteger(std::string(field.first, field.second), &ok);
+      return ok;
+    }
+
+    // Same result as stringToDouble, plain numbers are converted with from_chars where the standard library supports
+    // it for floating point, and anything else goes through std::stod
+    bool fieldToDouble(const FieldRange& field, double& value)
+    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+      std::from_chars_result result = std::from_chars(field.first, field.second, value);
+      if (result.ec == std::errc() && result.ptr == field.second) {
+        return true;
+      }
+#endif
+      bool ok;
+      value = stringToDouble(std::string(field.first, field.second), &ok);
+      return ok;
+    }
+
+    // The setters that store std::to_string(value) return std::stod of that string, which only differs from the value
+    // itself for numbers written with more than 6 decimals or in exponent notation
+    double toStringRoundTrip(const FieldRange& field, double value)
+    {
+      const char* dot = std::find(field.first, field.second, '.');
+      bool plain = std::abs(value) < 1.0e9 && (field.second - dot) <= 7
+        && std::find_if(field.first, field.second, [](char c) { return c == 'e' || c == 'E'; }) == field.second;
+      if (plain) {
+        return value;
+      }
+      return std::stod(std::to_string(value));
+    }
+
+    // Number of decimals a field is written with, for the values that are written as plain decimal numbers
+    uint8_t fieldDecimals(const FieldRange& field)
+    {
+      if (std::find_if(field.first, field.second, [](char c) { return c == 'e' || c == 'E'; }) != field.second) {
+        return epwGenericDecimals;
+      }
+      const char* dot = std::find(field.first, field.second, '.');
+      if (dot == field.second) {
+        return 0;
+      }
+      return uint8_t(std::min<ptrdiff_t>(field.second - dot - 1, epwGenericDecimals - 1));
+    }
+
+    // Decodes a field with the rules of the EpwDataPoint setters and getters: values that the setter rejects are missing,
+    // and so are values stored as the missing value of the field, the number of decimals is kept to write the value back out
+    void decodeField(int field, const FieldRange& text, double& value, bool& missing, uint8_t& decimals)
+    {
+      missing = false;
+      decimals = 0;
+      if (field == EpwDataField::TotalSkyCover || field == EpwDataField::OpaqueSkyCover
+          || field == EpwDataField::PresentWeatherObservation || field == EpwDataField::PresentWeatherCodes) {
+        int ivalue = 0;
+        if (!fieldToInteger(text, ivalue) || !acceptEpwFieldValue(field, ivalue)) {
+          ivalue = std::stoi(epwMissingValue(field));
+        }
+        value = ivalue;
+        return;
+      }
+
+      if (!fieldToDouble(text, value) || !acceptEpwFieldValue(field, value)) {
+        missing = true;
+      } else if (epwFieldStoresToString(field)) {
+        value = toStringRoundTrip(text, value);
+      } else {
+        missing = fieldEquals(text, epwMissingValue(field));
+      }
+      if (!missing) {
+        decimals = fieldDecimals(text);
+      }
+    }
+
+    // Tracks the dates of the data records to find the data period and whether the file looks like actual (AMY) data
+    struct DataPeriodTracker
+    {
+      boost::optional<Date> startDate;
+      boost::optional<Date> lastDate;
+      boost::optional<Date> endDate;
+      bool realYear = true;
+      bool wrapAround = false;
+
+      void add(const Date& date, int lineNumber, const openstudio::path& p)
+      {
+        if (!startDate) {
+          startDate = date;
+        }
+        endDate = date;
+
+        if (lastDate) {
+          Time delta = endDate.get() - lastDate.get();
+          if (std::abs(delta.totalDays()) > 1) {
+            if (realYear) { // Warn once
+              LOG_FREE(Warn, "openstudio.EpwFile", "Successive data points (" << lastDate.get() << " to " << endDate.get()
+                  << ", ending on line " << lineNumber << ") are greater than 1 day apart in EPW file '"
+                  << p << "'. Data will be treated as typical (TMY)");
+            }
+            realYear = false;
+          }
+
+          if (endDate->monthOfYear().value() < lastDate->monthOfYear().value()) {
+            wrapAround = true;
+          }
+        }
+        lastDate = date;
+      }
+    };
+
+    std::mutex& dataCacheMutex()
+    {
+      static std::mutex mutex;
+      return mutex;
+    }
+
+    openstudio::path& dataCacheDirectoryStorage()
+    {
+      static openstudio::path directory;
+      return directory;
+    }
+
+    template <typename T>
+    void writeVector(std::ostream& os, const std::vector<T>& values)
+    {
+      os.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    template <typename T>
+    bool readVector(const char*& pos, const char* end, std::vector<T>& values, size_t n)
+    {
+      if (size_t(end - pos) < n * sizeof(T)) {
+        return false;
+      }
+      values.resize(n);
+      std::memcpy(values.data(), pos, n * sizeof(T));
+      pos += n * sizeof(T);
+      return true;
+    }
+
+    template <typename T>
+    bool readValue(const char*& pos, const char* end, T& value)
+    {
+      if (size_t(end - pos) < sizeof(T)) {
+        return false;
+      }
+      std::memcpy(&value, pos, sizeof(T));
+      pos += sizeof(T);
+      return true;
+    }
+
+  }
+
   EpwFile::EpwFile(const openstudio::path& p, bool storeData)
     : m_path(p), m_latitude(0), m_longitude(0), m_timeZone(0), m_elevation(0), m_isActual(false), m_minutesMatch(true)
   {
@@ -2712,17 +3189,10 @@ namespace openstudio{
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs, storeData)){
-      ifs.close();
+    // the checksum is set from the file contents while parsing
+    if (!parseFile(storeData)){
       LOG_AND_THROW("EpwFile '" << toString(p) << "' cannot be processed");
     }
-    ifs.close();
   }
 
   EpwFile::EpwFile()
@@ -2743,8 +3213,7 @@ namespace openstudio{
   boost::optional<EpwFile> EpwFile::loadFromString(const std::string& str, bool storeData)
   {
     EpwFile result;
-    std::stringstream ss(str);
-    if (result.parse(ss, storeData)){
+    if (result.parse(str.data(), str.data() + str.size(), storeData)){
       result.m_checksum = openstudio::checksum(str);
     }else{
       return boost::none;
@@ -2846,25 +3315,226 @@ namespace openstudio{
 
   std::vector<EpwDataPoint> EpwFile::data()
   {
-    if(m_data.size()==0){
-      if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
-        LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
+    // Only the columns are kept, the data points are built from them on demand
+    const EpwDataColumns& columns = dataColumns();
+    std::vector<EpwDataPoint> result;
+    result.reserve(columns.numRecords());
+    for (unsigned i = 0; i < columns.numRecords(); ++i) {
+      result.push_back(columns.dataPoint(i));
+    }
+    return result;
+  }
+
+  const EpwDataColumns& EpwFile::dataColumns()
+  {
+    if (m_columns.empty()) {
+      loadData();
+    }
+    return m_columns;
+  }
+
+  const EpwComputedColumns& EpwFile::computedColumns()
+  {
+    const EpwDataColumns& columns = dataColumns();
+    if (m_computedColumns.numRecords() != columns.numRecords()) {
+      m_computedColumns = EpwComputedColumns(columns);
+    }
+    return m_computedColumns;
+  }
+
+  bool EpwFile::loadData()
+  {
+    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
+      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
+    }
+
+    if (!parseFile(true)){
+      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
+      return false;
+    }
+    return true;
+  }
+
+  bool EpwFile::parseFile(bool storeData)
+  {
+    // data read after the file was loaded has to come from the same file contents
+    auto checkChecksum = [this](const std::string& checksum) {
+      if (!m_checksum.empty() && (checksum != m_checksum)) {
+        LOG(Error, "EPW file '" << m_path << "' has changed since it was loaded, checksum " << checksum << " does not match " << m_checksum);
+        return false;
       }
+      m_checksum = checksum;
+      return true;
+    };
 
-      // set checksum
-      m_checksum = openstudio::checksum(m_path);
+    if (openstudio::filesystem::file_size(m_path) == 0) {
+      if (!checkChecksum(openstudio::checksum(std::string()))) {
+        return false;
+      }
+      return parse(nullptr, nullptr, storeData);
+    }
+    boost::iostreams::mapped_file_source file;
+    try {
+      file.open(m_path);
+    } catch (const std::exception&) {
+    }
+    if (!file.is_open()) {
+      LOG(Error, "Could not open EPW file '" << m_path << "'");
+      return false;
+    }
+    if (!checkChecksum(openstudio::checksum(file.data(), file.size()))) {
+      return false;
+    }
+
+    return parse(file.data(), file.data() + file.size(), storeData);
+  }
+
+  void EpwFile::setDataCacheDirectory(const openstudio::path& directory)
+  {
+    std::lock_guard<std::mutex> lock(dataCacheMutex());
+    dataCacheDirectoryStorage() = directory;
+  }
+
+  openstudio::path EpwFile::dataCacheDirectory()
+  {
+    std::lock_guard<std::mutex> lock(dataCacheMutex());
+    return dataCacheDirectoryStorage();
+  }
+
+  openstudio::path EpwFile::dataCachePath() const
+  {
+    return dataCacheDirectory() / toPath(m_checksum + ".epwdata");
+  }
+
+  bool EpwFile::readDataCache(uintmax_t sourceSize, EpwDataColumns& columns, bool& minutesMatch) const
+  {
+    openstudio::path p = dataCachePath();
+    boost::system::error_code ec;
+    if (!openstudio::filesystem::is_regular_file(p, ec)) {
+      return false;
+    }
+    uintmax_t size = openstudio::filesystem::file_size(p, ec);
+    if (ec) {
+      return false;
+    }
+
+    // Read the whole file at once, everything after that is a copy out of the buffer
+    std::vector<char> buffer(size);
+    openstudio::filesystem::ifstream ifs(p, std::ios_base::binary);
+    if (!ifs.read(buffer.data(), buffer.size())) {
+      return false;
+    }
+    const char* pos = buffer.data();
+    const char* end = buffer.data() + buffer.size();
+
+    uint32_t version = 0;
+    uint32_t byteOrder = 0;
+    uint64_t cachedSourceSize = 0;
+    int32_t recordsPerHour = 0;
+    uint32_t numFields = 0;
+    uint32_t flag = 0;
+    uint64_t n = 0;
+    if (size < sizeof(dataCacheMagic) || std::memcmp(pos, dataCacheMagic, sizeof(dataCacheMagic)) != 0) {
+      return false;
+    }
+    pos += sizeof(dataCacheMagic);
+    bool ok = readValue(pos, end, version) && version == dataCacheVersion
+      && readValue(pos, end, byteOrder) && byteOrder == dataCacheByteOrder
+      && readValue(pos, end, cachedSourceSize) && cachedSourceSize == sourceSize
+      && readValue(pos, end, recordsPerHour) && recordsPerHour == m_recordsPerHour
+      && readValue(pos, end, numFields) && numFields == unsigned(EpwDataField::LiquidPrecipitationQuantity) + 1
+      && readValue(pos, end, flag)
+      && readValue(pos, end, n);
+    if (!ok) {
+      return false;
+    }
+    minutesMatch = (flag != 0);
+
+    EpwDataColumns result;
+    size_t numRecords = size_t(n);
+    size_t numWords = (numRecords + 63) / 64;
+    ok = readVector(pos, end, result.m_years, numRecords)
+      && readVector(pos, end, result.m_months, numRecords)
+      && readVector(pos, end, result.m_days, numRecords)
+      && readVector(pos, end, result.m_hours, numRecords)
+      && readVector(pos, end, result.m_minutes, numRecords);
+    for (unsigned field = EpwDataField::DryBulbTemperature; ok && field < numFields; ++field) {
+      ok = readVector(pos, end, result.m_columns[field], numRecords)
+        && readVector(pos, end, result.m_missing[field], numWords)
+        && readVector(pos, end, result.m_decimals[field], numRecords);
+    }
+    result.m_dataSourceandUncertaintyFlags.reserve(numRecords);
+    for (size_t i = 0; ok && i < numRecords; ++i) {
+      uint32_t length = 0;
+      ok = readValue(pos, end, length) && size_t(end - pos) >= length;
+      if (ok) {
+        result.m_dataSourceandUncertaintyFlags.emplace_back(pos, length);
+        pos += length;
+      }
+    }
+    if (!ok || pos != end) {
+      LOG(Warn, "Ignoring invalid weather data cache file '" << p << "'");
+      return false;
+    }
 
-      // open file
-      std::ifstream ifs(openstudio::toSystemFilename(m_path));
+    columns = std::move(result);
+    return true;
+  }
 
-      if (!parse(ifs, true)){
-        ifs.close();
-        LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
-      } else{
-        ifs.close();
+  void EpwFile::writeDataCache(uintmax_t sourceSize, const EpwDataColumns& columns, bool minutesMatch) const
+  {
+    openstudio::path p = dataCachePath();
+    boost::system::error_code ec;
+    openstudio::filesystem::create_directories(p.parent_path(), ec);
+
+    // Write to a temporary file first so that concurrent readers never see a partial cache file
+    openstudio::path tmp = p.parent_path() / openstudio::filesystem::unique_path(toPath(m_checksum + "-%%%%-%%%%.tmp"), ec);
+    if (ec) {
+      return;
+    }
+    bool ok = false;
+    {
+      openstudio::filesystem::ofstream ofs(tmp, std::ios_base::binary | std::ios_base::trunc);
+      if (ofs) {
+        uint32_t numFields = EpwDataField::LiquidPrecipitationQuantity + 1;
+        uint32_t flag = minutesMatch ? 1 : 0;
+        uint64_t n = columns.numRecords();
+        uint64_t size = sourceSize;
+        int32_t recordsPerHour = m_recordsPerHour;
+        ofs.write(dataCacheMagic, sizeof(dataCacheMagic));
+        ofs.write(reinterpret_cast<const char*>(&dataCacheVersion), sizeof(dataCacheVersion));
+        ofs.write(reinterpret_cast<const char*>(&dataCacheByteOrder), sizeof(dataCacheByteOrder));
+        ofs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        ofs.write(reinterpret_cast<const char*>(&recordsPerHour), sizeof(recordsPerHour));
+        ofs.write(reinterpret_cast<const char*>(&numFields), sizeof(numFields));
+        ofs.write(reinterpret_cast<const char*>(&flag), sizeof(flag));
+        ofs.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        writeVector(ofs, columns.m_years);
+        writeVector(ofs, columns.m_months);
+        writeVector(ofs, columns.m_days);
+        writeVector(ofs, columns.m_hours);
+        writeVector(ofs, columns.m_minutes);
+        for (unsigned field = EpwDataField::DryBulbTemperature; field < numFields; ++field) {
+          writeVector(ofs, columns.m_columns[field]);
+          writeVector(ofs, columns.m_missing[field]);
+          writeVector(ofs, columns.m_decimals[field]);
+        }
+        for (const std::string& flags : columns.m_dataSourceandUncertaintyFlags) {
+          uint32_t length = uint32_t(flags.size());
+          ofs.write(reinterpret_cast<const char*>(&length), sizeof(length));
+          ofs.write(flags.data(), length);
+        }
+        ok = bool(ofs);
       }
     }
-    return m_data;
+    if (ok) {
+      openstudio::filesystem::rename(tmp, p, ec);
+      ok = !ec;
+    }
+    if (!ok) {
+      LOG(Debug, "Could not write weather data cache file '" << p << "'");
+      openstudio::filesystem::remove(tmp, ec);
+    }
   }
 
   std::string EpwDesignCondition::titleOfDesignCondition() const
@@ -4020,39 +4690,19 @@ namespace openstudio{
       // set checksum
       m_checksum = openstudio::checksum(m_path);
 
-      // open file
-      std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-      if (!parse(ifs)){
-        ifs.close();
+      if (!parseFile()){
         LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
       }
-      else{
-        ifs.close();
-      }
     }
     return m_designs;
   }
 
   boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string &name)
   {
-    if(m_data.size()==0) {
-      if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
-        LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-      }
-
-      // set checksum
-      m_checksum = openstudio::checksum(m_path);
-
-      // open file
-      std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-      if (!parse(ifs, true)) {
-        ifs.close();
-        LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
+    if(m_columns.empty()) {
+      if (!loadData()) {
         return boost::none;
       }
-      ifs.close();
     }
     EpwDataField id;
     try {
@@ -4061,24 +4711,27 @@ namespace openstudio{
       LOG(Warn, "Unrecognized EPW data field '" << name << "'");
       return boost::none;
     }
-    if(m_data.size() > 0) {
+    if(!m_columns.empty() && EpwDataColumns::isNumeric(id)) {
       std::string units = EpwDataPoint::getUnits(id);
+      const std::vector<double>& column = m_columns.column(id);
+      const std::vector<uint64_t>& missing = m_columns.missingMask(id);
+      unsigned n = m_columns.numRecords();
       DateTimeVector dates;
+      dates.reserve(n + 1);
       dates.push_back(DateTime()); // Use a placeholder to avoid an insert
       std::vector<double> values;
-      for(unsigned int i=0;i<m_data.size();i++) {
-        DateTime dateTime = m_data[i].dateTime();
-        // Time time=m_data[i].time();
-        boost::optional<double> value = m_data[i].getField(id);
-        if(value) {
-          if (isActual()) {
-            dates.push_back(DateTime(dateTime));
-          } else {
-            // Strip year
-            dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
-          }
-          values.push_back(value.get());
+      values.reserve(n);
+      for(unsigned int i=0;i<n;i++) {
+        if((missing[i / 64] >> (i % 64)) & 1u) {
+          continue;
         }
+        if (isActual()) {
+          dates.push_back(m_columns.dateTime(i));
+        } else {
+          // Strip year
+          dates.push_back(DateTime(Date(MonthOfYear(m_columns.months()[i]), m_columns.days()[i]), m_columns.time(i)));
+        }
+        values.push_back(column[i]);
       }
       if(values.size()) {
         DateTime start = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);
@@ -4091,23 +4744,10 @@ namespace openstudio{
 
   boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string &name)
   {
-    if (m_data.size() == 0) {
-      if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
-        LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-      }
-
-      // set checksum
-      m_checksum = openstudio::checksum(m_path);
-
-      // open file
-      std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-      if (!parse(ifs, true)) {
-        ifs.close();
-        LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
+    if (m_columns.empty()) {
+      if (!loadData()) {
         return boost::none;
       }
-      ifs.close();
     }
     EpwComputedField id;
     try {
@@ -4119,39 +4759,17 @@ namespace openstudio{
     }
 
     std::string units = EpwDataPoint::getUnits(id);
-    boost::optional<double>(EpwDataPoint::*compute)() const;
-    switch (id.value()) {
-      case EpwComputedField::SaturationPressure:
-        compute = &EpwDataPoint::saturationPressure;
-        break;
-      case EpwComputedField::Enthalpy:
-        compute = &EpwDataPoint::enthalpy;
-        break;
-      case EpwComputedField::HumidityRatio:
-        compute = &EpwDataPoint::humidityRatio;
-        break;
-      case EpwComputedField::WetBulbTemperature:
-        compute = &EpwDataPoint::wetbulb;
-        break;
-      case EpwComputedField::Density:
-        compute = &EpwDataPoint::density;
-        break;
-      case EpwComputedField::SpecificVolume:
-        compute = &EpwDataPoint::specificVolume;
-        break;
-      default:
-        return boost::none;
-    }
+    const std::vector<double>& column = computedColumns().column(id);
+    unsigned n = m_columns.numRecords();
     DateTimeVector dates;
+    dates.reserve(n + 1);
     dates.push_back(DateTime()); // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for (unsigned int i = 0; i<m_data.size(); i++) {
-      Date date = m_data[i].date();
-      Time time = m_data[i].time();
-      boost::optional<double> value = (m_data[i].*compute)();
-      if (value) {
-        dates.push_back(DateTime(date, time));
-        values.push_back(value.get());
+    values.reserve(n);
+    for (unsigned int i = 0; i<n; i++) {
+      if (!std::isnan(column[i])) {
+        dates.push_back(m_columns.dateTime(i));
+        values.push_back(column[i]);
       }
     }
     if (values.size()) {
@@ -4164,30 +4782,19 @@ namespace openstudio{
 
   bool EpwFile::translateToWth(openstudio::path path, std::string description)
   {
-    if(m_data.size()==0) {
-      if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)){
-        LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-      }
-
-      // set checksum
-      m_checksum = openstudio::checksum(m_path);
-
-      // open file
-      std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-      if (!parse(ifs, true)) {
-        ifs.close();
-        LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
+    if(m_columns.empty()) {
+      if (!loadData()) {
         return false;
       }
-      ifs.close();
     }
 
     if(description.empty()) {
       description = "Translated from " + openstudio::toString(this->path());
     }
 
-    if(!data().size()) {
+    // The data points are built from the columns on each call to data()
+    std::vector<EpwDataPoint> data = this->data();
+    if(!data.size()) {
       LOG(Error, "EPW file contains no data to translate");
       return false;
     }
@@ -4217,9 +4824,9 @@ namespace openstudio{
     }
 
     // Cheat to get data at the start time - this will need to change
-    openstudio::EpwDataPoint lastPt = data()[data().size()-1];
+    openstudio::EpwDataPoint lastPt = data[data.size()-1];
     std::vector<std::string> epwstrings = lastPt.toEpwStrings();
-    openstudio::DateTime dateTime = data()[0].dateTime();
+    openstudio::DateTime dateTime = data[0].dateTime();
     openstudio::Time dt = timeStep();
     dateTime -= dt;
     epwstrings[0] = std::to_string(dateTime.date().year());
@@ -4241,8 +4848,8 @@ namespace openstudio{
       return false;
     }
     fp << output.get() << '\n';
-    for(unsigned int i=0;i<data().size();i++) {
-      output = data()[i].toWthString();
+    for(unsigned int i=0;i<data.size();i++) {
+      output = data[i].toWthString();
       if(!output) {
         LOG(Error, "Translation to WTH has failed on data point " << i);
         fp.close();
@@ -4254,20 +4861,32 @@ namespace openstudio{
     return true;
   }
 
-  bool EpwFile::parse(std::istream& ifs, bool storeData)
+  bool EpwFile::parse(const char* begin, const char* end, bool storeData)
   {
-    // read line by line
-    std::string line;
+    // read line by line, a trailing carriage return is dropped as a text mode stream would on Windows
+    const char* pos = begin;
+    const char* lineBegin = nullptr;
+    const char* lineEnd = nullptr;
+    auto getLine = [&]() {
+      if (!nextLine(pos, end, lineBegin, lineEnd)) {
+        return false;
+      }
+      if (lineEnd != lineBegin && *(lineEnd - 1) == '\r') {
+        --lineEnd;
+      }
+      return true;
+    };
 
     bool result = true;
 
     // read first 8 lines
     for(unsigned i = 0; i < 8; ++i) {
 
-      if(!std::getline(ifs, line)) {
+      if(!getLine()) {
         LOG(Error, "Could not read line " << i+1 << " of EPW file '" << m_path << "'");
         return false;
       }
+      std::string line(lineBegin, lineEnd);
 
       switch(i) {
         case 0:  // LOCATION,
@@ -4300,86 +4919,119 @@ namespace openstudio{
       return false;
     }
 
-    // read rest of file
-    int lineNumber = 8;
-    boost::optional<Date> startDate;
-    boost::optional<Date> lastDate;
-    boost::optional<Date> endDate;
-    bool realYear = true;
-    bool wrapAround = false;
-    OS_ASSERT((60 % m_recordsPerHour) == 0);
-    int minutesPerRecord = 60/m_recordsPerHour;
-    int currentMinute = 0;
-    while(std::getline(ifs, line)) {
-      lineNumber++;
-      std::vector<std::string> strings = splitString(line, ',');
-      if (strings.size() >= 5) {
-        try {
-          int year = std::stoi(strings[0]);
-          int month = std::stoi(strings[1]);
-          int day = std::stoi(strings[2]);
+    bool useCache = !m_path.empty() && !m_checksum.empty() && !dataCacheDirectory().empty();
+    bool fillColumns = storeData || useCache;
+    uintmax_t sourceSize = end - begin;
 
-          Date date(month, day, year);
-          if (!startDate) {
-            startDate = date;
-          }
-          endDate = date;
-
-          if (endDate && lastDate) {
-            Time delta = endDate.get() - lastDate.get();
-            if (std::abs(delta.totalDays()) > 1) {
-              if (realYear) { // Warn once
-                LOG(Warn, "Successive data points (" << lastDate.get() << " to " << endDate.get()
-                    << ", ending on line " << lineNumber << ") are greater than 1 day apart in EPW file '"
-                    << m_path << "'. Data will be treated as typical (TMY)");
-              }
-              realYear = false;
+    EpwDataColumns columns;
+    DataPeriodTracker tracker;
+    bool minutesMatch = true;
+    bool cached = useCache && readDataCache(sourceSize, columns, minutesMatch);
+    if (cached) {
+      for (unsigned i = 0; i < columns.numRecords(); ++i) {
+        try {
+          tracker.add(Date(columns.months()[i], columns.days()[i], columns.years()[i]), 9 + i, m_path);
+        } catch(...) {
+          LOG(Error, "Could not read line " << 9 + i << " of EPW file '" << m_path << "'");
+          return false;
+        }
+      }
+      if (storeData && !minutesMatch) {
+        m_minutesMatch = false;
+      }
+    } else {
+      // read rest of file
+      int lineNumber = 8;
+      OS_ASSERT((60 % m_recordsPerHour) == 0);
+      int minutesPerRecord = 60/m_recordsPerHour;
+      int currentMinute = 0;
+      if (fillColumns) {
+        // Size the columns from the data period in the header, this is only a hint
+        int numDays = (int)(m_endDate - m_startDate).totalDays() + 1;
+        if (numDays <= 0) {
+          numDays += 365;
+        }
+        columns.reserve(std::min(numDays, 366) * 24 * m_recordsPerHour);
+      }
+      std::vector<FieldRange> fields;
+      double values[EpwDataField::LiquidPrecipitationQuantity + 1];
+      bool missing[EpwDataField::LiquidPrecipitationQuantity + 1];
+      uint8_t decimals[EpwDataField::LiquidPrecipitationQuantity + 1];
+      EpwDataPoint checkPoint;
+      while(getLine()) {
+        lineNumber++;
+        splitFields(lineBegin, lineEnd, fields);
+        if (fields.size() >= 5) {
+          try {
+            int year = 0;
+            int month = 0;
+            int day = 0;
+            if (!fieldToInteger(fields[0], year) || !fieldToInteger(fields[1], month) || !fieldToInteger(fields[2], day)) {
+              throw std::invalid_argument("date");
             }
 
-            if (endDate->monthOfYear().value() < lastDate->monthOfYear().value()) {
-              wrapAround = true;
-            }
-          }
-          lastDate = date;
-
-          // Store the data if requested
-          if (storeData) {
-            int hour = std::stoi(strings[3]);
-            int minutesInFile = std::stoi(strings[4]);
-            // Due to issues with some EPW files, we need to check stuff here
-            if (m_recordsPerHour != 1) {
-              currentMinute += minutesPerRecord;
-              if (currentMinute >= 60) { // This could really be ==, but >= is used for safety
-                currentMinute = 0;
+            tracker.add(Date(month, day, year), lineNumber, m_path);
+
+            // Store the data if requested
+            if (fillColumns) {
+              int hour = 0;
+              int minutesInFile = 0;
+              if (!fieldToInteger(fields[3], hour) || !fieldToInteger(fields[4], minutesInFile)) {
+                throw std::invalid_argument("time");
               }
-            }
-            // Check for agreement between the file value and the computed value
-            if (currentMinute != minutesInFile) {
-              if (m_minutesMatch) { // Warn only once
-                LOG(Error, "Minutes field (" << minutesInFile << ") on line " << lineNumber << " of EPW file '"
-                    << m_path << "' does not agree with computed value (" << currentMinute << "). Using computed value");
-                m_minutesMatch = false;
+              // Due to issues with some EPW files, we need to check stuff here
+              if (m_recordsPerHour != 1) {
+                currentMinute += minutesPerRecord;
+                if (currentMinute >= 60) { // This could really be ==, but >= is used for safety
+                  currentMinute = 0;
+                }
               }
+              // Check for agreement between the file value and the computed value
+              if (currentMinute != minutesInFile) {
+                if (storeData && m_minutesMatch) { // Warn only once
+                  LOG(Error, "Minutes field (" << minutesInFile << ") on line " << lineNumber << " of EPW file '"
+                      << m_path << "' does not agree with computed value (" << currentMinute << "). Using computed value");
+                  m_minutesMatch = false;
+                }
+                minutesMatch = false;
+              }
+              // Same checks as EpwDataPoint::fromEpwStrings, without building the strings of a data point
+              bool ok = true;
+              if (fields.size() < 35) {
+                LOG(Error, "Expected 35 fields in EPW data instead of the " << fields.size() << " received");
+                ok = false;
+              } else if (fields.size() > 35) {
+                LOG(Warn, "Expected 35 fields in EPW data instead of the " << fields.size() << " received. The additional data will be ignored");
+              }
+              ok = ok && checkPoint.setMonth(month) && checkPoint.setDay(day) && checkPoint.setHour(hour) && checkPoint.setMinute(currentMinute);
+              if (!ok) {
+                LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
+                return false;
+              }
+              for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+                decodeField(field, fields[field], values[field], missing[field], decimals[field]);
+              }
+              const FieldRange& flags = fields[EpwDataField::DataSourceandUncertaintyFlags];
+              columns.appendRecord(year, month, day, hour, currentMinute, std::string(flags.first, flags.second), values, missing,
+                decimals);
             }
-            boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
-            if (pt) {
-              m_data.push_back(pt.get());
-            } else {
-              LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
-              return false;
-            }
-          }
 
-        } catch(...) {
-          LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
+          } catch(...) {
+            LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
+            return false;
+          }
+        } else {
+          LOG(Error, "Insufficient weather data on line " << lineNumber << " of EPW file '" << m_path << "'");
           return false;
         }
-      } else {
-        LOG(Error, "Insufficient weather data on line " << lineNumber << " of EPW file '" << m_path << "'");
-        return false;
       }
     }
 
+    boost::optional<Date> startDate = tracker.startDate;
+    boost::optional<Date> endDate = tracker.endDate;
+    bool realYear = tracker.realYear;
+    bool wrapAround = tracker.wrapAround;
+
     if (!startDate) {
       LOG(Error, "Could not find start date in data section of EPW file '" << m_path << "'");
       return false;
@@ -4425,6 +5077,13 @@ namespace openstudio{
       m_isActual = true;
     }
 
+    if (useCache && !cached) {
+      writeDataCache(sourceSize, columns, minutesMatch);
+    }
+    if (storeData) {
+      m_columns = std::move(columns);
+    }
+
     return result;
   }
 
@@ -4545,6 +5204,9 @@ namespace openstudio{
       return false;
     }
 
+    // The header is parsed again whenever the data is re-read
+    m_holidays.clear();
+
     std::string leapYearObserved =  split[1]; boost::trim(leapYearObserved);
     if (istringEqual("Yes", leapYearObserved)) {
       m_leapYearObserved = true;
@@ -39,6 +39,8 @@
 #include "../time/DateTime.hpp"
 #include "../data/TimeSeries.hpp"
 
+#include <cstdint>
+
 namespace openstudio{
 
 // forward declaration
@@ -364,6 +366,8 @@ public:
   boost::optional<double> wetbulb() const;
 
 private:
+  friend class EpwFile;
+
   // One billion setters
   void setDate(Date date);
   void setTime(Time time);
@@ -858,6 +862,111 @@ private:
   double m_extremeN50YearsMaxDryBulb;
 };
 
+/** EpwDataColumns holds the data section of an EPW file as a structure of arrays. Each numeric field is stored in
+ *  a contiguous column of doubles with a bitmask marking the missing values (which are stored as NaN), and the date
+ *  and time of each record are stored in integer columns. The column accessors return references to the underlying
+ *  storage, so reading a whole field does not copy or convert anything.
+ */
+class UTILITIES_API EpwDataColumns
+{
+public:
+  /** Create an empty EpwDataColumns object */
+  EpwDataColumns();
+
+  /** Returns the number of records */
+  unsigned numRecords() const;
+  /** Returns true if there are no records */
+  bool empty() const;
+
+  /** Returns the year column */
+  const std::vector<int>& years() const;
+  /** Returns the month column */
+  const std::vector<int>& months() const;
+  /** Returns the day column */
+  const std::vector<int>& days() const;
+  /** Returns the hour column */
+  const std::vector<int>& hours() const;
+  /** Returns the minute column */
+  const std::vector<int>& minutes() const;
+  /** Returns the data source and uncertainty flags column */
+  const std::vector<std::string>& dataSourceandUncertaintyFlags() const;
+
+  /** Returns the date of a record */
+  Date date(unsigned record) const;
+  /** Returns the time of a record */
+  Time time(unsigned record) const;
+  /** Returns the date and time of a record */
+  DateTime dateTime(unsigned record) const;
+
+  /** Returns true if the field is stored as a numeric column, i.e. it is not one of the date, time or flag fields */
+  static bool isNumeric(EpwDataField field);
+  /** Returns the column of a numeric field, missing values are NaN. Throws if the field is not numeric. */
+  const std::vector<double>& column(EpwDataField field) const;
+  /** Returns the missing value bitmask of a numeric field, bit (record % 64) of word (record / 64) is set if the
+      value of the record is missing. Throws if the field is not numeric. */
+  const std::vector<uint64_t>& missingMask(EpwDataField field) const;
+  /** Returns true if the value of a numeric field is missing for a record */
+  bool isMissing(EpwDataField field, unsigned record) const;
+  /** Returns the value of a numeric field for a record if it is not missing */
+  boost::optional<double> value(EpwDataField field, unsigned record) const;
+  /** Returns the air state of a record, computed in the same way as EpwDataPoint::airState */
+  boost::optional<AirState> airState(unsigned record) const;
+
+  /** Returns an EpwDataPoint for a record. Numeric values are written back out with the number of decimals they had in
+      the source file, numbers written in exponent notation are written back out in a generic format. */
+  EpwDataPoint dataPoint(unsigned record) const;
+
+private:
+  friend class EpwFile;
+
+  void clear();
+  void reserve(unsigned numRecords);
+  void appendRecord(int year, int month, int day, int hour, int minute, const std::string& dataSourceandUncertaintyFlags,
+    const double* values, const bool* missing, const uint8_t* decimals);
+
+  std::vector<int> m_years;
+  std::vector<int> m_months;
+  std::vector<int> m_days;
+  std::vector<int> m_hours;
+  std::vector<int> m_minutes;
+  std::vector<std::string> m_dataSourceandUncertaintyFlags;
+  // Indexed by EpwDataField, the non-numeric fields are left empty
+  std::vector<std::vector<double> > m_columns;
+  std::vector<std::vector<uint64_t> > m_missing;
+  // Number of decimals of each value in the source file, used to write the values back out in dataPoint
+  std::vector<std::vector<uint8_t> > m_decimals;
+};
+
+/** EpwComputedColumns holds the psychrometric quantities of every record of an EpwDataColumns object, computed in
+ *  batch. Each EpwComputedField is stored in a contiguous column of doubles, with NaN where the value cannot be
+ *  computed. The values are the same as those of the AirState of each record (and of EpwDataPoint::saturationPressure
+ *  for the saturation pressure), but the whole year is computed with plain loops over the columns, and the wet bulb
+ *  and dew point temperatures are solved for all records together.
+ */
+class UTILITIES_API EpwComputedColumns
+{
+public:
+  /** Create an empty EpwComputedColumns object */
+  EpwComputedColumns();
+  /** Compute the psychrometric quantities of every record from the dry bulb, relative humidity, pressure and
+      dew point columns */
+  explicit EpwComputedColumns(const EpwDataColumns& columns);
+
+  /** Returns the number of records */
+  unsigned numRecords() const;
+  /** Returns true if there are no records */
+  bool empty() const;
+
+  /** Returns the column of a computed field, values that cannot be computed are NaN */
+  const std::vector<double>& column(EpwComputedField field) const;
+  /** Returns the value of a computed field for a record if it can be computed */
+  boost::optional<double> value(EpwComputedField field, unsigned record) const;
+
+private:
+  // Indexed by EpwComputedField
+  std::vector<std::vector<double> > m_columns;
+};
+
 /** EpwFile parses a weather file in EPW format.  Later it may provide
  *   methods for writing and converting other weather files to EPW format.
  */
@@ -874,6 +983,14 @@ public:
   /// static load method
   static boost::optional<EpwFile> loadFromString(const std::string& str, bool storeData=false);
 
+  /// set a directory in which a binary copy of the weather data of each loaded file is kept, keyed by the file's
+  /// checksum, so that files that were loaded before are read back in one go instead of being parsed again.
+  /// An empty path, which is the default, disables the cache.
+  static void setDataCacheDirectory(const openstudio::path& directory);
+
+  /// get the directory of the binary weather data cache, empty if the cache is disabled
+  static openstudio::path dataCacheDirectory();
+
   /// get the path
   openstudio::path path() const;
 
@@ -928,9 +1045,17 @@ public:
   /// get the actual year of the end date if there is one
   boost::optional<int> endDateActualYear() const;
 
-  /// get the weather data
+  /// get the weather data, the data points are built from the data columns on each call and are not kept, this fails
+  /// with an error if the data was not stored on load and the file has changed since it was loaded. Use dataColumns()
+  /// to read whole fields without building the data points.
   std::vector<EpwDataPoint> data();
 
+  /// get the weather data as columns, the data is parsed the first time this is called if it was not stored on load
+  const EpwDataColumns& dataColumns();
+
+  /// get the computed psychrometric quantities as columns, these are computed the first time this is called
+  const EpwComputedColumns& computedColumns();
+
   /// get the design conditions
   std::vector<EpwDesignCondition> designConditions();
 
@@ -956,7 +1081,12 @@ public:
 private:
 
   EpwFile();
-  bool parse(std::istream& is, bool storeData=false);
+  bool parse(const char* begin, const char* end, bool storeData=false);
+  bool parseFile(bool storeData=false);
+  bool loadData();
+  openstudio::path dataCachePath() const;
+  bool readDataCache(uintmax_t sourceSize, EpwDataColumns& columns, bool& minutesMatch) const;
+  void writeDataCache(uintmax_t sourceSize, const EpwDataColumns& columns, bool minutesMatch) const;
   bool parseLocation(const std::string& line);
   bool parseDesignConditions(const std::string& line);
   bool parseDataPeriod(const std::string& line);
@@ -982,7 +1112,8 @@ private:
   Date m_endDate;
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
-  std::vector<EpwDataPoint> m_data;
+  EpwDataColumns m_columns;
+  EpwComputedColumns m_computedColumns;
   std::vector<EpwDesignCondition> m_designs;
 
   bool m_leapYearObserved;
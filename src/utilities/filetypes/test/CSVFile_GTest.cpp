@@ -299,4 +299,72 @@ TEST(Filetypes, CSVFile_AddAndGetColumn)
   EXPECT_EQ("1", getCol4[0]);
   EXPECT_EQ("2.2", getCol4[1]);
   EXPECT_EQ("0.33", getCol4[2]);
-}
\ No newline at end of file
+}
+
+TEST(Filetypes, CSVFile_Quoting)
+{
+  CSVFile csvFile(std::string("a,\"b\"\"c\",1.5\r\n-3,+2,\"x,\ny\"\n\n"));
+  ASSERT_EQ(3u, csvFile.numRows());
+  ASSERT_EQ(3u, csvFile.numColumns());
+  auto rows = csvFile.rows();
+
+  ASSERT_EQ(VariantType::String, rows[0][1].variantType().value());
+  EXPECT_EQ("b\"c", rows[0][1].valueAsString());
+  ASSERT_EQ(VariantType::Double, rows[0][2].variantType().value());
+  EXPECT_EQ(1.5, rows[0][2].valueAsDouble());
+
+  ASSERT_EQ(VariantType::Integer, rows[1][0].variantType().value());
+  EXPECT_EQ(-3, rows[1][0].valueAsInteger());
+  ASSERT_EQ(VariantType::Double, rows[1][1].variantType().value());
+  EXPECT_EQ(2.0, rows[1][1].valueAsDouble());
+  ASSERT_EQ(VariantType::String, rows[1][2].variantType().value());
+  EXPECT_EQ("x,\ny", rows[1][2].valueAsString());
+
+  ASSERT_EQ(VariantType::String, rows[2][0].variantType().value());
+  EXPECT_EQ("", rows[2][0].valueAsString());
+
+  // quoted cells survive a round trip
+  CSVFile csvFile2(csvFile.string());
+  EXPECT_EQ(csvFile.string(), csvFile2.string());
+}
+
+TEST(Filetypes, CSVFile_ReadColumn)
+{
+  path p = resourcesPath() / toPath("model/schedulefile.csv");
+
+  std::vector<double> values = CSVFile::readColumnAsDoubleVector(p, 1, 1);
+  ASSERT_EQ(8760u, values.size());
+  EXPECT_EQ(8759.0, values[0]);
+  EXPECT_EQ(0.0, values[8759]);
+
+  // header row is not numeric
+  EXPECT_TRUE(CSVFile::readColumnAsDoubleVector(p, 1, 0).empty());
+
+  // column past the end of the rows
+  EXPECT_TRUE(CSVFile::readColumnAsDoubleVector(p, 3, 1).empty());
+
+  boost::optional<CSVFile> csvFile = CSVFile::load(p);
+  ASSERT_TRUE(csvFile);
+  EXPECT_EQ(8761u, csvFile->numRows());
+  std::vector<double> column = csvFile->getColumnAsDoubleVector(1);
+  EXPECT_TRUE(column.empty());
+
+  // a file rewritten with the same size within the same second is read again
+  path p2 = toPath("./CSVFile_ReadColumn.csv");
+  {
+    CSVFile small;
+    small.addColumn(std::vector<double>(2u, 1.0));
+    EXPECT_TRUE(small.saveAs(p2));
+  }
+  EXPECT_EQ(std::vector<double>(2u, 1.0), CSVFile::readColumnAsDoubleVector(p2, 0));
+  ASSERT_TRUE(CSVFile::load(p2));
+  EXPECT_EQ(std::vector<double>(2u, 1.0), CSVFile::load(p2)->getColumnAsDoubleVector(0));
+  {
+    CSVFile small;
+    small.addColumn(std::vector<double>(2u, 2.0));
+    EXPECT_TRUE(small.saveAs(p2));
+  }
+  EXPECT_EQ(std::vector<double>(2u, 2.0), CSVFile::readColumnAsDoubleVector(p2, 0));
+  ASSERT_TRUE(CSVFile::load(p2));
+  EXPECT_EQ(std::vector<double>(2u, 2.0), CSVFile::load(p2)->getColumnAsDoubleVector(0));
+}
@@ -32,9 +32,15 @@
 #include "../../time/Time.hpp"
 #include "../../time/Date.hpp"
 #include "../../core/Checksum.hpp"
+#include "../../core/Filesystem.hpp"
 
 #include <resources.hxx>
 
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
 using namespace openstudio;
 
 TEST(Filetypes, EpwFile)
@@ -821,6 +827,243 @@ TEST(Filetypes, EpwFile_DataPoint)
   }
 }
 
+TEST(Filetypes, EpwFile_DataColumns)
+{
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p, true);
+  const EpwDataColumns& columns = epwFile.dataColumns();
+  ASSERT_EQ(8760u, columns.numRecords());
+
+  // The last record is for the last hour of 12/31/1996
+  EXPECT_EQ(1996, columns.years()[8759]);
+  EXPECT_EQ(12, columns.months()[8759]);
+  EXPECT_EQ(31, columns.days()[8759]);
+  EXPECT_EQ(24, columns.hours()[8759]);
+  EXPECT_EQ(0, columns.minutes()[8759]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 1997), Time(0)), columns.dateTime(8759));
+
+  const std::vector<double>& dryBulb = columns.column(EpwDataField::DryBulbTemperature);
+  ASSERT_EQ(8760u, dryBulb.size());
+  EXPECT_EQ(4.0, dryBulb[8759]);
+  EXPECT_EQ(81100, columns.column(EpwDataField::AtmosphericStationPressure)[8759]);
+
+  // Missing values are flagged in the mask and stored as NaN
+  EXPECT_EQ(137u, columns.missingMask(EpwDataField::LiquidPrecipitationDepth).size());
+  EXPECT_TRUE(columns.isMissing(EpwDataField::LiquidPrecipitationDepth, 8759));
+  EXPECT_TRUE(std::isnan(columns.column(EpwDataField::LiquidPrecipitationDepth)[8759]));
+  EXPECT_FALSE(columns.value(EpwDataField::LiquidPrecipitationDepth, 8759));
+  EXPECT_FALSE(columns.isMissing(EpwDataField::DewPointTemperature, 8759));
+  ASSERT_TRUE(columns.value(EpwDataField::DewPointTemperature, 8759));
+  EXPECT_EQ(-1.0, columns.value(EpwDataField::DewPointTemperature, 8759).get());
+
+  // The date, time and flag fields are not numeric columns
+  EXPECT_FALSE(EpwDataColumns::isNumeric(EpwDataField::Year));
+  EXPECT_FALSE(EpwDataColumns::isNumeric(EpwDataField::DataSourceandUncertaintyFlags));
+  EXPECT_THROW(columns.column(EpwDataField::Hour), openstudio::Exception);
+
+  // The columns agree with the full data points
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760u, data.size());
+  for (unsigned i = 0; i < 8760; i += 97) {
+    EXPECT_EQ(data[i].dateTime(), columns.dateTime(i));
+    EXPECT_EQ(data[i].dataSourceandUncertaintyFlags(), columns.dataSourceandUncertaintyFlags()[i]);
+    for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+      boost::optional<double> expected = data[i].getField(EpwDataField(field));
+      boost::optional<double> value = columns.value(EpwDataField(field), i);
+      ASSERT_EQ(bool(expected), bool(value));
+      if (expected) {
+        EXPECT_EQ(expected.get(), value.get());
+      }
+    }
+    // A data point built from the columns has the same values
+    EpwDataPoint point = columns.dataPoint(i);
+    EXPECT_EQ(data[i].dateTime(), point.dateTime());
+    EXPECT_TRUE(data[i].dryBulbTemperature() == point.dryBulbTemperature());
+    EXPECT_TRUE(data[i].relativeHumidity() == point.relativeHumidity());
+    EXPECT_TRUE(data[i].liquidPrecipitationDepth() == point.liquidPrecipitationDepth());
+    EXPECT_EQ(data[i].presentWeatherCodes(), point.presentWeatherCodes());
+    boost::optional<AirState> state = columns.airState(i);
+    ASSERT_TRUE(state);
+    EXPECT_EQ(data[i].enthalpy().get(), state->enthalpy());
+  }
+
+  // Columns are read on demand when the data was not stored on load
+  EpwFile lazyFile(p);
+  EXPECT_EQ(8760u, lazyFile.dataColumns().numRecords());
+  EXPECT_EQ(dryBulb, lazyFile.dataColumns().column(EpwDataField::DryBulbTemperature));
+}
+
+TEST(Filetypes, EpwFile_StoreData)
+{
+  path source = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  path p = openstudio::filesystem::temp_directory_path() / openstudio::filesystem::unique_path("EpwFile_StoreData-%%%%-%%%%.epw");
+  openstudio::filesystem::copy_file(source, p);
+
+  EpwFile storedFile(p, true);
+  EpwFile lazyFile(p);
+
+  // Change the file after it was loaded
+  std::string text;
+  {
+    openstudio::filesystem::ifstream ifs(p, std::ios_base::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    text = ss.str();
+  }
+  text.back() = ' ';
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::binary | std::ios_base::trunc);
+    ofs << text;
+  }
+
+  // The data points are built from the columns stored on load, they are not read from the changed file
+  std::vector<EpwDataPoint> data = storedFile.data();
+  ASSERT_EQ(8760u, data.size());
+  EXPECT_EQ(4.0, data[8759].dryBulbTemperature().get());
+  EXPECT_EQ("4.0", data[8759].toEpwStrings()[EpwDataField::DryBulbTemperature]);
+
+  // The data that was not stored on load is not read from the changed file
+  EXPECT_TRUE(lazyFile.data().empty());
+  EXPECT_EQ(0u, lazyFile.dataColumns().numRecords());
+
+  openstudio::filesystem::remove(p);
+}
+
+TEST(Filetypes, EpwFile_ComputedColumns)
+{
+  for (const std::string& name : {"USA_CO_Golden-NREL.724666_TMY3.epw", "CHN_Guangdong.Shaoguan.590820_CSWD.epw", "TUN_Tunis.607150_IWEC.epw"}) {
+    path p = resourcesPath() / toPath("utilities/Filetypes/" + name);
+    EpwFile epwFile(p, true);
+    const EpwDataColumns& columns = epwFile.dataColumns();
+    const EpwComputedColumns& computed = epwFile.computedColumns();
+    ASSERT_EQ(columns.numRecords(), computed.numRecords());
+
+    // The batch values agree with the air state of each record
+    for (unsigned i = 0; i < columns.numRecords(); ++i) {
+      boost::optional<AirState> state = columns.airState(i);
+      ASSERT_EQ(bool(state), bool(computed.value(EpwComputedField::Enthalpy, i)));
+      if (state) {
+        EXPECT_NEAR(state->enthalpy(), computed.value(EpwComputedField::Enthalpy, i).get(), 1.0e-9);
+        EXPECT_NEAR(state->humidityRatio(), computed.value(EpwComputedField::HumidityRatio, i).get(), 1.0e-12);
+        EXPECT_NEAR(state->wetbulb(), computed.value(EpwComputedField::WetBulbTemperature, i).get(), 1.0e-9);
+        EXPECT_NEAR(state->density(), computed.value(EpwComputedField::Density, i).get(), 1.0e-12);
+        EXPECT_NEAR(state->specificVolume(), computed.value(EpwComputedField::SpecificVolume, i).get(), 1.0e-12);
+        EXPECT_NEAR(state->saturationPressure(), computed.value(EpwComputedField::SaturationPressure, i).get(), 1.0e-6);
+      }
+    }
+  }
+
+  // Records that are missing the humidity have a saturation pressure but no state
+  std::string epwString = "LOCATION,Denver Centennial  Golden   Nr,CO,USA,TMY3,724666,39.74,-105.18,-7.0,1829.0\n"
+                          "DESIGN CONDITIONS,0\n"
+                          "TYPICAL/EXTREME PERIODS,0\n"
+                          "GROUND TEMPERATURES,0\n"
+                          "HOLIDAYS/DAYLIGHT SAVINGS,No,0,0,0\n"
+                          "COMMENTS 1,\n"
+                          "COMMENTS 2,\n"
+                          "DATA PERIODS,1,1,Data,Sunday, 1/ 1,1/ 1\n"
+                          "1999,1,1,1,0,?9?9?9?9E0?9?9?9?9?9?9?9?9?9?9?9?9?9?9?9*9*9?9?9?9,-7.0,99.9,999,81300,0,0,216,0,0,0,0,0,0,0,50,1.5,3,3,16.0,77777,9,999999999,0,0.0310,0,88,0.000,0.0,0.0\n";
+  for (int hour = 2; hour <= 24; ++hour) {
+    epwString += "1999,1,1," + std::to_string(hour) + ",0,?9?9?9?9E0?9?9?9?9?9?9?9?9?9?9?9?9?9?9?9*9*9?9?9?9,-7.0,-12.0,67,81300,0,0,216,0,0,0,0,0,0,0,50,1.5,3,3,16.0,77777,9,999999999,0,0.0310,0,88,0.000,0.0,0.0\n";
+  }
+  boost::optional<EpwFile> stringFile = EpwFile::loadFromString(epwString, true);
+  ASSERT_TRUE(stringFile);
+  const EpwComputedColumns& computed = stringFile->computedColumns();
+  ASSERT_EQ(24u, computed.numRecords());
+  EXPECT_TRUE(computed.value(EpwComputedField::SaturationPressure, 0));
+  EXPECT_FALSE(computed.value(EpwComputedField::WetBulbTemperature, 0));
+  EXPECT_TRUE(std::isnan(computed.column(EpwComputedField::Enthalpy)[0]));
+  ASSERT_TRUE(computed.value(EpwComputedField::WetBulbTemperature, 1));
+  boost::optional<AirState> state = stringFile->dataColumns().airState(1);
+  ASSERT_TRUE(state);
+  EXPECT_NEAR(state->wetbulb(), computed.value(EpwComputedField::WetBulbTemperature, 1).get(), 1.0e-9);
+}
+
+TEST(Filetypes, EpwFile_DataCache)
+{
+  path cacheDir = openstudio::filesystem::temp_directory_path() / openstudio::filesystem::unique_path("EpwFile_DataCache-%%%%-%%%%");
+  EpwFile::setDataCacheDirectory(cacheDir);
+  EXPECT_EQ(cacheDir, EpwFile::dataCacheDirectory());
+
+  for (const std::string& name : {"USA_CO_Golden-NREL.724666_TMY3.epw", "CHN_Guangdong.Shaoguan.590820_CSWD.epw", "leapday-test.epw"}) {
+    path p = resourcesPath() / toPath("utilities/Filetypes/" + name);
+
+    // The first load parses the text and writes the cache, the second one reads the cache back
+    EpwFile parsed(p, true);
+    path cacheFile = cacheDir / toPath(parsed.checksum() + ".epwdata");
+    EXPECT_TRUE(openstudio::filesystem::exists(cacheFile));
+    EpwFile cached(p, true);
+
+    EXPECT_EQ(parsed.startDate(), cached.startDate());
+    EXPECT_EQ(parsed.endDate(), cached.endDate());
+    EXPECT_TRUE(parsed.startDateActualYear() == cached.startDateActualYear());
+    EXPECT_EQ(parsed.isActual(), cached.isActual());
+
+    const EpwDataColumns& expected = parsed.dataColumns();
+    const EpwDataColumns& columns = cached.dataColumns();
+    ASSERT_EQ(expected.numRecords(), columns.numRecords());
+    EXPECT_EQ(expected.years(), columns.years());
+    EXPECT_EQ(expected.minutes(), columns.minutes());
+    EXPECT_EQ(expected.dataSourceandUncertaintyFlags(), columns.dataSourceandUncertaintyFlags());
+    for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+      EXPECT_EQ(expected.missingMask(EpwDataField(field)), columns.missingMask(EpwDataField(field)));
+      for (unsigned i = 0; i < expected.numRecords(); ++i) {
+        EXPECT_TRUE(expected.value(EpwDataField(field), i) == columns.value(EpwDataField(field), i));
+      }
+    }
+
+    // The data points built from the cache are written out as in the text
+    std::vector<EpwDataPoint> parsedData = parsed.data();
+    std::vector<EpwDataPoint> cachedData = cached.data();
+    ASSERT_EQ(parsedData.size(), cachedData.size());
+    for (unsigned i = 0; i < parsedData.size(); i += 97) {
+      EXPECT_EQ(parsedData[i].toEpwStrings(), cachedData[i].toEpwStrings());
+    }
+  }
+
+  // A cache file that does not match is ignored
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  path cacheFile = cacheDir / toPath(openstudio::checksum(p) + ".epwdata");
+  {
+    openstudio::filesystem::ofstream ofs(cacheFile, std::ios_base::binary | std::ios_base::trunc);
+    ofs << "OSEPWDAT";
+  }
+  EpwFile reparsed(p, true);
+  EXPECT_EQ(8760u, reparsed.dataColumns().numRecords());
+
+  EpwFile::setDataCacheDirectory(path());
+  EXPECT_TRUE(EpwFile::dataCacheDirectory().empty());
+  openstudio::filesystem::remove_all(cacheDir);
+}
+
+TEST(Filetypes, DISABLED_EpwFile_LoadBenchmark)
+{
+  std::vector<path> paths;
+  for (const std::string& name : {"USA_CO_Golden-NREL.724666_TMY3.epw", "CHN_Guangdong.Shaoguan.590820_CSWD.epw",
+                                  "TUN_Tunis.607150_IWEC.epw", "USA_CT_New.Haven-Tweed.AP.725045_TMY3.epw", "leapday-test.epw"}) {
+    paths.push_back(resourcesPath() / toPath("utilities/Filetypes/" + name));
+  }
+
+  auto loadAll = [&paths]() {
+    auto start = std::chrono::steady_clock::now();
+    unsigned numRecords = 0;
+    for (unsigned i = 0; i < 1000; ++i) {
+      EpwFile epwFile(paths[i % paths.size()], true);
+      numRecords += epwFile.dataColumns().numRecords();
+    }
+    EXPECT_GT(numRecords, 0u);
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  std::cout << "Loaded 1000 EPW files in " << loadAll() << " s" << std::endl;
+
+  path cacheDir = openstudio::filesystem::temp_directory_path() / openstudio::filesystem::unique_path("EpwFile_LoadBenchmark-%%%%-%%%%");
+  EpwFile::setDataCacheDirectory(cacheDir);
+  std::cout << "Loaded 1000 EPW files with the data cache in " << loadAll() << " s" << std::endl;
+  EpwFile::setDataCacheDirectory(path());
+  openstudio::filesystem::remove_all(cacheDir);
+}
+
 TEST(Filetypes, EpwFile_parseDataPeriods)
 {
 
@@ -0,0 +1,601 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ColumnarResults.hpp"
+#include "SqlFileTimeSeriesBatch.hpp"
+
+#include "../data/Vector.hpp"
+#include "../core/Assert.hpp"
+#include "../core/Compare.hpp"
+#include "../core/Exception.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+namespace openstudio {
+
+namespace {
+
+  // file layout: a fixed header, 8 byte aligned blocks of column data, then the directory describing them.
+  // Numbers are written in the byte order of the machine writing the file, readers check it against theirs
+  const char fileMagic[8] = {'O', 'S', 'R', 'E', 'S', 'C', 'O', 'L'};
+  const std::uint32_t byteOrderMark = 0x01020304;
+  const std::uint32_t formatVersion = 1;
+  // magic, byte order mark, version, directory offset and size
+  const std::size_t headerSize = 32;
+
+  const std::uint32_t rawEncoding = 0;
+  const std::uint32_t zlibEncoding = 1;
+
+  void append(std::string& buffer, const void* data, std::size_t size) {
+    buffer.append(static_cast<const char*>(data), size);
+  }
+
+  void appendU32(std::string& buffer, std::uint32_t value) {
+    append(buffer, &value, sizeof(value));
+  }
+
+  void appendU64(std::string& buffer, std::uint64_t value) {
+    append(buffer, &value, sizeof(value));
+  }
+
+  void appendString(std::string& buffer, const std::string& value) {
+    appendU32(buffer, value.size());
+    buffer.append(value);
+  }
+
+  // sequential reads from the directory, throwing if they run past its end
+  class DirectoryReader {
+   public:
+    DirectoryReader(const char* data, std::size_t size) : m_data(data), m_size(size), m_pos(0) {}
+
+    void read(void* value, std::size_t size) {
+      if (size > m_size - m_pos) {
+        throw openstudio::Exception("Columnar results directory is truncated");
+      }
+      std::memcpy(value, m_data + m_pos, size);
+      m_pos += size;
+    }
+
+    std::uint32_t readU32() {
+      std::uint32_t value;
+      read(&value, sizeof(value));
+      return value;
+    }
+
+    std::uint64_t readU64() {
+      std::uint64_t value;
+      read(&value, sizeof(value));
+      return value;
+    }
+
+    std::string readString() {
+      std::uint32_t size = readU32();
+      if (size > m_size - m_pos) {
+        throw openstudio::Exception("Columnar results directory is truncated");
+      }
+      std::string value(m_data + m_pos, size);
+      m_pos += size;
+      return value;
+    }
+
+   private:
+    const char* m_data;
+    std::size_t m_size;
+    std::size_t m_pos;
+  };
+
+  void appendDateTime(std::string& buffer, const DateTime& dateTime) {
+    Date date = dateTime.date();
+    Time time = dateTime.time();
+    appendU32(buffer, date.baseYear() ? 1 : 0);
+    appendU32(buffer, static_cast<std::uint32_t>(date.year()));
+    appendU32(buffer, date.monthOfYear().value());
+    appendU32(buffer, date.dayOfMonth());
+    appendU32(buffer, time.hours());
+    appendU32(buffer, time.minutes());
+    appendU32(buffer, time.seconds());
+  }
+
+  DateTime readDateTime(DirectoryReader& reader) {
+    bool hasBaseYear = (reader.readU32() != 0);
+    int year = static_cast<int>(reader.readU32());
+    MonthOfYear month = monthOfYear(reader.readU32());
+    unsigned day = reader.readU32();
+    int hours = reader.readU32();
+    int minutes = reader.readU32();
+    int seconds = reader.readU32();
+    Date date = hasBaseYear ? Date(month, day, year) : Date(month, day);
+    return DateTime(date, Time(0, hours, minutes, seconds));
+  }
+
+  // string columns are stored as numRows + 1 offsets followed by the characters of every row
+  std::string stringColumnBytes(const std::vector<std::string>& values) {
+    std::string result;
+    std::uint64_t offset = 0;
+    appendU64(result, offset);
+    for (const std::string& value : values) {
+      offset += value.size();
+      appendU64(result, offset);
+    }
+    for (const std::string& value : values) {
+      result.append(value);
+    }
+    return result;
+  }
+
+}  // namespace
+
+struct ColumnarResults::State {
+  std::mutex mutex;
+  // inflated compressed blocks, by offset in the file
+  std::map<std::uint64_t, std::vector<char> > inflated;
+  // row of each cell of the TabularData table, built on first use
+  boost::optional<std::map<std::vector<std::string>, unsigned> > tabularDataIndex;
+};
+
+ColumnarResults::ColumnarResults(const openstudio::path& path)
+  : m_path(path), m_state(std::make_shared<State>())
+{
+  try {
+    m_file.open(toString(path));
+  } catch (const std::exception& e) {
+    LOG_AND_THROW("Cannot open columnar results file '" << toString(path) << "': " << e.what());
+  }
+  if (!m_file.is_open() || (m_file.size() < headerSize)) {
+    LOG_AND_THROW("'" << toString(path) << "' is not a columnar results file");
+  }
+
+  const char* data = m_file.data();
+  std::uint32_t bom;
+  std::uint32_t version;
+  std::uint64_t directoryOffset;
+  std::uint64_t directorySize;
+  std::memcpy(&bom, data + 8, sizeof(bom));
+  std::memcpy(&version, data + 12, sizeof(version));
+  std::memcpy(&directoryOffset, data + 16, sizeof(directoryOffset));
+  std::memcpy(&directorySize, data + 24, sizeof(directorySize));
+  if (std::memcmp(data, fileMagic, sizeof(fileMagic)) != 0) {
+    LOG_AND_THROW("'" << toString(path) << "' is not a columnar results file");
+  }
+  if (bom != byteOrderMark) {
+    LOG_AND_THROW("'" << toString(path) << "' was written on a machine of different byte order");
+  }
+  if (version != formatVersion) {
+    LOG_AND_THROW("'" << toString(path) << "' has unsupported columnar results version " << version);
+  }
+  if ((directoryOffset > m_file.size()) || (directorySize > m_file.size() - directoryOffset)) {
+    LOG_AND_THROW("'" << toString(path) << "' is truncated");
+  }
+
+  DirectoryReader reader(data + directoryOffset, directorySize);
+  auto readBlock = [&](std::size_t alignment) {
+    Block block;
+    block.offset = reader.readU64();
+    block.storedSize = reader.readU64();
+    block.size = reader.readU64();
+    block.encoding = reader.readU32();
+    if ((block.offset > m_file.size()) || (block.storedSize > m_file.size() - block.offset) || (block.size % alignment != 0) ||
+        ((block.encoding == rawEncoding) && ((block.storedSize != block.size) || (block.offset % alignment != 0))) ||
+        ((block.encoding != rawEncoding) && (block.encoding != zlibEncoding)))
+    {
+      LOG_AND_THROW("'" << toString(m_path) << "' has an invalid block at offset " << block.offset);
+    }
+    return block;
+  };
+
+  try {
+    m_timeAxes.resize(reader.readU32());
+    for (TimeAxis& timeAxis : m_timeAxes) {
+      timeAxis.firstReportDateTime = readDateTime(reader);
+      std::uint32_t intervalMinutes = reader.readU32();
+      if (intervalMinutes > 0) {
+        timeAxis.intervalMinutes = intervalMinutes;
+      }
+      timeAxis.secondsFromFirstReport = readBlock(sizeof(std::int64_t));
+    }
+
+    m_columns.resize(reader.readU32());
+    for (unsigned i = 0, n = m_columns.size(); i < n; ++i) {
+      Column& column = m_columns[i];
+      column.envPeriod = reader.readString();
+      column.reportingFrequency = reader.readString();
+      column.name = reader.readString();
+      column.keyValue = reader.readString();
+      column.units = reader.readString();
+      column.timeAxis = reader.readU32();
+      column.values = readBlock(sizeof(double));
+      if (column.timeAxis >= m_timeAxes.size()) {
+        LOG_AND_THROW("'" << toString(m_path) << "' has an invalid time axis for time series " << i);
+      }
+      m_columnIndex.insert(std::make_pair(std::make_tuple(boost::algorithm::to_upper_copy(column.envPeriod), column.reportingFrequency,
+                                                          column.name, boost::algorithm::to_upper_copy(column.keyValue)), i));
+    }
+
+    m_tables.resize(reader.readU32());
+    for (Table& table : m_tables) {
+      table.name = reader.readString();
+      table.numRows = reader.readU32();
+      unsigned numColumns = reader.readU32();
+      for (unsigned c = 0; c < numColumns; ++c) {
+        table.columnNames.push_back(reader.readString());
+        table.columns.push_back(readBlock(1));
+      }
+    }
+  } catch (const openstudio::Exception&) {
+    throw;
+  } catch (const std::exception& e) {
+    LOG_AND_THROW("Cannot read columnar results file '" << toString(m_path) << "': " << e.what());
+  }
+}
+
+boost::optional<ColumnarResults> ColumnarResults::load(const openstudio::path& path) {
+  try {
+    return ColumnarResults(path);
+  } catch (const std::exception&) {
+  }
+  return boost::none;
+}
+
+openstudio::path ColumnarResults::path() const {
+  return m_path;
+}
+
+unsigned ColumnarResults::numTimeSeries() const {
+  return m_columns.size();
+}
+
+std::string ColumnarResults::environmentPeriod(unsigned i) const {
+  return m_columns.at(i).envPeriod;
+}
+
+std::string ColumnarResults::reportingFrequency(unsigned i) const {
+  return m_columns.at(i).reportingFrequency;
+}
+
+std::string ColumnarResults::timeSeriesName(unsigned i) const {
+  return m_columns.at(i).name;
+}
+
+std::string ColumnarResults::keyValue(unsigned i) const {
+  return m_columns.at(i).keyValue;
+}
+
+std::string ColumnarResults::units(unsigned i) const {
+  return m_columns.at(i).units;
+}
+
+boost::optional<unsigned> ColumnarResults::find(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                const std::string& timeSeriesName, const std::string& keyValue) const
+{
+  auto it = m_columnIndex.find(std::make_tuple(boost::algorithm::to_upper_copy(envPeriod), reportingFrequency, timeSeriesName,
+                                               boost::algorithm::to_upper_copy(keyValue)));
+  if (it != m_columnIndex.end()) {
+    return it->second;
+  }
+  return boost::none;
+}
+
+ColumnarSpan<double> ColumnarResults::values(unsigned i) const {
+  const Block& block = m_columns.at(i).values;
+  return ColumnarSpan<double>(reinterpret_cast<const double*>(blockData(block)), block.size / sizeof(double));
+}
+
+unsigned ColumnarResults::numTimeAxes() const {
+  return m_timeAxes.size();
+}
+
+unsigned ColumnarResults::timeAxisIndex(unsigned i) const {
+  return m_columns.at(i).timeAxis;
+}
+
+DateTime ColumnarResults::firstReportDateTime(unsigned t) const {
+  return m_timeAxes.at(t).firstReportDateTime;
+}
+
+ColumnarSpan<std::int64_t> ColumnarResults::secondsFromFirstReport(unsigned t) const {
+  const Block& block = m_timeAxes.at(t).secondsFromFirstReport;
+  return ColumnarSpan<std::int64_t>(reinterpret_cast<const std::int64_t*>(blockData(block)), block.size / sizeof(std::int64_t));
+}
+
+boost::optional<Time> ColumnarResults::intervalLength(unsigned t) const {
+  const TimeAxis& timeAxis = m_timeAxes.at(t);
+  if (timeAxis.intervalMinutes) {
+    return Time(0, 0, *timeAxis.intervalMinutes, 0);
+  }
+  return boost::none;
+}
+
+TimeSeries ColumnarResults::timeSeries(unsigned i) const {
+  const Column& column = m_columns.at(i);
+  const TimeAxis& timeAxis = m_timeAxes[column.timeAxis];
+  ColumnarSpan<double> values = this->values(i);
+  Vector vector(values.size());
+  std::copy(values.begin(), values.end(), vector.begin());
+  if (timeAxis.intervalMinutes) {
+    return TimeSeries(timeAxis.firstReportDateTime, Time(0, 0, *timeAxis.intervalMinutes, 0), vector, column.units);
+  }
+  ColumnarSpan<std::int64_t> seconds = secondsFromFirstReport(column.timeAxis);
+  return TimeSeries(timeAxis.firstReportDateTime, std::vector<long>(seconds.begin(), seconds.end()), vector, column.units);
+}
+
+std::vector<std::string> ColumnarResults::tableNames() const {
+  std::vector<std::string> result;
+  for (const Table& table : m_tables) {
+    result.push_back(table.name);
+  }
+  return result;
+}
+
+std::vector<std::string> ColumnarResults::tableColumnNames(const std::string& table) const {
+  for (const Table& t : m_tables) {
+    if (t.name == table) {
+      return t.columnNames;
+    }
+  }
+  return std::vector<std::string>();
+}
+
+unsigned ColumnarResults::numTableRows(const std::string& table) const {
+  for (const Table& t : m_tables) {
+    if (t.name == table) {
+      return t.numRows;
+    }
+  }
+  return 0;
+}
+
+std::string ColumnarResults::tableValue(const std::string& table, const std::string& column, unsigned row) const {
+  const Table& t = this->table(table);
+  auto it = std::find(t.columnNames.begin(), t.columnNames.end(), column);
+  if (it == t.columnNames.end()) {
+    LOG_AND_THROW("No column '" << column << "' in table '" << table << "'");
+  }
+  return tableValue(t, static_cast<unsigned>(it - t.columnNames.begin()), row);
+}
+
+boost::optional<double> ColumnarResults::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                          const std::string& tableName, const std::string& rowName,
+                                                          const std::string& columnName, const std::string& units) const
+{
+  static const std::vector<std::string> keyColumns{"ReportName", "ReportForString", "TableName", "RowName", "ColumnName", "Units"};
+
+  auto tableIt = std::find_if(m_tables.begin(), m_tables.end(), [](const Table& t) { return t.name == "TabularData"; });
+  if (tableIt == m_tables.end()) {
+    return boost::none;
+  }
+  const Table& table = *tableIt;
+  auto valueIt = std::find(table.columnNames.begin(), table.columnNames.end(), "Value");
+  if (valueIt == table.columnNames.end()) {
+    return boost::none;
+  }
+
+  std::unique_lock<std::mutex> lock(m_state->mutex);
+  if (!m_state->tabularDataIndex) {
+    std::vector<unsigned> columns;
+    for (const std::string& keyColumn : keyColumns) {
+      auto it = std::find(table.columnNames.begin(), table.columnNames.end(), keyColumn);
+      if (it == table.columnNames.end()) {
+        return boost::none;
+      }
+      columns.push_back(static_cast<unsigned>(it - table.columnNames.begin()));
+    }
+
+    // reading compressed columns takes the lock
+    lock.unlock();
+    std::map<std::vector<std::string>, unsigned> index;
+    for (unsigned r = 0; r < table.numRows; ++r) {
+      std::vector<std::string> key;
+      for (unsigned c : columns) {
+        key.push_back(tableValue(table, c, r));
+      }
+      index.insert(std::make_pair(std::move(key), r));
+    }
+    lock.lock();
+    if (!m_state->tabularDataIndex) {
+      m_state->tabularDataIndex = std::move(index);
+    }
+  }
+
+  auto it = m_state->tabularDataIndex->find(std::vector<std::string>{reportName, reportForString, tableName, rowName, columnName, units});
+  if (it == m_state->tabularDataIndex->end()) {
+    return boost::none;
+  }
+  unsigned row = it->second;
+  lock.unlock();
+
+  std::string text = tableValue(table, static_cast<unsigned>(valueIt - table.columnNames.begin()), row);
+  const char* begin = text.c_str();
+  char* end = nullptr;
+  errno = 0;
+  double value = std::strtod(begin, &end);
+  if ((end == begin) || (errno == ERANGE)) {
+    return boost::none;
+  }
+  return value;
+}
+
+void ColumnarResults::write(const openstudio::path& path, const SqlFileTimeSeriesBatch& batch, const std::vector<StringTable>& tables, bool compress)
+{
+  std::ofstream file(toString(path), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!file) {
+    LOG_AND_THROW("Cannot open '" << toString(path) << "' for writing");
+  }
+
+  std::uint64_t offset = headerSize;
+  file.write(std::string(headerSize, '\0').data(), headerSize);
+
+  // writes data as a block aligned on 8 bytes, compressed if that makes it smaller, and adds its description to directory
+  std::string directory;
+  auto writeBlock = [&](const char* data, std::size_t size) {
+    std::uint64_t padding = (8 - offset % 8) % 8;
+    file.write("\0\0\0\0\0\0\0", padding);
+    offset += padding;
+
+    std::uint32_t encoding = rawEncoding;
+    std::vector<Bytef> compressed;
+    if (compress && (size > 0)) {
+      uLongf compressedSize = compressBound(size);
+      compressed.resize(compressedSize);
+      if ((compress2(compressed.data(), &compressedSize, reinterpret_cast<const Bytef*>(data), size, Z_DEFAULT_COMPRESSION) == Z_OK) &&
+          (compressedSize < size))
+      {
+        compressed.resize(compressedSize);
+        encoding = zlibEncoding;
+      }
+    }
+
+    std::uint64_t storedSize = size;
+    if (encoding == zlibEncoding) {
+      storedSize = compressed.size();
+      file.write(reinterpret_cast<const char*>(compressed.data()), storedSize);
+    } else {
+      file.write(data, size);
+    }
+
+    appendU64(directory, offset);
+    appendU64(directory, storedSize);
+    appendU64(directory, size);
+    appendU32(directory, encoding);
+    offset += storedSize;
+  };
+
+  appendU32(directory, batch.numTimeAxes());
+  for (unsigned t = 0, n = batch.numTimeAxes(); t < n; ++t) {
+    appendDateTime(directory, batch.firstReportDateTime(t));
+    boost::optional<Time> intervalLength = batch.intervalLength(t);
+    appendU32(directory, intervalLength ? static_cast<std::uint32_t>(intervalLength->totalMinutes() + 0.5) : 0u);
+    const std::vector<long>& seconds = batch.secondsFromFirstReport(t);
+    std::vector<std::int64_t> values(seconds.begin(), seconds.end());
+    writeBlock(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(std::int64_t));
+  }
+
+  appendU32(directory, batch.size());
+  for (unsigned i = 0, n = batch.size(); i < n; ++i) {
+    appendString(directory, batch.environmentPeriod(i));
+    appendString(directory, batch.reportingFrequency(i));
+    appendString(directory, batch.timeSeriesName(i));
+    appendString(directory, batch.keyValue(i));
+    appendString(directory, batch.units(i));
+    appendU32(directory, batch.timeAxisIndex(i));
+    const std::vector<double>& values = batch.values(i);
+    writeBlock(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+  }
+
+  appendU32(directory, tables.size());
+  for (const StringTable& table : tables) {
+    OS_ASSERT(table.columnNames.size() == table.columns.size());
+    appendString(directory, table.name);
+    appendU32(directory, table.columns.empty() ? 0u : table.columns[0].size());
+    appendU32(directory, table.columns.size());
+    for (unsigned c = 0; c < table.columns.size(); ++c) {
+      OS_ASSERT(table.columns[c].size() == table.columns[0].size());
+      appendString(directory, table.columnNames[c]);
+      std::string bytes = stringColumnBytes(table.columns[c]);
+      writeBlock(bytes.data(), bytes.size());
+    }
+  }
+
+  std::uint64_t directoryOffset = offset;
+  file.write(directory.data(), directory.size());
+
+  std::string header(fileMagic, sizeof(fileMagic));
+  appendU32(header, byteOrderMark);
+  appendU32(header, formatVersion);
+  appendU64(header, directoryOffset);
+  appendU64(header, directory.size());
+  OS_ASSERT(header.size() == headerSize);
+  file.seekp(0);
+  file.write(header.data(), header.size());
+
+  file.close();
+  if (!file) {
+    LOG_AND_THROW("Error writing '" << toString(path) << "'");
+  }
+}
+
+const char* ColumnarResults::blockData(const Block& block) const {
+  if (block.encoding == rawEncoding) {
+    return m_file.data() + block.offset;
+  }
+
+  std::lock_guard<std::mutex> lock(m_state->mutex);
+  auto it = m_state->inflated.find(block.offset);
+  if (it == m_state->inflated.end()) {
+    // vector storage is suitably aligned for the doubles and integers in blocks
+    std::vector<char> buffer(block.size);
+    uLongf size = block.size;
+    if ((uncompress(reinterpret_cast<Bytef*>(buffer.data()), &size, reinterpret_cast<const Bytef*>(m_file.data() + block.offset), block.storedSize) != Z_OK) ||
+        (size != block.size))
+    {
+      LOG_AND_THROW("'" << toString(m_path) << "' has a corrupt block at offset " << block.offset);
+    }
+    it = m_state->inflated.insert(std::make_pair(block.offset, std::move(buffer))).first;
+  }
+  return it->second.data();
+}
+
+const ColumnarResults::Table& ColumnarResults::table(const std::string& name) const {
+  for (const Table& table : m_tables) {
+    if (table.name == name) {
+      return table;
+    }
+  }
+  LOG_AND_THROW("No table '" << name << "' in '" << toString(m_path) << "'");
+}
+
+std::string ColumnarResults::tableValue(const Table& table, unsigned column, unsigned row) const {
+  if (row >= table.numRows) {
+    LOG_AND_THROW("Row " << row << " is out of range of table '" << table.name << "'");
+  }
+  const Block& block = table.columns.at(column);
+  if (block.size < (table.numRows + 1) * sizeof(std::uint64_t)) {
+    LOG_AND_THROW("'" << toString(m_path) << "' has an invalid column in table '" << table.name << "'");
+  }
+  const char* data = blockData(block);
+  std::uint64_t begin;
+  std::uint64_t end;
+  std::memcpy(&begin, data + row * sizeof(std::uint64_t), sizeof(begin));
+  std::memcpy(&end, data + (row + 1) * sizeof(std::uint64_t), sizeof(end));
+  std::uint64_t charsOffset = (table.numRows + 1) * sizeof(std::uint64_t);
+  if ((begin > end) || (end > block.size - charsOffset)) {
+    LOG_AND_THROW("'" << toString(m_path) << "' has an invalid column in table '" << table.name << "'");
+  }
+  return std::string(data + charsOffset + begin, end - begin);
+}
+
+} // openstudio
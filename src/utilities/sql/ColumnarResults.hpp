@@ -0,0 +1,243 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_COLUMNARRESULTS_HPP
+#define UTILITIES_SQL_COLUMNARRESULTS_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../core/Path.hpp"
+#include "../core/Logger.hpp"
+#include "../time/DateTime.hpp"
+#include "../data/TimeSeries.hpp"
+
+#include <boost/optional.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace openstudio {
+
+// forward declarations
+class SqlFileTimeSeriesBatch;
+namespace detail {
+  class SqlFile_Impl;
+}
+
+/** Read only view of count contiguous values of type T, such as a column of a ColumnarResults file. Does not
+ *  own the values, which stay valid for as long as the ColumnarResults they came from. */
+template <typename T>
+class ColumnarSpan {
+ public:
+  ColumnarSpan() : m_data(nullptr), m_size(0) {}
+
+  ColumnarSpan(const T* data, std::size_t size) : m_data(data), m_size(size) {}
+
+  const T* data() const { return m_data; }
+
+  std::size_t size() const { return m_size; }
+
+  bool empty() const { return m_size == 0; }
+
+  const T* begin() const { return m_data; }
+
+  const T* end() const { return m_data + m_size; }
+
+  const T& operator[](std::size_t i) const { return m_data[i]; }
+
+ private:
+  const T* m_data;
+  std::size_t m_size;
+};
+
+/** Reader for the column oriented binary files written by SqlFile::exportColumnar. The file holds the values of
+ *  selected time series, one column per time series, the time axes they share, and string tables of the data
+ *  dictionary ("DataDictionary") and of the tabular reports ("TabularData").
+ *
+ *  The file is memory mapped and not parsed beyond its directory, so opening it and reading a column is
+ *  cheap. Columns that were written uncompressed are returned as spans over the mapped file without copying;
+ *  compressed columns are inflated the first time they are read and kept for the lifetime of the reader. */
+class UTILITIES_API ColumnarResults {
+ public:
+  /** @name Constructors */
+  //@{
+
+  /** Opens the file at path, throws openstudio::Exception if it is not a valid columnar results file. */
+  explicit ColumnarResults(const openstudio::path& path);
+
+  /** Returns the columnar results file at path, if it can be read. */
+  static boost::optional<ColumnarResults> load(const openstudio::path& path);
+
+  //@}
+  /** @name Time Series */
+  //@{
+
+  openstudio::path path() const;
+
+  /** Returns the number of time series. */
+  unsigned numTimeSeries() const;
+
+  /** Returns the environment period of time series i. Throws if i >= numTimeSeries(). */
+  std::string environmentPeriod(unsigned i) const;
+
+  /** Returns the reporting frequency of time series i, as stored in the SqlFile. Throws if i >= numTimeSeries(). */
+  std::string reportingFrequency(unsigned i) const;
+
+  /** Returns the name of time series i. Throws if i >= numTimeSeries(). */
+  std::string timeSeriesName(unsigned i) const;
+
+  /** Returns the key value of time series i. Throws if i >= numTimeSeries(). */
+  std::string keyValue(unsigned i) const;
+
+  /** Returns the units of time series i. Throws if i >= numTimeSeries(). */
+  std::string units(unsigned i) const;
+
+  /** Returns the index of the time series with the given environment period, reporting frequency, name and
+   *  key value, if there is one. Environment period and key value are compared case insensitively. */
+  boost::optional<unsigned> find(const std::string& envPeriod, const std::string& reportingFrequency,
+                                 const std::string& timeSeriesName, const std::string& keyValue) const;
+
+  /** Returns the values of time series i. Throws if i >= numTimeSeries(). */
+  ColumnarSpan<double> values(unsigned i) const;
+
+  /** Returns the number of distinct time axes shared by the time series. */
+  unsigned numTimeAxes() const;
+
+  /** Returns the index of the time axis of time series i. Throws if i >= numTimeSeries(). */
+  unsigned timeAxisIndex(unsigned i) const;
+
+  /** Returns the first report date and time of time axis t. Throws if t >= numTimeAxes(). */
+  DateTime firstReportDateTime(unsigned t) const;
+
+  /** Returns the seconds from the first report of each value on time axis t. Throws if t >= numTimeAxes(). */
+  ColumnarSpan<std::int64_t> secondsFromFirstReport(unsigned t) const;
+
+  /** Returns the interval between reports on time axis t, if they are evenly spaced. Throws if t >= numTimeAxes(). */
+  boost::optional<Time> intervalLength(unsigned t) const;
+
+  /** Returns time series i as a TimeSeries, copying its values. Throws if i >= numTimeSeries(). */
+  TimeSeries timeSeries(unsigned i) const;
+
+  //@}
+  /** @name String Tables */
+  //@{
+
+  /** Returns the names of the string tables, "DataDictionary" and "TabularData" for files written by
+   *  SqlFile::exportColumnar. */
+  std::vector<std::string> tableNames() const;
+
+  /** Returns the column names of table, empty if there is no such table. */
+  std::vector<std::string> tableColumnNames(const std::string& table) const;
+
+  /** Returns the number of rows of table, 0 if there is no such table. */
+  unsigned numTableRows(const std::string& table) const;
+
+  /** Returns the value in column and row of table. Throws if there is no such table, column or row. */
+  std::string tableValue(const std::string& table, const std::string& column, unsigned row) const;
+
+  /** Returns the value of a tabular report cell, like SqlFile::execAndReturnFirstDouble on TabularDataWithStrings,
+   *  if there is one and it is numeric. */
+  boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                           const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+  //@}
+ private:
+  friend class detail::SqlFile_Impl;
+
+  REGISTER_LOGGER("openstudio.sql.ColumnarResults");
+
+  // a run of bytes in the file, possibly compressed
+  struct Block {
+    std::uint64_t offset = 0;
+    std::uint64_t storedSize = 0;
+    std::uint64_t size = 0;
+    std::uint32_t encoding = 0;
+  };
+
+  struct TimeAxis {
+    DateTime firstReportDateTime;
+    boost::optional<unsigned> intervalMinutes;
+    Block secondsFromFirstReport;
+  };
+
+  struct Column {
+    std::string envPeriod;
+    std::string reportingFrequency;
+    std::string name;
+    std::string keyValue;
+    std::string units;
+    unsigned timeAxis = 0;
+    Block values;
+  };
+
+  // string table as written, one vector of strings per column
+  struct StringTable {
+    std::string name;
+    std::vector<std::string> columnNames;
+    std::vector<std::vector<std::string> > columns;
+  };
+
+  struct Table {
+    std::string name;
+    unsigned numRows = 0;
+    std::vector<std::string> columnNames;
+    std::vector<Block> columns;
+  };
+
+  struct State;
+
+  // writes a file for ColumnarResults to read, throws openstudio::Exception on failure
+  static void write(const openstudio::path& path, const SqlFileTimeSeriesBatch& batch, const std::vector<StringTable>& tables, bool compress);
+
+  // returns the bytes of block, inflating it on first use if it is compressed
+  const char* blockData(const Block& block) const;
+
+  const Table& table(const std::string& name) const;
+
+  std::string tableValue(const Table& table, unsigned column, unsigned row) const;
+
+  openstudio::path m_path;
+  boost::iostreams::mapped_file_source m_file;
+  std::vector<TimeAxis> m_timeAxes;
+  std::vector<Column> m_columns;
+  std::vector<Table> m_tables;
+  std::map<std::tuple<std::string, std::string, std::string, std::string>, unsigned> m_columnIndex;
+  // inflated blocks and the tabular data index, shared by copies
+  std::shared_ptr<State> m_state;
+};
+
+} // openstudio
+
+#endif // UTILITIES_SQL_COLUMNARRESULTS_HPP
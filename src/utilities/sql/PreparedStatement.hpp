@@ -47,12 +47,14 @@ struct PreparedStatement
   sqlite3 *m_db;
   sqlite3_stmt *m_statement;
   bool m_transaction;
+  // statement belongs to a statement cache, reset it instead of finalizing it
+  bool m_cached;
 
   PreparedStatement & operator=(const PreparedStatement&) = delete;
   PreparedStatement(const PreparedStatement&) = delete;
 
   PreparedStatement(const std::string &t_stmt, sqlite3 *t_db, bool t_transaction = false)
-  : m_db(t_db), m_statement(nullptr), m_transaction(t_transaction)
+  : m_db(t_db), m_statement(nullptr), m_transaction(t_transaction), m_cached(false)
   {
     if (m_transaction)
     {
@@ -73,7 +75,7 @@ struct PreparedStatement
 
   template<typename... Args>
   PreparedStatement(const std::string &t_stmt, sqlite3 *t_db, bool t_transaction, Args&&... args)
-  : m_db(t_db), m_statement(nullptr), m_transaction(t_transaction)
+  : m_db(t_db), m_statement(nullptr), m_transaction(t_transaction), m_cached(false)
   {
     if (m_transaction)
     {
@@ -96,9 +98,27 @@ struct PreparedStatement
     }
   }
 
+  // Uses a statement that was already prepared and is kept in a cache, such as the one in SqlFile_Impl.
+  // The statement is reset and its bindings cleared on destruction, so that it can be used again.
+  // A null statement (one that failed to prepare) is accepted and simply returns no rows.
+  // t_db is only used for a null statement, otherwise the connection the statement was prepared on is used
+  template<typename... Args>
+  PreparedStatement(sqlite3_stmt *t_statement, sqlite3 *t_db, Args&&... args)
+  : m_db(t_statement ? sqlite3_db_handle(t_statement) : t_db), m_statement(t_statement), m_transaction(false), m_cached(true)
+  {
+    if (m_statement && !bindAll(args...)) {
+      throw std::runtime_error("Error bindings args with statement: " + std::string(sqlite3_sql(m_statement)));
+    }
+  }
+
   ~PreparedStatement()
   {
-    if (m_statement)
+    if (m_statement && m_cached)
+    {
+      sqlite3_reset(m_statement);
+      sqlite3_clear_bindings(m_statement);
+    }
+    else if (m_statement)
     {
       sqlite3_finalize(m_statement);
     }
@@ -48,6 +48,15 @@ SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes)
 }
 
 
+SqlFile::SqlFile(const openstudio::path& path, const SqlFileOpenMode& openMode, const bool createIndexes)
+{
+  try{
+    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, openMode, createIndexes));
+  }catch(const std::exception& e){
+    LOG(Error, "Could not create SqlFile for path '" << openstudio::toString(path) << "' error:" << e.what());
+  }
+}
+
 SqlFile::SqlFile(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
     const openstudio::Calendar &t_calendar, const bool createIndexes)
 {
@@ -92,6 +101,14 @@ openstudio::path SqlFile::path() const {
   return result;
 }
 
+SqlFileOpenMode SqlFile::openMode() const {
+  SqlFileOpenMode result = SqlFileOpenMode::ReadWrite;
+  if (m_impl) {
+    result = m_impl->openMode();
+  }
+  return result;
+}
+
 bool SqlFile::close()
 {
   bool result = false;
@@ -1326,6 +1343,29 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+SqlFileTimeSeriesBatch SqlFile::timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+  SqlFileTimeSeriesBatch result;
+  if (m_impl) {
+    result = m_impl->timeSeriesBatch(queries);
+  }
+  return result;
+}
+
+SqlFileTimeSeriesCursor SqlFile::timeSeriesCursor(const std::vector<SqlFileTimeSeriesQuery>& queries, unsigned blockSize) {
+  SqlFileTimeSeriesCursor result;
+  if (m_impl) {
+    result = m_impl->timeSeriesCursor(queries, blockSize);
+  }
+  return result;
+}
+
+bool SqlFile::exportColumnar(const openstudio::path& path, const std::vector<SqlFileTimeSeriesQuery>& queries, bool compress) {
+  if (m_impl) {
+    return m_impl->exportColumnar(path, queries, compress);
+  }
+  return false;
+}
+
 boost::optional<std::pair<DateTime, DateTime> > SqlFile::daylightSavingsPeriod() const
 {
   boost::optional<std::pair<DateTime, DateTime> > result;
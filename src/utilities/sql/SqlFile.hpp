@@ -78,6 +78,11 @@ class UTILITIES_API SqlFile {
   /// Creates indexes by default, pass in false for no new indexes and quicker opening
   explicit SqlFile(const openstudio::path& path, const bool createIndexes=true);
 
+  /// constructor from path opening the file in openMode
+  /// In ReadOnly mode the file is never written to and queries may be run from several threads at once.
+  /// Indexes cannot be added to the file then, pass in true for createIndexes to query an indexed temporary copy of it instead
+  SqlFile(const openstudio::path& path, const SqlFileOpenMode& openMode, const bool createIndexes);
+
   /// initializes a new sql file for output
   /// Creates indexes by default, pass in false for no indexes and quicker creation
   SqlFile(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
@@ -102,6 +107,9 @@ class UTILITIES_API SqlFile {
   /// get the path
   openstudio::path path() const;
 
+  /// mode the file was opened in
+  SqlFileOpenMode openMode() const;
+
   /// \returns true if the sqlfile is of a version that's in our supported range
   bool supportedVersion() const;
 
@@ -706,6 +714,24 @@ class UTILITIES_API SqlFile {
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Expands and executes all queries at once, returning the matching time series in a columnar container
+   *  in order and without duplicates. Unlike calling timeSeries for each query and key value, reported values
+   *  are read in one scan per data table, and time series reported at the same times for the same environment
+   *  period and reporting frequency share one time axis. */
+  SqlFileTimeSeriesBatch timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
+  /** Expands all queries and returns a forward only cursor over the matching time series, reading their values
+   *  in time order blockSize time steps at a time rather than all at once. Use it to reduce or export long
+   *  timestep results in constant memory. */
+  SqlFileTimeSeriesCursor timeSeriesCursor(const std::vector<SqlFileTimeSeriesQuery>& queries, unsigned blockSize = 4096);
+
+  /** Writes the time series matching queries, along with the data dictionary and all tabular data, to a
+   *  column oriented binary file at path that ColumnarResults reads without SQLite. Each time series is stored
+   *  as one contiguous block of doubles, and time series sharing a time axis in timeSeriesBatch share it in the
+   *  file. If compress is true, blocks are deflated when that makes them smaller; compressed blocks are
+   *  inflated on first read rather than mapped directly. Returns false if the file could not be written. */
+  bool exportColumnar(const openstudio::path& path, const std::vector<SqlFileTimeSeriesQuery>& queries, bool compress = false);
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
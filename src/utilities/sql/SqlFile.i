@@ -8,6 +8,10 @@
   #include <utilities/sql/SqlFile.hpp>
   #include <utilities/sql/SqlFileEnums.hpp>
   #include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
+  #include <utilities/sql/SqlFileTimeSeriesBatch.hpp>
+  #include <utilities/sql/SqlFileTimeSeriesCursor.hpp>
+  #include <utilities/sql/SqlFileCollection.hpp>
+  #include <utilities/sql/ColumnarResults.hpp>
 
   #include <utilities/units/Unit.hpp>
   #include <utilities/units/BTUUnit.hpp>
@@ -44,7 +48,19 @@
 
 %template(SqlTimeSeriesQueryVector) std::vector<openstudio::SqlFileTimeSeriesQuery>;
 
+// visitor callbacks are not supported, use process instead
+%ignore openstudio::SqlFileCollection::forEach;
+
+// spans point into the mapped file, use timeSeries instead
+%ignore openstudio::ColumnarSpan;
+%ignore openstudio::ColumnarResults::values;
+%ignore openstudio::ColumnarResults::secondsFromFirstReport;
+
+%include <utilities/sql/SqlFileTimeSeriesBatch.hpp>
+%include <utilities/sql/SqlFileTimeSeriesCursor.hpp>
 %include <utilities/sql/SqlFile.hpp>
+%include <utilities/sql/SqlFileCollection.hpp>
+%include <utilities/sql/ColumnarResults.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
 %include <utilities/sql/SqlFileEnums.hpp>
 
@@ -0,0 +1,359 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileCollection.hpp"
+#include "SqlFile.hpp"
+
+#include "../data/Vector.hpp"
+#include "../core/Assert.hpp"
+#include "../core/Compare.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+
+namespace openstudio {
+
+SqlFileCollection::SqlFileCollection(const std::vector<openstudio::path>& paths, const std::vector<SqlFileTimeSeriesQuery>& queries)
+  : m_paths(paths), m_queries(queries), m_numThreads(0), m_elapsedSeconds(0.0), m_numProcessed(0), m_processed(paths.size(), false)
+{
+  setNumThreads(0);
+}
+
+std::vector<openstudio::path> SqlFileCollection::paths() const {
+  return m_paths;
+}
+
+std::vector<SqlFileTimeSeriesQuery> SqlFileCollection::queries() const {
+  return m_queries;
+}
+
+unsigned SqlFileCollection::numThreads() const {
+  return m_numThreads;
+}
+
+void SqlFileCollection::setNumThreads(unsigned numThreads) {
+  if (numThreads == 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  m_numThreads = numThreads;
+}
+
+unsigned SqlFileCollection::process(bool keepValues) {
+  m_processed.assign(m_paths.size(), false);
+  m_variables.clear();
+  m_timeAxes.clear();
+  m_cells.assign(m_paths.size(), std::vector<Cell>());
+
+  // variables are numbered as they are first reported and sorted once every file is done
+  std::map<std::tuple<std::string, std::string, std::string, std::string>, unsigned> variableIndex;
+
+  unsigned result = run([&](unsigned run, const SqlFileTimeSeriesBatch& batch) {
+    m_processed[run] = true;
+
+    std::vector<unsigned> timeAxes;
+    if (keepValues) {
+      for (unsigned t = 0, n = batch.numTimeAxes(); t < n; ++t) {
+        auto it = std::find_if(m_timeAxes.begin(), m_timeAxes.end(), [&](const TimeAxis& timeAxis) {
+          return (timeAxis.firstReportDateTime == batch.firstReportDateTime(t)) &&
+                 (timeAxis.secondsFromFirstReport == batch.secondsFromFirstReport(t));
+        });
+        if (it == m_timeAxes.end()) {
+          TimeAxis timeAxis;
+          timeAxis.firstReportDateTime = batch.firstReportDateTime(t);
+          timeAxis.secondsFromFirstReport = batch.secondsFromFirstReport(t);
+          timeAxis.intervalLength = batch.intervalLength(t);
+          it = m_timeAxes.insert(m_timeAxes.end(), timeAxis);
+        }
+        timeAxes.push_back(static_cast<unsigned>(it - m_timeAxes.begin()));
+      }
+    }
+
+    std::vector<Cell>& cells = m_cells[run];
+    for (unsigned i = 0, n = batch.size(); i < n; ++i) {
+      auto key = std::make_tuple(boost::algorithm::to_upper_copy(batch.environmentPeriod(i)), batch.reportingFrequency(i),
+                                 batch.timeSeriesName(i), boost::algorithm::to_upper_copy(batch.keyValue(i)));
+      auto it = variableIndex.find(key);
+      if (it == variableIndex.end()) {
+        it = variableIndex.insert(std::make_pair(key, static_cast<unsigned>(m_variables.size()))).first;
+        Variable variable;
+        variable.envPeriod = batch.environmentPeriod(i);
+        variable.reportingFrequency = batch.reportingFrequency(i);
+        variable.name = batch.timeSeriesName(i);
+        variable.keyValue = batch.keyValue(i);
+        variable.units = batch.units(i);
+        m_variables.push_back(variable);
+      }
+      if (cells.size() <= it->second) {
+        cells.resize(it->second + 1);
+      }
+
+      const std::vector<double>& values = batch.values(i);
+      Cell& cell = cells[it->second];
+      cell.reported = true;
+      cell.count = values.size();
+      if (!values.empty()) {
+        auto minmax = std::minmax_element(values.begin(), values.end());
+        cell.minimum = *minmax.first;
+        cell.maximum = *minmax.second;
+        cell.sum = 0.0;
+        for (double value : values) {
+          cell.sum += value;
+        }
+      }
+      if (keepValues) {
+        cell.timeAxis = timeAxes[batch.timeAxisIndex(i)];
+        cell.values = values;
+      }
+    }
+  });
+
+  for (std::vector<Cell>& cells : m_cells) {
+    cells.resize(m_variables.size());
+  }
+  sortVariables();
+
+  return result;
+}
+
+unsigned SqlFileCollection::forEach(const std::function<void(unsigned, const SqlFileTimeSeriesBatch&)>& visitor) {
+  return run(visitor);
+}
+
+double SqlFileCollection::elapsedSeconds() const {
+  return m_elapsedSeconds;
+}
+
+double SqlFileCollection::filesPerSecond() const {
+  if (m_elapsedSeconds > 0.0) {
+    return m_numProcessed / m_elapsedSeconds;
+  }
+  return 0.0;
+}
+
+unsigned SqlFileCollection::numRuns() const {
+  return m_paths.size();
+}
+
+bool SqlFileCollection::processed(unsigned run) const {
+  return m_processed.at(run);
+}
+
+unsigned SqlFileCollection::numVariables() const {
+  return m_variables.size();
+}
+
+std::string SqlFileCollection::environmentPeriod(unsigned v) const {
+  return m_variables.at(v).envPeriod;
+}
+
+std::string SqlFileCollection::reportingFrequency(unsigned v) const {
+  return m_variables.at(v).reportingFrequency;
+}
+
+std::string SqlFileCollection::timeSeriesName(unsigned v) const {
+  return m_variables.at(v).name;
+}
+
+std::string SqlFileCollection::keyValue(unsigned v) const {
+  return m_variables.at(v).keyValue;
+}
+
+std::string SqlFileCollection::units(unsigned v) const {
+  return m_variables.at(v).units;
+}
+
+boost::optional<unsigned> SqlFileCollection::find(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                  const std::string& timeSeriesName, const std::string& keyValue) const
+{
+  for (unsigned v = 0, n = m_variables.size(); v < n; ++v) {
+    const Variable& variable = m_variables[v];
+    if ((variable.name == timeSeriesName) && (variable.reportingFrequency == reportingFrequency) &&
+        istringEqual(variable.keyValue, keyValue) && istringEqual(variable.envPeriod, envPeriod))
+    {
+      return v;
+    }
+  }
+  return boost::none;
+}
+
+boost::optional<double> SqlFileCollection::reduction(unsigned run, unsigned v, const SqlFileReduction& reduction) const {
+  const Cell& c = cell(run, v);
+  if (!c.reported || (c.count == 0)) {
+    return boost::none;
+  }
+  switch (reduction.value()) {
+    case SqlFileReduction::Sum:
+      return c.sum;
+    case SqlFileReduction::Mean:
+      return c.sum / c.count;
+    case SqlFileReduction::Minimum:
+      return c.minimum;
+    case SqlFileReduction::Maximum:
+      return c.maximum;
+    default:
+      OS_ASSERT(false);
+  }
+  return boost::none;
+}
+
+std::vector<double> SqlFileCollection::reductions(unsigned v, const SqlFileReduction& reduction) const {
+  std::vector<double> result;
+  result.reserve(m_cells.size());
+  for (unsigned run = 0, n = m_cells.size(); run < n; ++run) {
+    boost::optional<double> value = this->reduction(run, v, reduction);
+    result.push_back(value ? *value : std::numeric_limits<double>::quiet_NaN());
+  }
+  return result;
+}
+
+const std::vector<double>& SqlFileCollection::values(unsigned run, unsigned v) const {
+  return cell(run, v).values;
+}
+
+boost::optional<TimeSeries> SqlFileCollection::timeSeries(unsigned run, unsigned v) const {
+  const Cell& c = cell(run, v);
+  if (!c.reported || c.values.empty()) {
+    return boost::none;
+  }
+  const TimeAxis& timeAxis = m_timeAxes[c.timeAxis];
+  if (timeAxis.intervalLength) {
+    return TimeSeries(timeAxis.firstReportDateTime, *timeAxis.intervalLength, createVector(c.values), m_variables[v].units);
+  }
+  return TimeSeries(timeAxis.firstReportDateTime, timeAxis.secondsFromFirstReport, createVector(c.values), m_variables[v].units);
+}
+
+unsigned SqlFileCollection::run(const std::function<void(unsigned, const SqlFileTimeSeriesBatch&)>& visitor) {
+  std::atomic<unsigned> next(0);
+  std::mutex visitorMutex;
+  std::exception_ptr visitorException;
+  m_numProcessed = 0;
+
+  auto start = std::chrono::steady_clock::now();
+
+  auto work = [&]() {
+    for (unsigned run = next++, n = m_paths.size(); run < n; run = next++) {
+      SqlFileTimeSeriesBatch batch;
+      try {
+        // only open for as long as it takes to query it
+        SqlFile sqlFile(m_paths[run], SqlFileOpenMode::ReadOnly, false);
+        if (!sqlFile.connectionOpen()) {
+          LOG(Warn, "Skipping '" << toString(m_paths[run]) << "', it could not be opened");
+          continue;
+        }
+        batch = sqlFile.timeSeriesBatch(m_queries);
+      } catch (const std::exception& e) {
+        LOG(Warn, "Skipping '" << toString(m_paths[run]) << "', it could not be queried: " << e.what());
+        continue;
+      }
+
+      std::lock_guard<std::mutex> lock(visitorMutex);
+      if (visitorException) {
+        return;
+      }
+      try {
+        visitor(run, batch);
+        ++m_numProcessed;
+      } catch (...) {
+        // rethrown once every thread is done
+        visitorException = std::current_exception();
+        return;
+      }
+    }
+  };
+
+  unsigned numThreads = std::min<unsigned>(m_numThreads, m_paths.size());
+  if (numThreads <= 1) {
+    work();
+  } else {
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < numThreads; ++i) {
+      threads.emplace_back(work);
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  m_elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  if (visitorException) {
+    std::rethrow_exception(visitorException);
+  }
+  LOG(Debug, "Processed " << m_numProcessed << " of " << m_paths.size() << " files in " << m_elapsedSeconds << " s, "
+      << filesPerSecond() << " files/s");
+
+  return m_numProcessed;
+}
+
+void SqlFileCollection::sortVariables() {
+  std::vector<unsigned> order(m_variables.size());
+  for (unsigned v = 0, n = order.size(); v < n; ++v) {
+    order[v] = v;
+  }
+  std::sort(order.begin(), order.end(), [this](unsigned a, unsigned b) {
+    const Variable& lhs = m_variables[a];
+    const Variable& rhs = m_variables[b];
+    return std::tie(lhs.envPeriod, lhs.reportingFrequency, lhs.name, lhs.keyValue) <
+           std::tie(rhs.envPeriod, rhs.reportingFrequency, rhs.name, rhs.keyValue);
+  });
+
+  std::vector<Variable> variables;
+  variables.reserve(order.size());
+  for (unsigned v : order) {
+    variables.push_back(m_variables[v]);
+  }
+  m_variables.swap(variables);
+
+  for (std::vector<Cell>& cells : m_cells) {
+    std::vector<Cell> sorted;
+    sorted.reserve(order.size());
+    for (unsigned v : order) {
+      sorted.push_back(std::move(cells[v]));
+    }
+    cells.swap(sorted);
+  }
+}
+
+const SqlFileCollection::Cell& SqlFileCollection::cell(unsigned run, unsigned v) const {
+  if (v >= m_variables.size()) {
+    throw std::out_of_range("Variable index out of range");
+  }
+  return m_cells.at(run)[v];
+}
+
+} // openstudio
@@ -0,0 +1,200 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILECOLLECTION_HPP
+#define UTILITIES_SQL_SQLFILECOLLECTION_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "SqlFileEnums.hpp"
+#include "SqlFileTimeSeriesQuery.hpp"
+#include "SqlFileTimeSeriesBatch.hpp"
+#include "../core/Path.hpp"
+#include "../core/Logger.hpp"
+#include "../time/DateTime.hpp"
+#include "../data/TimeSeries.hpp"
+
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+/** Runs the same time series queries over many SqlFiles, such as the results of a parametric or
+ *  uncertainty study, and collects the results in a table of runs by variables. Run i is the file at
+ *  paths()[i], a variable is a time series identified by its environment period, reporting frequency,
+ *  name and key value.
+ *
+ *  Files are processed on numThreads() threads. Each file is opened read only, queried once with
+ *  SqlFile::timeSeriesBatch and closed before the thread moves on, so at most numThreads() files and
+ *  their results are held at once besides the table itself. The table always holds the sum, mean,
+ *  minimum and maximum of every time series; the values are only kept when asked for. */
+class UTILITIES_API SqlFileCollection {
+ public:
+  /** @name Constructors */
+  //@{
+
+  SqlFileCollection(const std::vector<openstudio::path>& paths, const std::vector<SqlFileTimeSeriesQuery>& queries);
+
+  //@}
+  /** @name Getters and Setters */
+  //@{
+
+  std::vector<openstudio::path> paths() const;
+
+  std::vector<SqlFileTimeSeriesQuery> queries() const;
+
+  /** Returns the number of threads files are processed on, the number of hardware threads by default. */
+  unsigned numThreads() const;
+
+  /** Sets the number of threads files are processed on, 0 resets it to the number of hardware threads. */
+  void setNumThreads(unsigned numThreads);
+
+  //@}
+  /** @name Processing */
+  //@{
+
+  /** Runs the queries over every file and fills the table, replacing the results of any previous call.
+   *  The values of each time series are kept if keepValues is true, otherwise only its reductions are.
+   *  Files that cannot be opened are logged and skipped. Returns the number of files processed. */
+  unsigned process(bool keepValues = false);
+
+  /** Runs the queries over every file and passes the results of each file to visitor along with its run
+   *  index, without storing anything. Visitor is called by one thread at a time, in the order files
+   *  complete. Files that cannot be opened are logged and skipped. Returns the number of files processed. */
+  unsigned forEach(const std::function<void(unsigned, const SqlFileTimeSeriesBatch&)>& visitor);
+
+  /** Returns the wall clock time taken by the last call to process or forEach, in seconds. */
+  double elapsedSeconds() const;
+
+  /** Returns the number of files processed per second by the last call to process or forEach. */
+  double filesPerSecond() const;
+
+  //@}
+  /** @name Results */
+  //@{
+
+  /** Returns the number of runs, which is the number of paths. */
+  unsigned numRuns() const;
+
+  /** Returns true if run was processed by the last call to process. */
+  bool processed(unsigned run) const;
+
+  /** Returns the number of variables reported by any run, sorted by environment period, reporting
+   *  frequency, name and key value. */
+  unsigned numVariables() const;
+
+  /** Returns the environment period of variable v. Throws if v >= numVariables(). */
+  std::string environmentPeriod(unsigned v) const;
+
+  /** Returns the reporting frequency of variable v, as stored in the SqlFiles. Throws if v >= numVariables(). */
+  std::string reportingFrequency(unsigned v) const;
+
+  /** Returns the name of variable v. Throws if v >= numVariables(). */
+  std::string timeSeriesName(unsigned v) const;
+
+  /** Returns the key value of variable v. Throws if v >= numVariables(). */
+  std::string keyValue(unsigned v) const;
+
+  /** Returns the units of variable v. Throws if v >= numVariables(). */
+  std::string units(unsigned v) const;
+
+  /** Returns the index of the variable with the given environment period, reporting frequency, name and
+   *  key value, if there is one. Environment period and key value are compared case insensitively. */
+  boost::optional<unsigned> find(const std::string& envPeriod, const std::string& reportingFrequency,
+                                 const std::string& timeSeriesName, const std::string& keyValue) const;
+
+  /** Returns the reduction of variable v in run, if the run reported it. Throws if run >= numRuns() or
+   *  v >= numVariables(). */
+  boost::optional<double> reduction(unsigned run, unsigned v, const SqlFileReduction& reduction) const;
+
+  /** Returns the reduction of variable v in every run, NaN for runs that did not report it. Throws if
+   *  v >= numVariables(). */
+  std::vector<double> reductions(unsigned v, const SqlFileReduction& reduction) const;
+
+  /** Returns the values of variable v in run, empty if values were not kept or the run did not report
+   *  it. Throws if run >= numRuns() or v >= numVariables(). */
+  const std::vector<double>& values(unsigned run, unsigned v) const;
+
+  /** Returns variable v in run as a TimeSeries, if values were kept and the run reported it. Throws if
+   *  run >= numRuns() or v >= numVariables(). */
+  boost::optional<TimeSeries> timeSeries(unsigned run, unsigned v) const;
+
+  //@}
+ private:
+  REGISTER_LOGGER("openstudio.sql.SqlFileCollection");
+
+  struct TimeAxis {
+    DateTime firstReportDateTime;
+    std::vector<long> secondsFromFirstReport;
+    boost::optional<Time> intervalLength;
+  };
+
+  struct Variable {
+    std::string envPeriod;
+    std::string reportingFrequency;
+    std::string name;
+    std::string keyValue;
+    std::string units;
+  };
+
+  struct Cell {
+    bool reported = false;
+    double sum = 0.0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    unsigned count = 0;
+    unsigned timeAxis = 0;
+    std::vector<double> values;
+  };
+
+  unsigned run(const std::function<void(unsigned, const SqlFileTimeSeriesBatch&)>& visitor);
+
+  void sortVariables();
+
+  const Cell& cell(unsigned run, unsigned v) const;
+
+  std::vector<openstudio::path> m_paths;
+  std::vector<SqlFileTimeSeriesQuery> m_queries;
+  unsigned m_numThreads;
+  double m_elapsedSeconds;
+  unsigned m_numProcessed;
+
+  std::vector<bool> m_processed;
+  std::vector<Variable> m_variables;
+  std::vector<TimeAxis> m_timeAxes;
+  // cells of run i are m_cells[i], indexed by variable
+  std::vector<std::vector<Cell>> m_cells;
+};
+
+} // openstudio
+
+#endif // UTILITIES_SQL_SQLFILECOLLECTION_HPP
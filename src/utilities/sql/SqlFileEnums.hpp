@@ -81,6 +81,37 @@ OPENSTUDIO_ENUM(EnvironmentType,
 
 typedef boost::optional<EnvironmentType> OptionalEnvironmentType;
 
+/** \class SqlFileOpenMode
+ *  \brief How a SqlFile opens its file.
+ *  \details ReadOnly never writes to the file and allows queries from several threads at once.
+ *  See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual
+ *  macro call is:
+ *  \code
+OPENSTUDIO_ENUM(SqlFileOpenMode,
+          ((ReadWrite))
+          ((ReadOnly)) );
+ *  \endcode */
+OPENSTUDIO_ENUM(SqlFileOpenMode,
+          ((ReadWrite))
+          ((ReadOnly)) );
+
+/** \class SqlFileReduction
+ *  \brief Reductions of a time series computed by SqlFileCollection.
+ *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual
+ *  macro call is:
+ *  \code
+OPENSTUDIO_ENUM(SqlFileReduction,
+          ((Sum))
+          ((Mean))
+          ((Minimum))
+          ((Maximum)) );
+ *  \endcode */
+OPENSTUDIO_ENUM(SqlFileReduction,
+          ((Sum))
+          ((Mean))
+          ((Minimum))
+          ((Maximum)) );
+
 } // openstudio
 
 #endif // UTILITIES_SQL_SQLFILEENUMS_HPP
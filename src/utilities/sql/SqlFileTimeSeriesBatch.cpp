@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileTimeSeriesBatch.hpp"
+
+#include "../data/Vector.hpp"
+#include "../core/Compare.hpp"
+
+namespace openstudio {
+
+SqlFileTimeSeriesBatch::SqlFileTimeSeriesBatch()
+{}
+
+unsigned SqlFileTimeSeriesBatch::size() const {
+  return m_columns.size();
+}
+
+bool SqlFileTimeSeriesBatch::empty() const {
+  return m_columns.empty();
+}
+
+unsigned SqlFileTimeSeriesBatch::numTimeAxes() const {
+  return m_timeAxes.size();
+}
+
+std::string SqlFileTimeSeriesBatch::environmentPeriod(unsigned i) const {
+  return m_columns.at(i).envPeriod;
+}
+
+std::string SqlFileTimeSeriesBatch::reportingFrequency(unsigned i) const {
+  return m_columns.at(i).reportingFrequency;
+}
+
+std::string SqlFileTimeSeriesBatch::timeSeriesName(unsigned i) const {
+  return m_columns.at(i).name;
+}
+
+std::string SqlFileTimeSeriesBatch::keyValue(unsigned i) const {
+  return m_columns.at(i).keyValue;
+}
+
+std::string SqlFileTimeSeriesBatch::units(unsigned i) const {
+  return m_columns.at(i).units;
+}
+
+unsigned SqlFileTimeSeriesBatch::timeAxisIndex(unsigned i) const {
+  return m_columns.at(i).timeAxis;
+}
+
+const std::vector<double>& SqlFileTimeSeriesBatch::values(unsigned i) const {
+  return m_columns.at(i).values;
+}
+
+DateTime SqlFileTimeSeriesBatch::firstReportDateTime(unsigned t) const {
+  return m_timeAxes.at(t).firstReportDateTime;
+}
+
+const std::vector<long>& SqlFileTimeSeriesBatch::secondsFromFirstReport(unsigned t) const {
+  return m_timeAxes.at(t).secondsFromFirstReport;
+}
+
+boost::optional<Time> SqlFileTimeSeriesBatch::intervalLength(unsigned t) const {
+  const TimeAxis& timeAxis = m_timeAxes.at(t);
+  if (timeAxis.intervalMinutes) {
+    return Time(0, 0, *timeAxis.intervalMinutes, 0);
+  }
+  return boost::none;
+}
+
+boost::optional<unsigned> SqlFileTimeSeriesBatch::find(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                       const std::string& timeSeriesName, const std::string& keyValue) const
+{
+  for (unsigned i = 0, n = m_columns.size(); i < n; ++i) {
+    const Column& column = m_columns[i];
+    if ((column.name == timeSeriesName) && (column.reportingFrequency == reportingFrequency) &&
+        istringEqual(column.keyValue, keyValue) && istringEqual(column.envPeriod, envPeriod))
+    {
+      return i;
+    }
+  }
+  return boost::none;
+}
+
+TimeSeries SqlFileTimeSeriesBatch::timeSeries(unsigned i) const {
+  const Column& column = m_columns.at(i);
+  return makeTimeSeries(m_timeAxes[column.timeAxis], column.values, column.units);
+}
+
+std::vector<TimeSeries> SqlFileTimeSeriesBatch::timeSeries() const {
+  std::vector<TimeSeries> result;
+  result.reserve(m_columns.size());
+  for (const Column& column : m_columns) {
+    result.push_back(makeTimeSeries(m_timeAxes[column.timeAxis], column.values, column.units));
+  }
+  return result;
+}
+
+TimeSeries SqlFileTimeSeriesBatch::makeTimeSeries(const TimeAxis& timeAxis, const std::vector<double>& values, const std::string& units)
+{
+  if (timeAxis.intervalMinutes) {
+    return TimeSeries(timeAxis.firstReportDateTime, Time(0, 0, *timeAxis.intervalMinutes, 0), createVector(values), units);
+  }
+  return TimeSeries(timeAxis.firstReportDateTime, timeAxis.secondsFromFirstReport, createVector(values), units);
+}
+
+} // openstudio
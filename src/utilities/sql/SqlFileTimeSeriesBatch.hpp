@@ -0,0 +1,143 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESBATCH_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESBATCH_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../time/DateTime.hpp"
+#include "../data/TimeSeries.hpp"
+
+#include <boost/optional.hpp>
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+// forward declarations
+namespace detail {
+  class SqlFile_Impl;
+}
+
+/** Columnar container for the time series returned by SqlFile::timeSeriesBatch. Each time series is
+ *  stored as a column of values along with the environment period, reporting frequency, name, key
+ *  value and units that identify it. Time series reported at the same times for the same environment
+ *  period and reporting frequency share one time axis, which is only built and stored once. */
+class UTILITIES_API SqlFileTimeSeriesBatch {
+ public:
+
+  /** @name Constructors */
+  //@{
+
+  SqlFileTimeSeriesBatch();
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  /** Returns the number of time series. */
+  unsigned size() const;
+
+  bool empty() const;
+
+  /** Returns the number of distinct time axes shared by the time series. */
+  unsigned numTimeAxes() const;
+
+  /** Returns the environment period of time series i. Throws if i >= size(). */
+  std::string environmentPeriod(unsigned i) const;
+
+  /** Returns the reporting frequency of time series i, as stored in the SqlFile. Throws if i >= size(). */
+  std::string reportingFrequency(unsigned i) const;
+
+  /** Returns the name of time series i. Throws if i >= size(). */
+  std::string timeSeriesName(unsigned i) const;
+
+  /** Returns the key value of time series i. Throws if i >= size(). */
+  std::string keyValue(unsigned i) const;
+
+  /** Returns the units of time series i. Throws if i >= size(). */
+  std::string units(unsigned i) const;
+
+  /** Returns the index of the time axis of time series i. Throws if i >= size(). */
+  unsigned timeAxisIndex(unsigned i) const;
+
+  /** Returns the values of time series i. Throws if i >= size(). */
+  const std::vector<double>& values(unsigned i) const;
+
+  /** Returns the first report date and time of time axis t. Throws if t >= numTimeAxes(). */
+  DateTime firstReportDateTime(unsigned t) const;
+
+  /** Returns the seconds from the first report of each value on time axis t. Throws if t >= numTimeAxes(). */
+  const std::vector<long>& secondsFromFirstReport(unsigned t) const;
+
+  /** Returns the interval between reports on time axis t, if they are evenly spaced. Throws if t >= numTimeAxes(). */
+  boost::optional<Time> intervalLength(unsigned t) const;
+
+  /** Returns the index of the time series with the given environment period, reporting frequency, name and
+   *  key value, if there is one. Environment period and key value are compared case insensitively. */
+  boost::optional<unsigned> find(const std::string& envPeriod, const std::string& reportingFrequency,
+                                 const std::string& timeSeriesName, const std::string& keyValue) const;
+
+  /** Returns time series i as a TimeSeries. Throws if i >= size(). */
+  TimeSeries timeSeries(unsigned i) const;
+
+  /** Returns all the time series as TimeSeries, in order. */
+  std::vector<TimeSeries> timeSeries() const;
+
+  //@}
+ private:
+  friend class detail::SqlFile_Impl;
+
+  struct TimeAxis {
+    DateTime firstReportDateTime;
+    std::vector<long> secondsFromFirstReport;
+    boost::optional<unsigned> intervalMinutes;
+  };
+
+  struct Column {
+    std::string envPeriod;
+    std::string reportingFrequency;
+    std::string name;
+    std::string keyValue;
+    std::string units;
+    unsigned timeAxis;
+    std::vector<double> values;
+  };
+
+  static TimeSeries makeTimeSeries(const TimeAxis& timeAxis, const std::vector<double>& values, const std::string& units);
+
+  std::vector<TimeAxis> m_timeAxes;
+  std::vector<Column> m_columns;
+};
+
+} // openstudio
+
+#endif // UTILITIES_SQL_SQLFILETIMESERIESBATCH_HPP
@@ -0,0 +1,92 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "SqlFileTimeSeriesCursor.hpp"
+#include "SqlFile_Impl.hpp"
+
+namespace openstudio {
+
+SqlFileTimeSeriesCursor::SqlFileTimeSeriesCursor()
+  : m_state(std::make_shared<State>())
+{
+  m_state->done = true;
+}
+
+unsigned SqlFileTimeSeriesCursor::numTimeSeries() const {
+  return m_state->columns.size();
+}
+
+std::string SqlFileTimeSeriesCursor::environmentPeriod(unsigned i) const {
+  return m_state->columns.at(i).envPeriod;
+}
+
+std::string SqlFileTimeSeriesCursor::reportingFrequency(unsigned i) const {
+  return m_state->columns.at(i).reportingFrequency;
+}
+
+std::string SqlFileTimeSeriesCursor::timeSeriesName(unsigned i) const {
+  return m_state->columns.at(i).name;
+}
+
+std::string SqlFileTimeSeriesCursor::keyValue(unsigned i) const {
+  return m_state->columns.at(i).keyValue;
+}
+
+std::string SqlFileTimeSeriesCursor::units(unsigned i) const {
+  return m_state->columns.at(i).units;
+}
+
+unsigned SqlFileTimeSeriesCursor::blockSize() const {
+  return m_state->blockSize;
+}
+
+bool SqlFileTimeSeriesCursor::next() {
+  if (!m_state->sqlFile) {
+    return false;
+  }
+  return m_state->sqlFile->nextTimeSeriesBlock(*m_state);
+}
+
+unsigned SqlFileTimeSeriesCursor::size() const {
+  return m_state->dateTimes.size();
+}
+
+bool SqlFileTimeSeriesCursor::empty() const {
+  return m_state->dateTimes.empty();
+}
+
+const std::vector<DateTime>& SqlFileTimeSeriesCursor::dateTimes() const {
+  return m_state->dateTimes;
+}
+
+const std::vector<double>& SqlFileTimeSeriesCursor::values(unsigned i) const {
+  return m_state->columns.at(i).values;
+}
+
+} // openstudio
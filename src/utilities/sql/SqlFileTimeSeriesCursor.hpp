@@ -0,0 +1,164 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESCURSOR_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESCURSOR_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../time/DateTime.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct sqlite3_stmt;
+
+namespace openstudio {
+
+// forward declarations
+namespace detail {
+  class SqlFile_Impl;
+}
+
+/** Forward only cursor over time series of a SqlFile, returned by SqlFile::timeSeriesCursor. Values are
+ *  read in time order a block of at most blockSize() time steps at a time, so that reductions and exports of
+ *  timestep results run in constant memory however many time steps there are. A time step is a row of the
+ *  Time table at which at least one of the time series is reported, time series that are not reported at a
+ *  time step have the value NaN there.
+ *
+ *  The cursor keeps its SqlFile open and must be used from the thread that created it. Copies share the
+ *  same position. For example, to export time series to a CSV file:
+ *  \code
+SqlFileTimeSeriesCursor cursor = sqlFile.timeSeriesCursor(queries);
+std::ofstream csv(path);
+csv << "Date/Time";
+for (unsigned i = 0; i < cursor.numTimeSeries(); ++i) {
+  csv << "," << cursor.keyValue(i) << ":" << cursor.timeSeriesName(i) << " [" << cursor.units(i) << "]";
+}
+csv << std::endl;
+while (cursor.next()) {
+  for (unsigned j = 0; j < cursor.size(); ++j) {
+    csv << cursor.dateTimes()[j];
+    for (unsigned i = 0; i < cursor.numTimeSeries(); ++i) {
+      csv << "," << cursor.values(i)[j];
+    }
+    csv << std::endl;
+  }
+}
+ *  \endcode */
+class UTILITIES_API SqlFileTimeSeriesCursor {
+ public:
+  /** @name Constructors */
+  //@{
+
+  /** Constructs a cursor over no time series. */
+  SqlFileTimeSeriesCursor();
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  /** Returns the number of time series. */
+  unsigned numTimeSeries() const;
+
+  /** Returns the environment period of time series i. Throws if i >= numTimeSeries(). */
+  std::string environmentPeriod(unsigned i) const;
+
+  /** Returns the reporting frequency of time series i, as stored in the SqlFile. Throws if i >= numTimeSeries(). */
+  std::string reportingFrequency(unsigned i) const;
+
+  /** Returns the name of time series i. Throws if i >= numTimeSeries(). */
+  std::string timeSeriesName(unsigned i) const;
+
+  /** Returns the key value of time series i. Throws if i >= numTimeSeries(). */
+  std::string keyValue(unsigned i) const;
+
+  /** Returns the units of time series i. Throws if i >= numTimeSeries(). */
+  std::string units(unsigned i) const;
+
+  /** Returns the maximum number of time steps in a block. */
+  unsigned blockSize() const;
+
+  //@}
+  /** @name Iteration */
+  //@{
+
+  /** Reads the next block of time steps, returns false once every time step has been read. */
+  bool next();
+
+  /** Returns the number of time steps in the current block. */
+  unsigned size() const;
+
+  bool empty() const;
+
+  /** Returns the date and time of each time step in the current block, at the end of its reporting interval. */
+  const std::vector<DateTime>& dateTimes() const;
+
+  /** Returns the values of time series i at each time step in the current block. Throws if i >= numTimeSeries(). */
+  const std::vector<double>& values(unsigned i) const;
+
+  //@}
+ private:
+  friend class detail::SqlFile_Impl;
+
+  struct Column {
+    std::string envPeriod;
+    std::string reportingFrequency;
+    std::string name;
+    std::string keyValue;
+    std::string units;
+    int envPeriodIndex;
+    std::vector<double> values;
+  };
+
+  // shared by copies of a cursor
+  struct State {
+    std::shared_ptr<detail::SqlFile_Impl> sqlFile;
+    std::shared_ptr<sqlite3_stmt> statement;
+    unsigned blockSize = 0;
+    std::vector<Column> columns;
+    // columns of each data table and record index, at 2 * record index + table, looked up for every row read
+    std::vector<std::vector<unsigned> > recordColumns;
+    std::vector<DateTime> dateTimes;
+    // the row last read starts a time step that did not fit in the previous block
+    bool pending = false;
+    bool done = false;
+    // time step of the row last read
+    int timeIndex = -1;
+    int envPeriodIndex = -1;
+    DateTime dateTime;
+  };
+
+  std::shared_ptr<State> m_state;
+};
+
+} // openstudio
+
+#endif // UTILITIES_SQL_SQLFILETIMESERIESCURSOR_HPP
@@ -29,6 +29,7 @@
 
 #include "SqlFile_Impl.hpp"
 #include "SqlFileTimeSeriesQuery.hpp"
+#include "ColumnarResults.hpp"
 #include "PreparedStatement.hpp"
 #include "OpenStudio.hxx"
 
@@ -39,6 +40,13 @@
 
 #include <sqlite3.h>
 
+#include <boost/algorithm/string/join.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <set>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -56,19 +64,52 @@ namespace openstudio{
       return std::string(reinterpret_cast<const char*>(column));
     }
 
+    // statements creating the indexes added by createIndexes
+    const std::vector<std::string>& indexStatements()
+    {
+      static const std::vector<std::string> result{
+        "CREATE INDEX IF NOT EXISTS rddMTR ON ReportDataDictionary (IsMeter);",
+        "CREATE INDEX IF NOT EXISTS redRD ON ReportExtendedData (ReportDataIndex);",
+        "CREATE INDEX IF NOT EXISTS rdTI ON ReportData (TimeIndex ASC);",
+        "CREATE INDEX IF NOT EXISTS rdDI ON ReportData (ReportDataDictionaryIndex ASC);",
+        "CREATE INDEX IF NOT EXISTS dmhdHRI ON DaylightMapHourlyData (HourlyReportIndex ASC);",
+        "CREATE INDEX IF NOT EXISTS dmhrMNI ON DaylightMapHourlyReports (MapNumber);"
+      };
+      return result;
+    }
+
+    // record indices come from the data dictionary, they are written as literals so that any number of them fit in one statement
+    std::string recordList(const std::set<int>& records)
+    {
+      std::stringstream s;
+      for (auto it = records.begin(); it != records.end(); ++it) {
+        if (it != records.begin()) {
+          s << ",";
+        }
+        s << *it;
+      }
+      return s.str();
+    }
+
     SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true), m_hasIlluminanceMapYear(true)
+      : SqlFile_Impl(path, SqlFileOpenMode::ReadWrite, createIndexes)
+    {
+    }
+
+    SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const SqlFileOpenMode& openMode, const bool createIndexes)
+      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_hasYear(true), m_hasIlluminanceMapYear(true),
+        m_readOnly(openMode == SqlFileOpenMode::ReadOnly), m_useIndexedCopy(m_readOnly && createIndexes)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
       }
       reopen();
-      if (createIndexes) this->createIndexes();
+      if (createIndexes && !m_readOnly) this->createIndexes();
     }
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
         const openstudio::Calendar &t_calendar, const bool createIndexes)
-      : m_path(t_path)
+      : m_path(t_path), m_readOnly(false), m_useIndexedCopy(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -148,6 +189,11 @@ namespace openstudio{
 
     void SqlFile_Impl::removeIndexes()
     {
+      if (m_readOnly) {
+        LOG(Warn, "Cannot remove indexes from '" << m_sqliteFilename << "', it is opened read only");
+        return;
+      }
+
       if (m_connectionOpen)
       {
         try {
@@ -190,42 +236,19 @@ namespace openstudio{
 
     void SqlFile_Impl::createIndexes()
     {
+      if (m_readOnly) {
+        LOG(Warn, "Cannot add indexes to '" << m_sqliteFilename << "', it is opened read only");
+        return;
+      }
+
       if (m_connectionOpen)
       {
-        try {
-          execAndThrowOnError("CREATE INDEX IF NOT EXISTS rddMTR ON ReportDataDictionary (IsMeter);");
-        } catch (const std::runtime_error &e) {
-          LOG(Trace, "Error adding index: " + std::string(e.what()));
-        }
-
-        try {
-          execAndThrowOnError("CREATE INDEX IF NOT EXISTS redRD ON ReportExtendedData (ReportDataIndex);");
-        } catch (const std::runtime_error &e) {
-          LOG(Trace, "Error adding index: " + std::string(e.what()));
-        }
-
-        try {
-          execAndThrowOnError("CREATE INDEX IF NOT EXISTS rdTI ON ReportData (TimeIndex ASC);");
-        } catch (const std::runtime_error &e) {
-          LOG(Trace, "Error adding index: " + std::string(e.what()));
-        }
-
-        try {
-          execAndThrowOnError("CREATE INDEX IF NOT EXISTS rdDI ON ReportData (ReportDataDictionaryIndex ASC);");
-        } catch (const std::runtime_error &e) {
-          LOG(Trace, "Error adding index: " + std::string(e.what()));
-        }
-
-        try {
-          execAndThrowOnError("CREATE INDEX IF NOT EXISTS dmhdHRI ON DaylightMapHourlyData (HourlyReportIndex ASC);");
-        } catch (const std::runtime_error &e) {
-          LOG(Trace, "Error adding index: " + std::string(e.what()));
-        }
-
-        try {
-          execAndThrowOnError("CREATE INDEX IF NOT EXISTS dmhrMNI ON DaylightMapHourlyReports (MapNumber);");
-        } catch (const std::runtime_error &e) {
-          LOG(Trace, "Error adding index: " + std::string(e.what()));
+        for (const std::string& statement : indexStatements()) {
+          try {
+            execAndThrowOnError(statement);
+          } catch (const std::runtime_error &e) {
+            LOG(Trace, "Error adding index: " + std::string(e.what()));
+          }
         }
       }
     }
@@ -237,6 +260,7 @@ namespace openstudio{
 
     void SqlFile_Impl::execAndThrowOnError(const std::string &t_stmt)
     {
+      m_tabularData.reset();
       char *err = nullptr;
       if (sqlite3_exec(m_db, t_stmt.c_str(), nullptr, nullptr, &err) != SQLITE_OK)
       {
@@ -361,16 +385,230 @@ namespace openstudio{
       return m_path;
     }
 
+    SqlFileOpenMode SqlFile_Impl::openMode() const
+    {
+      return m_readOnly ? SqlFileOpenMode::ReadOnly : SqlFileOpenMode::ReadWrite;
+    }
+
     bool SqlFile_Impl::close()
     {
       if (m_connectionOpen)
       {
-        sqlite3_close(m_db);
+        clearStatementCache();
+        // a cursor still holding a statement keeps the connection until it is done with it
+        sqlite3_close_v2(m_db);
         m_connectionOpen = false;
       }
+
+      for (auto& reader : m_readerConnections) {
+        for (auto& cached : reader.second.statements) {
+          for (sqlite3_stmt* stmt : cached.second) {
+            sqlite3_finalize(stmt);
+          }
+        }
+        sqlite3_close_v2(reader.second.db);
+      }
+      m_readerConnections.clear();
+
+      if (!m_copyPath.empty()) {
+        boost::system::error_code ec;
+        openstudio::filesystem::remove(m_copyPath, ec);
+        m_copyPath.clear();
+      }
+
+      m_tabularData.reset();
       return true;
     }
 
+    SqlFile_Impl::ReaderConnection& SqlFile_Impl::readerConnection() const
+    {
+      std::lock_guard<std::mutex> lock(m_readerConnectionsMutex);
+      ReaderConnection& result = m_readerConnections[std::this_thread::get_id()];
+      if (!result.db && m_connectionOpen) {
+        result.db = openConnection();
+      }
+      return result;
+    }
+
+    sqlite3* SqlFile_Impl::connection() const
+    {
+      if (m_readOnly && (std::this_thread::get_id() != m_ownerThread)) {
+        return readerConnection().db;
+      }
+      return m_db;
+    }
+
+    sqlite3* SqlFile_Impl::openConnection() const
+    {
+      sqlite3* result = nullptr;
+      // a read only connection is only ever used by one thread, so it needs no mutex of its own
+      int flags = m_readOnly ? (SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX) : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE);
+      int code = sqlite3_open_v2(m_databaseFilename.c_str(), &result, flags, nullptr);
+      if (code != SQLITE_OK) {
+        LOG(Error, "Could not open '" << m_databaseFilename << "', error code " << code);
+        sqlite3_close(result);
+        return nullptr;
+      }
+
+      // set a 1 second timeout
+      sqlite3_busy_timeout(result, 1000);
+
+      if (m_readOnly) {
+        // connections do not share a page cache, a shared cache would serialize them on its lock,
+        // so map the file instead and let them all read the same pages of the OS cache
+        sqlite3_exec(result, "PRAGMA mmap_size=1073741824; PRAGMA query_only=1;", nullptr, nullptr, nullptr);
+      }
+
+      return result;
+    }
+
+    openstudio::path SqlFile_Impl::createIndexedCopy() const
+    {
+      // an index has to live in the same database as its table, so the indexes go into a copy rather than next to the file
+      openstudio::path copyPath = openstudio::filesystem::temp_directory_path() / openstudio::filesystem::unique_path("openstudio-%%%%-%%%%-%%%%-%%%%.sql");
+
+      sqlite3* source = nullptr;
+      sqlite3* copy = nullptr;
+      bool ok = (sqlite3_open_v2(m_sqliteFilename.c_str(), &source, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK)
+             && (sqlite3_open_v2(toString(copyPath).c_str(), &copy, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) == SQLITE_OK);
+      if (ok) {
+        sqlite3_backup* backup = sqlite3_backup_init(copy, "main", source, "main");
+        ok = backup && (sqlite3_backup_step(backup, -1) == SQLITE_DONE);
+        ok = (sqlite3_backup_finish(backup) == SQLITE_OK) && ok;
+      }
+      if (ok) {
+        for (const std::string& statement : indexStatements()) {
+          char* err = nullptr;
+          if (sqlite3_exec(copy, statement.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
+            LOG(Trace, "Error adding index: " << (err ? err : statement));
+            sqlite3_free(err);
+          }
+        }
+      }
+      sqlite3_close(source);
+      sqlite3_close(copy);
+
+      if (!ok) {
+        boost::system::error_code ec;
+        openstudio::filesystem::remove(copyPath, ec);
+        throw openstudio::Exception("Could not copy '" + m_sqliteFilename + "' to '" + toString(copyPath) + "' for indexing");
+      }
+      return copyPath;
+    }
+
+    sqlite3_stmt* SqlFile_Impl::cachedStatement(const std::string& statement, bool throwOnError) const
+    {
+      ReaderConnection* reader = (m_readOnly && (std::this_thread::get_id() != m_ownerThread)) ? &readerConnection() : nullptr;
+      sqlite3* db = reader ? reader->db : m_db;
+      std::map<std::string, std::vector<sqlite3_stmt*> >& statementCache = reader ? reader->statements : m_statementCache;
+      if (!db) {
+        return nullptr;
+      }
+
+      // statements written with literal values rather than placeholders would otherwise grow the cache without bound
+      const size_t maxCachedStatements = 256;
+
+      auto it = statementCache.find(statement);
+      if (it != statementCache.end()) {
+        for (sqlite3_stmt* cached : it->second) {
+          if (!sqlite3_stmt_busy(cached)) {
+            return cached;
+          }
+        }
+      } else if (statementCache.size() >= maxCachedStatements) {
+        // drop every statement that is not in use
+        for (auto cacheIt = statementCache.begin(); cacheIt != statementCache.end(); ) {
+          std::vector<sqlite3_stmt*>& statements = cacheIt->second;
+          auto busyEnd = std::partition(statements.begin(), statements.end(), [](sqlite3_stmt* t_stmt) { return sqlite3_stmt_busy(t_stmt) != 0; });
+          for (auto stmtIt = busyEnd; stmtIt != statements.end(); ++stmtIt) {
+            sqlite3_finalize(*stmtIt);
+          }
+          statements.erase(busyEnd, statements.end());
+          cacheIt = statements.empty() ? statementCache.erase(cacheIt) : std::next(cacheIt);
+        }
+      }
+
+      sqlite3_stmt* result = nullptr;
+      int code = sqlite3_prepare_v2(db, statement.c_str(), statement.size(), &result, nullptr);
+      if (!result) {
+        if (throwOnError) {
+          int extendedErrorCode = sqlite3_extended_errcode(db);
+          std::string errMsg = sqlite3_errmsg(db);
+          throw std::runtime_error("Error creating prepared statement: " + statement + " with error code " + std::to_string(code)
+              + ", extended code " + std::to_string(extendedErrorCode) + ", errmsg: " + errMsg);
+        }
+        LOG(Debug, "Could not prepare statement '" << statement << "', error code " << code);
+        return nullptr;
+      }
+      statementCache[statement].push_back(result);
+      return result;
+    }
+
+    void SqlFile_Impl::clearStatementCache()
+    {
+      for (auto& cached : m_statementCache) {
+        for (sqlite3_stmt* stmt : cached.second) {
+          sqlite3_finalize(stmt);
+        }
+      }
+      m_statementCache.clear();
+    }
+
+    const std::map<SqlFile_Impl::TabularDataKey, std::vector<SqlFile_Impl::TabularDataEntry> >& SqlFile_Impl::tabularData() const
+    {
+      std::lock_guard<std::mutex> lock(m_tabularDataMutex);
+      if (!m_tabularData) {
+        m_tabularData = std::map<TabularDataKey, std::vector<TabularDataEntry> >();
+        if (sqlite3_stmt* stmt = cachedStatement("SELECT ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value FROM TabularDataWithStrings")) {
+          PreparedStatement rows(stmt, connection());
+          auto text = [stmt](int i) {
+            const unsigned char* column = sqlite3_column_text(stmt, i);
+            return column ? std::string(reinterpret_cast<const char*>(column)) : std::string();
+          };
+          while (sqlite3_step(stmt) == SQLITE_ROW) {
+            std::string valueText = text(6);
+            double value = sqlite3_column_double(stmt, 6);
+            (*m_tabularData)[TabularDataKey(text(0), text(1), text(3))].push_back(TabularDataEntry{text(2), text(4), text(5), valueText, value});
+          }
+        }
+      }
+
+      return *m_tabularData;
+    }
+
+    const std::vector<SqlFile_Impl::TabularDataEntry>& SqlFile_Impl::tabularDataEntries(const std::string& reportName, const std::string& reportForString,
+                                                                                        const std::string& rowName) const
+    {
+      static const std::vector<TabularDataEntry> noEntries;
+      const auto& index = tabularData();
+      auto it = index.find(TabularDataKey(reportName, reportForString, rowName));
+      return it == index.end() ? noEntries : it->second;
+    }
+
+    boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                                           const std::string& rowName, const std::string& columnName, const std::string& units) const
+    {
+      for (const TabularDataEntry& entry : tabularDataEntries(reportName, reportForString, rowName)) {
+        if ((entry.tableName == tableName) && (entry.columnName == columnName) && (entry.units == units)) {
+          return entry.value;
+        }
+      }
+      return boost::none;
+    }
+
+    boost::optional<double> SqlFile_Impl::annualCostValue(const std::string& columnName) const
+    {
+      boost::optional<double> result = tabularDataValue("Economics Results Summary Report", "Entire Facility", "Annual Cost", "Cost", columnName, "~~$~~");
+      if (!result) {
+        for (const TabularDataEntry& entry : tabularDataEntries("Economics Results Summary Report", "Entire Facility", "Cost (~~$~~)")) {
+          if ((entry.tableName == "Annual Cost") && (entry.columnName == columnName)) {
+            return entry.value;
+          }
+        }
+      }
+      return result;
+    }
+
     bool SqlFile_Impl::reopen()
     {
       bool result = true;
@@ -388,19 +626,22 @@ namespace openstudio{
     void SqlFile_Impl::init()
     {
       m_sqliteFilename = toString(m_path.make_preferred().native());
-      std::string fileName = m_sqliteFilename;
+      m_databaseFilename = m_sqliteFilename;
+      m_ownerThread = std::this_thread::get_id();
 
-      int code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+      if (m_useIndexedCopy) {
+        m_copyPath = createIndexedCopy();
+        m_databaseFilename = toString(m_copyPath);
+      }
+
+      m_db = openConnection();
 
-      m_connectionOpen = (code == 0);
+      m_connectionOpen = (m_db != nullptr);
       if (m_connectionOpen) {// create index on dictionaryIndex for large table reportvariabledata
         if (!isValidConnection()) {
-          sqlite3_close(m_db);
-          m_connectionOpen = false;
+          close();
           throw openstudio::Exception("OpenStudio is not compatible with this file.");
         }
-        // set a 1 second timeout
-        code = sqlite3_busy_timeout(m_db, 1000);
 
         // set locking mode to exclusive
         //code = sqlite3_exec(m_db, "PRAGMA locking_mode=EXCLUSIVE", NULL, NULL, NULL);
@@ -408,6 +649,7 @@ namespace openstudio{
         // retrieve DataDictionaryTable
         retrieveDataDictionary();
       } else {
+        close();
         throw openstudio::Exception("File not successfully opened.");
       }
     }
@@ -710,7 +952,7 @@ namespace openstudio{
           "  and VariableType='Sum' "
           "  group by VariableName, ReportingFrequency, VariableUnits";
 
-        sqlite3_prepare_v2(m_db,stmt.c_str(),-1,&sqlStmtPtr,nullptr);
+        sqlite3_prepare_v2(connection(),stmt.c_str(),-1,&sqlStmtPtr,nullptr);
         while(sqlite3_step(sqlStmtPtr) == SQLITE_ROW)
         {
           double value = sqlite3_column_double(sqlStmtPtr, 0);
@@ -853,14 +1095,13 @@ namespace openstudio{
       const std::string rowName = t_monthOfYear.valueDescription();
 
 
-      const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName=?
-                                  AND ReportForString='Meter'
-                                  AND RowName=?
-                                  AND ColumnName=?
-                                  AND Units='J')";
-
-      return execAndReturnFirstDouble(s, reportName, rowName, columnName);
+      // the table name of the monthly meter reports is not fixed, so any table will do
+      for (const TabularDataEntry& entry : tabularDataEntries(reportName, "Meter", rowName)) {
+        if ((entry.columnName == columnName) && (entry.units == "J")) {
+          return entry.value;
+        }
+      }
+      return boost::none;
     }
 
     boost::optional<double> SqlFile_Impl::peakEnergyDemandByMonth(
@@ -874,28 +1115,23 @@ namespace openstudio{
         " {AT MAX/MIN}";
       const std::string rowName = t_monthOfYear.valueDescription();
 
-      const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName=?
-                                  AND ReportForString='Meter'
-                                  AND RowName=?
-                                  AND ColumnName=?
-                                  AND Units='W')";
-
-      return execAndReturnFirstDouble(s, reportName, rowName, columnName);
+      // the table name of the monthly meter reports is not fixed, so any table will do
+      for (const TabularDataEntry& entry : tabularDataEntries(reportName, "Meter", rowName)) {
+        if ((entry.columnName == columnName) && (entry.units == "W")) {
+          return entry.value;
+        }
+      }
+      return boost::none;
     }
 
     /// hours simulated
     boost::optional<double> SqlFile_Impl::hoursSimulated() const
     {
-      const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='InputVerificationandResultsSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='General'
-                                  AND RowName='Hours Simulated'
-                                  AND Units='hrs')";
-      boost::optional<double> ret = execAndReturnFirstDouble(s);
-
-      if (ret) return ret;
+      for (const TabularDataEntry& entry : tabularDataEntries("InputVerificationandResultsSummary", "Entire Facility", "Hours Simulated")) {
+        if ((entry.tableName == "General") && (entry.units == "hrs")) {
+          return entry.value;
+        }
+      }
 
       // Otherwise, let's try to calculate it:
       return execAndReturnFirstDouble(
@@ -916,14 +1152,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
       }
 
-      std::string s = R"(SELECT Value FROM TabularDataWithStrings
-                           WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                           AND ReportForString='Entire Facility'
-                           AND TableName='Site and Source Energy'
-                           AND RowName='Net Site Energy'
-                           AND ColumnName='Total Energy'
-                           AND Units='GJ')";
-      boost::optional<double> d = execAndReturnFirstDouble(s);
+      boost::optional<double> d = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
 
       if (!d) {
         LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -947,14 +1176,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Net Source Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-          return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Source Energy", "Total Energy", "GJ");
     }
 
 
@@ -967,14 +1189,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Total Site Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy", "GJ");
     }
 
 
@@ -987,37 +1202,41 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = R"(SELECT Value FROM TabularDataWithStrings
-                                  WHERE ReportName='AnnualBuildingUtilityPerformanceSummary'
-                                  AND ReportForString='Entire Facility'
-                                  AND TableName='Site and Source Energy'
-                                  AND RowName='Total Source Energy'
-                                  AND ColumnName='Total Energy'
-                                  AND Units='GJ')";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Source Energy", "Total Energy", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::annualTotalCost(const FuelType& fuel) const
     {
       if (fuel == FuelType::Electricity){
-        return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electricity') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("Electricity");
       }
       else if (fuel == FuelType::Gas){
-        return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Natural Gas') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("Natural Gas");
       }
       else {
         // E+ lumps all other fuel types under "Other," so we are forced to use the meters table instead.
         // This is fragile if there are custom submeters, but this is the only option
         std::string meterName = boost::to_upper_copy(fuel.valueDescription()) + ":FACILITY";
 
-        auto rowName = execAndReturnFirstString("SELECT RowName FROM TabularDataWithStrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND Value='" + meterName + "'");
-        if (rowName){
-          return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND RowName='" + rowName.get() + "' AND ColumnName='Annual Cost (~~$~~)'");
-        }
-        else {
-          return boost::none; // Return an empty optional double, indicating that there is no annual cost for this energy type
+        // find the tariff row reporting on that meter, rows of the index are visited in order of RowName
+        const auto& index = tabularData();
+        for (auto it = index.lower_bound(TabularDataKey("Economics Results Summary Report", "Entire Facility", std::string()));
+             (it != index.end()) && (std::get<0>(it->first) == "Economics Results Summary Report") && (std::get<1>(it->first) == "Entire Facility");
+             ++it)
+        {
+          for (const TabularDataEntry& entry : it->second) {
+            if ((entry.tableName == "Tariff Summary") && (entry.text == meterName)) {
+              for (const TabularDataEntry& cost : it->second) {
+                if ((cost.tableName == "Tariff Summary") && (cost.columnName == "Annual Cost (~~$~~)")) {
+                  return cost.value;
+                }
+              }
+              return boost::none;
+            }
+          }
         }
+        return boost::none; // Return an empty optional double, indicating that there is no annual cost for this energy type
 
       }
 
@@ -1027,7 +1246,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Total Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Total Building Area", "Area", "m2");
 
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1045,7 +1264,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Net Conditioned Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Net Conditioned Building Area", "Area", "m2");
 
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1171,7 +1390,7 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::economicsEnergyCost() const
     {
-      return execAndReturnFirstDouble("SELECT * from TabularDataWithStrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Total') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+      return annualCostValue("Total");
     }
 
     OptionalDouble SqlFile_Impl::getElecOrGasUse(bool bGetGas) const
@@ -1219,10 +1438,12 @@ namespace openstudio{
       }
       if(name.size() == 0) return result;
 
-      query = "SELECT value from TabularDataWithStrings where ReportName = 'Tariff Report' and ReportForString = '";
-      query += name;
-      query +=  "' and TableName = 'Native Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
-      result = execAndReturnFirstDouble(query);
+      for (const TabularDataEntry& entry : tabularDataEntries("Tariff Report", name, "TotalEnergy")) {
+        if ((entry.tableName == "Native Variables") && (entry.columnName == "Sum")) {
+          result = entry.value;
+          break;
+        }
+      }
 
       return result;
     }
@@ -1252,10 +1473,8 @@ namespace openstudio{
         std::string units = result.getUnitsForFuelType(fuelType);
         for (EndUseCategoryType category : result.categories()){
 
-          std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='" + \
-                               fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-          boost::optional<double> value = execAndReturnFirstDouble(query);
+          boost::optional<double> value = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses",
+              category.valueDescription(), fuelType.valueDescription(), units);
           OS_ASSERT(value);
 
           if (*value != 0.0){
@@ -1271,464 +1490,464 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::electricityHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Natural Gas", "GJ");
     }
     OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Natural Gas", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::naturalGasHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::waterHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Heating') AND (Units = 'hr')");
+      return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Heating", "hr");
     }
 
     OptionalDouble SqlFile_Impl::hoursCoolingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Cooling') AND (Units = 'hr')");
+      return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Cooling", "hr");
     }
 
 
@@ -1814,13 +2033,12 @@ namespace openstudio{
       {
         s << " WHERE ReportVariableDataDictionaryIndex=";
       }
-      s << boost::lexical_cast<std::string>(iEpRfNKv->recordIndex);
+      s << "?";
       //    s << " AND ep.EnvironmentName=";
       //    s << "'" << envPeriod << "'";
-      s << " AND t.EnvironmentPeriodIndex=";
-      s << boost::lexical_cast<std::string>(iEpRfNKv->envPeriodIndex);
+      s << " AND t.EnvironmentPeriodIndex=?";
 
-      return execAndReturnFirstDouble(s.str());
+      return execAndReturnFirstDouble(s.str(), iEpRfNKv->recordIndex, iEpRfNKv->envPeriodIndex);
     }
 
     std::vector<double> SqlFile_Impl::timeSeriesValues(const DataDictionaryItem& dataDictionary)
@@ -1843,19 +2061,17 @@ namespace openstudio{
         {
           s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
+        s << "?";
         //      s << " AND ep.EnvironmentName = ";
         //      s << "'" << dataDictionary.envPeriod << "'";
-        s << " AND ti.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+        s << " AND ti.EnvironmentPeriodIndex = ?";
         // assume that timeindices.timeIndex are ordered from start to end
         //      s << " ORDER BY ti.TimeIndex";
 
-        sqlite3_stmt* sqlStmtPtr;
+        PreparedStatement stmt(cachedStatement(s.str()), m_db, dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
-
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         std::stringstream s2;
         s2 << "SQL Query:" << std::endl;
         s2 << s.str();
@@ -1868,7 +2084,6 @@ namespace openstudio{
 
           code = sqlite3_step(sqlStmtPtr);
         }
-        sqlite3_finalize(sqlStmtPtr);
       }
 
       LOG(Debug, "Created Timeseries with " << stdValues.size() << " values");
@@ -1900,14 +2115,12 @@ namespace openstudio{
         {
           s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND ti.EnvironmentPeriodIndex=";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+        s << "? AND ti.EnvironmentPeriodIndex=?";
 
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        PreparedStatement stmt(cachedStatement(s.str()), m_db, dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           int b = 0;
@@ -1917,7 +2130,6 @@ namespace openstudio{
           month = sqlite3_column_int(sqlStmtPtr, b++);
           day = sqlite3_column_int(sqlStmtPtr, b++);
         }
-        sqlite3_finalize(sqlStmtPtr);
       }
       try {
         // DLM@20100707: RunPeriod timeseries return month=0, day=0.
@@ -1933,16 +2145,15 @@ namespace openstudio{
         std::stringstream s;
         s << "SELECT Month, Day, Hour from Time where TimeIndex in (";
         s << "SELECT min(timeIndex) FROM time )";
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        PreparedStatement stmt(cachedStatement(s.str()), m_db);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           month = sqlite3_column_int(sqlStmtPtr, 0);
           day = sqlite3_column_int(sqlStmtPtr, 1);
         }
-        sqlite3_finalize(sqlStmtPtr);
 
         // DLM: potential leap year problem
         return openstudio::Date(openstudio::monthOfYear(month), day);
@@ -1996,20 +2207,16 @@ namespace openstudio{
             {
               s << " WHERE rvd.ReportVariableDataDictionaryIndex=";
             }
-            s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-            s << " AND ti.EnvironmentPeriodIndex=";
-            s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-            s << ")";
+            s << "? AND ti.EnvironmentPeriodIndex=?)";
 
-            sqlite3_stmt* sqlStmtPtr;
-            int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+            PreparedStatement stmt(cachedStatement(s.str()), m_db, dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+            sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-            code = sqlite3_step(sqlStmtPtr);
+            int code = sqlite3_step(sqlStmtPtr);
             if (code == SQLITE_ROW)
             {
               minutes = sqlite3_column_double(sqlStmtPtr, 0);
             }
-            sqlite3_finalize(sqlStmtPtr);
           }
           // minutes - 1 to remove starting minute
           return boost::optional<openstudio::Time>(openstudio::Time(0,0,int(std::ceil(minutes-1.0)),0));
@@ -2034,13 +2241,12 @@ namespace openstudio{
         if (hasYear()) {
           s << "Year, ";
         }
-        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = "
-          << envPeriodIndex << " LIMIT 1";
+        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = ? LIMIT 1";
 
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        PreparedStatement stmt(cachedStatement(s.str()), m_db, envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           int b = 0;
@@ -2057,7 +2263,6 @@ namespace openstudio{
             minute = 0;
           }
         }
-        sqlite3_finalize(sqlStmtPtr);
 
       }
 
@@ -2085,13 +2290,12 @@ namespace openstudio{
         if (hasYear()) {
           s << "Year, ";
         }
-        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = "
-          << envPeriodIndex << " order by TimeIndex DESC LIMIT 1";
+        s << "Month, Day, Hour, Minute from Time where Month is not NULL and Day is not null and EnvironmentPeriodIndex = ? order by TimeIndex DESC LIMIT 1";
 
-        sqlite3_stmt* sqlStmtPtr;
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        PreparedStatement stmt(cachedStatement(s.str()), m_db, envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           int b = 0;
@@ -2108,7 +2312,6 @@ namespace openstudio{
             minute = 0;
           }
         }
-        sqlite3_finalize(sqlStmtPtr);
 
 
       }
@@ -2128,32 +2331,9 @@ namespace openstudio{
     openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary)
     {
       openstudio::OptionalTimeSeries ts;
-      std::string units = dataDictionary.units;
-
-      boost::optional<openstudio::DateTime> firstReportDateTime;
-      std::vector<long> stdSecondsFromFirstReport;
-      stdSecondsFromFirstReport.reserve(8760);
-
-      std::vector<double> stdValues;
-      stdValues.reserve(8760);
-      boost::optional<unsigned> reportingIntervalMinutes;
-
-      ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
-      bool isIntervalTimeSeries = false;
-      try {
-        reportingFrequency = ReportingFrequency(dataDictionary.reportingFrequency);
-        isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) ||
-                               (reportingFrequency == ReportingFrequency::Hourly) ||
-                               (reportingFrequency == ReportingFrequency::Daily);
-
-      }catch(const std::exception&){
-      }
 
       if (m_db)
       {
-        std::string energyPlusVersion = this->energyPlusVersion();
-        VersionString version(energyPlusVersion);
-
         std::stringstream s;
         // v8.9.0 added the 'Year' field
         s << "SELECT dt.VariableValue, ";
@@ -2174,15 +2354,12 @@ namespace openstudio{
         {
           s << " dt.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND Time.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
+        s << "? AND Time.EnvironmentPeriodIndex = ?";
 
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        PreparedStatement stmt(cachedStatement(s.str()), m_db, dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         std::stringstream s2;
         s2 << "SQL Query:" << std::endl;
         s2 << s.str();
@@ -2190,114 +2367,145 @@ namespace openstudio{
         s2 << code;
         LOG(Debug, s2.str());
 
-        long cumulativeSeconds = 0;
+        std::vector<double> stdValues;
+        stdValues.reserve(8760);
+        std::vector<ReportTime> times;
+        times.reserve(8760);
 
         while (code == SQLITE_ROW)
         {
           int b = 0;
-          double value = sqlite3_column_double(sqlStmtPtr, b++);
-          stdValues.push_back(value);
+          stdValues.push_back(sqlite3_column_double(sqlStmtPtr, b++));
 
-          boost::optional<unsigned> year;
+          ReportTime time;
           if (hasYear()) {
-            year = sqlite3_column_int(sqlStmtPtr, b++);
+            time.year = sqlite3_column_int(sqlStmtPtr, b++);
           }
+          time.month = sqlite3_column_int(sqlStmtPtr, b++);
+          time.day = sqlite3_column_int(sqlStmtPtr, b++);
+          time.interval = sqlite3_column_int(sqlStmtPtr, b++);
+          times.push_back(time);
 
-          unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
-          unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
+          // step to next row
+          code = sqlite3_step(sqlStmtPtr);
+        }
 
-          // In cases where you report the same meter key for eg at Daily and at Timestep frequency
-          // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
-          // And since we can compute this easily, might as well do it
-          unsigned intervalMinutes;
-          if (reportingFrequency == ReportingFrequency::Hourly) {
-            intervalMinutes = 60;
-          } else if (reportingFrequency == ReportingFrequency::Daily) {
-            intervalMinutes = 24 * 60;
-          } else if (reportingFrequency == ReportingFrequency::Monthly) {
-            intervalMinutes = day * 24 * 60;
-          } else {
-            // If Detailed, Timestep, RunPeriod, or Annual: it varies
-            intervalMinutes = sqlite3_column_int(sqlStmtPtr, b); // Notice I'm not incrementing the counter here on purpose
-
-            if (reportingFrequency == ReportingFrequency::Annual) {
-              // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
-              // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
-              // cf https://github.com/NREL/EnergyPlus/issues/7939
-              if (intervalMinutes == 0) {
-                intervalMinutes = 365*24*60;
-              } else if ((intervalMinutes != 365*24*60) && (intervalMinutes != 366*24*60)) {
-                // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
-                LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
-              }
-            }
-          }
-          // Don't forget to increment the counter anyway, no matter whether we did call sqlite3_column_int or not
-          ++b;
+        boost::optional<SqlFileTimeSeriesBatch::TimeAxis> axis = timeAxis(times, dataDictionary.reportingFrequency, dataDictionary.envPeriodIndex);
+        if (axis) {
+          ts = SqlFileTimeSeriesBatch::makeTimeSeries(*axis, stdValues, dataDictionary.units);
+        }
+      }
 
-          if ((version.major() == 8) && (version.minor() == 3)){
-            // workaround for bug in E+ 8.3, issue #1692
-            if (reportingFrequency == ReportingFrequency::RunPeriod){
-              DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-              DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
-              Time deltaT = lastDateTime - firstDateTime;
-              intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
-            }
-          }
+      return ts;
+    }
 
-          if (!firstReportDateTime){
-            if ((month==0) || (day==0)){
-              // gets called for RunPeriod reports
-              firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
-            } else{
-              // DLM: get standard time zone?
-              if (intervalMinutes >= 24 * 60){
-                // Daily or Monthly
-                OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-                firstReportDateTime = year
-                  ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
-                  : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
-              } else {
-                firstReportDateTime = year
-                  ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
-                  : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
-              }
+    boost::optional<SqlFileTimeSeriesBatch::TimeAxis> SqlFile_Impl::timeAxis(const std::vector<ReportTime>& times, const std::string& reportingFrequencyName, int envPeriodIndex)
+    {
+      if (times.empty()) {
+        return boost::none;
+      }
 
-            }
-          }
+      ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
+      bool isIntervalTimeSeries = false;
+      try {
+        reportingFrequency = ReportingFrequency(reportingFrequencyName);
+        isIntervalTimeSeries = (reportingFrequency == ReportingFrequency::Timestep) ||
+                               (reportingFrequency == ReportingFrequency::Hourly) ||
+                               (reportingFrequency == ReportingFrequency::Daily);
 
-          // Use the new way to create the time series with nonzero first entry
-          cumulativeSeconds += 60*intervalMinutes;
-          stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+      }catch(const std::exception&){
+      }
+
+      boost::optional<unsigned> runPeriodMinutes;
+      VersionString version(energyPlusVersion());
+      if ((version.major() == 8) && (version.minor() == 3)){
+        // workaround for bug in E+ 8.3, issue #1692
+        if (reportingFrequency == ReportingFrequency::RunPeriod){
+          DateTime firstDateTime = this->firstDateTime(false, envPeriodIndex);
+          DateTime lastDateTime = this->lastDateTime(false, envPeriodIndex);
+          Time deltaT = lastDateTime - firstDateTime;
+          runPeriodMinutes = (unsigned)deltaT.totalMinutes() + 60;
+        }
+      }
 
-          // check if this interval is same as the others
-          if (isIntervalTimeSeries && !reportingIntervalMinutes){
-            reportingIntervalMinutes = intervalMinutes;
-          }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
-            isIntervalTimeSeries = false;
-            reportingIntervalMinutes.reset();
+      boost::optional<openstudio::DateTime> firstReportDateTime;
+      std::vector<long> stdSecondsFromFirstReport;
+      stdSecondsFromFirstReport.reserve(times.size());
+      boost::optional<unsigned> reportingIntervalMinutes;
+      long cumulativeSeconds = 0;
+
+      for (const ReportTime& time : times)
+      {
+        // In cases where you report the same meter key for eg at Daily and at Timestep frequency
+        // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
+        // And since we can compute this easily, might as well do it
+        unsigned intervalMinutes;
+        if (reportingFrequency == ReportingFrequency::Hourly) {
+          intervalMinutes = 60;
+        } else if (reportingFrequency == ReportingFrequency::Daily) {
+          intervalMinutes = 24 * 60;
+        } else if (reportingFrequency == ReportingFrequency::Monthly) {
+          intervalMinutes = time.day * 24 * 60;
+        } else {
+          // If Detailed, Timestep, RunPeriod, or Annual: it varies
+          intervalMinutes = time.interval;
+
+          if (reportingFrequency == ReportingFrequency::Annual) {
+            // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
+            // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
+            // cf https://github.com/NREL/EnergyPlus/issues/7939
+            if (intervalMinutes == 0) {
+              intervalMinutes = 365*24*60;
+            } else if ((intervalMinutes != 365*24*60) && (intervalMinutes != 366*24*60)) {
+              // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
+              LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
+            }
           }
+        }
 
-          // step to next row
-          code = sqlite3_step(sqlStmtPtr);
+        if (runPeriodMinutes) {
+          intervalMinutes = *runPeriodMinutes;
         }
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+        if (!firstReportDateTime){
+          if ((time.month==0) || (time.day==0)){
+            // gets called for RunPeriod reports
+            firstReportDateTime = lastDateTime(false, envPeriodIndex);
+          } else{
+            // DLM: get standard time zone?
+            if (intervalMinutes >= 24 * 60){
+              // Daily or Monthly
+              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
+              firstReportDateTime = time.year
+                ? openstudio::DateTime(openstudio::Date(time.month, time.day, *time.year), openstudio::Time(1, 0, 0, 0))
+                : openstudio::DateTime(openstudio::Date(time.month, time.day), openstudio::Time(1, 0, 0, 0));
+            } else {
+              firstReportDateTime = time.year
+                ? openstudio::DateTime(openstudio::Date(time.month, time.day, *time.year), openstudio::Time(0, 0, intervalMinutes, 0))
+                : openstudio::DateTime(openstudio::Date(time.month, time.day), openstudio::Time(0, 0, intervalMinutes, 0));
+            }
 
-        if (firstReportDateTime && !stdSecondsFromFirstReport.empty()){
-          if (isIntervalTimeSeries){
-            openstudio::Time intervalTime(0,0,*reportingIntervalMinutes,0);
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
-          }else{
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
           }
         }
+
+        // Use the new way to create the time series with nonzero first entry
+        cumulativeSeconds += 60*intervalMinutes;
+        stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+
+        // check if this interval is same as the others
+        if (isIntervalTimeSeries && !reportingIntervalMinutes){
+          reportingIntervalMinutes = intervalMinutes;
+        }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
+          isIntervalTimeSeries = false;
+          reportingIntervalMinutes.reset();
+        }
       }
 
-      return ts;
+      SqlFileTimeSeriesBatch::TimeAxis result;
+      result.firstReportDateTime = *firstReportDateTime;
+      result.secondsFromFirstReport = std::move(stdSecondsFromFirstReport);
+      result.intervalMinutes = reportingIntervalMinutes;
+      return result;
     }
 
     openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary)
@@ -2322,15 +2530,12 @@ namespace openstudio{
         {
           s << " dt.ReportVariableDataDictionaryIndex=";
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND Time.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
-
-        sqlite3_stmt* sqlStmtPtr;
+        s << "? AND Time.EnvironmentPeriodIndex = ?";
 
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+        PreparedStatement stmt(cachedStatement(s.str()), m_db, dataDictionary.recordIndex, dataDictionary.envPeriodIndex);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         std::stringstream s2;
         s2 << "SQL Query:" << std::endl;
         s2 << s.str() << std::endl;
@@ -2360,8 +2565,6 @@ namespace openstudio{
           // step to next row
           code = sqlite3_step(sqlStmtPtr);
         }
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
       }
 
       return dateTimes;
@@ -2378,9 +2581,21 @@ namespace openstudio{
           "', keyValue = '" << keyValue << "'");
 
       openstudio::OptionalTimeSeries ts;
+      const DataDictionaryItem* ddi = nullptr;
       DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator iEpRfNKv = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesName, keyValue));
+      if (iEpRfNKv != m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().end()) {
+        ddi = &*iEpRfNKv;
+      }
+      std::pair<int, int> cacheKey = ddi ? std::make_pair(ddi->recordIndex, ddi->envPeriodIndex) : std::make_pair(0, 0);
+      if (ddi) {
+        std::lock_guard<std::mutex> lock(m_cachedTimeSeriesMutex);
+        auto cached = m_cachedTimeSeries.find(cacheKey);
+        if (cached != m_cachedTimeSeries.end()) {
+          ts = cached->second;
+        }
+      }
 
-      if (iEpRfNKv == m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().end()) {
+      if (!ddi) {
         // not found
         LOG(Debug,"Tuple: " << queryEnvPeriod << ", " << reportingFrequency << ", " << timeSeriesName << ", " << keyValue << " not found in data dictionary.");
 
@@ -2410,16 +2625,14 @@ namespace openstudio{
         }
 
 
-      } else if (!iEpRfNKv->timeSeries.values().empty()) {
-        ts = iEpRfNKv->timeSeries;
-      } else {// lazy caching
-        DataDictionaryItem ddi = *iEpRfNKv;
-        LOG(Debug, ddi.envPeriod);
-        LOG(Debug, ddi.name);
-        ts =  timeSeries(ddi);
+      } else if (!ts) {// lazy caching
+        LOG(Debug, ddi->envPeriod);
+        LOG(Debug, ddi->name);
+        // the query runs unlocked, threads reading the same series concurrently both cache an identical copy
+        ts =  timeSeries(*ddi);
         if (ts) {
-          ddi.timeSeries = *ts;
-          m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().replace(iEpRfNKv, ddi);
+          std::lock_guard<std::mutex> lock(m_cachedTimeSeriesMutex);
+          m_cachedTimeSeries[cacheKey] = *ts;
         }
       }
       if (ts) {
@@ -2697,6 +2910,470 @@ namespace openstudio{
       return result;
     }
 
+    std::vector<const DataDictionaryItem*> SqlFile_Impl::dataDictionaryItems(const SqlFileTimeSeriesQuery& query)
+    {
+      std::vector<const DataDictionaryItem*> result;
+
+      std::string envPeriod = boost::to_upper_copy(*(query.environment().get().name()));
+      std::string reportingFrequency = query.reportingFrequency()->valueDescription();
+      std::string tsName = *(query.timeSeries().get().name());
+
+      std::vector<std::string> reportingFrequencies(1, reportingFrequency);
+      if (istringEqual("Annual", reportingFrequency) || istringEqual("Environment", reportingFrequency)){
+        reportingFrequencies.push_back("Run Period");
+      }
+      openstudio::OptionalReportingFrequency freq = reportingFrequencyFromDB(reportingFrequency);
+      if (freq && (reportingFrequency != freq->valueDescription())){
+        reportingFrequencies.push_back(freq->valueDescription());
+      }
+
+      const auto& index = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+      for (const std::string& rf : reportingFrequencies) {
+        if (query.keyValues()) {
+          for (const std::string& kvName : query.keyValues().get().names()) {
+            auto it = index.find(boost::make_tuple(envPeriod, rf, tsName, kvName));
+            if (it == index.end()) {
+              it = index.find(boost::make_tuple(envPeriod, rf, tsName, boost::to_upper_copy(kvName)));
+            }
+            if (it != index.end()) {
+              result.push_back(&*it);
+            }
+          }
+        }
+        else {
+          auto range = index.equal_range(boost::make_tuple(envPeriod, rf, tsName));
+          for (auto it = range.first; it != range.second; ++it) {
+            result.push_back(&*it);
+          }
+        }
+        if (!result.empty()) {
+          break;
+        }
+      }
+
+      return result;
+    }
+
+    std::vector<const DataDictionaryItem*> SqlFile_Impl::dataDictionaryItems(const std::vector<SqlFileTimeSeriesQuery>& queries)
+    {
+      // resolve all queries to data dictionary items, keeping the first occurrence of each
+      std::vector<const DataDictionaryItem*> result;
+      std::set<std::pair<int, int> > seen;
+      for (const SqlFileTimeSeriesQuery& query : queries) {
+        for (const SqlFileTimeSeriesQuery& expanded : expandQuery(query)) {
+          for (const DataDictionaryItem* item : dataDictionaryItems(expanded)) {
+            if (seen.insert(std::make_pair(item->recordIndex, item->envPeriodIndex)).second) {
+              result.push_back(item);
+            }
+          }
+        }
+      }
+      return result;
+    }
+
+    bool SqlFile_Impl::hasReportData()
+    {
+      boost::optional<int> count = execAndReturnFirstInt("SELECT COUNT(*) FROM sqlite_master WHERE type='table' AND name='ReportData'");
+      return count && (*count > 0);
+    }
+
+    SqlFileTimeSeriesBatch SqlFile_Impl::timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+      SqlFileTimeSeriesBatch result;
+      if (!m_db) {
+        return result;
+      }
+
+      std::vector<const DataDictionaryItem*> items = dataDictionaryItems(queries);
+      if (items.empty()) {
+        return result;
+      }
+
+      // columns of each record index, by environment period, and record indices to read from each table
+      std::map<int, std::vector<std::pair<int, size_t> > > recordColumns;
+      std::map<std::string, std::set<int> > tableRecords;
+      std::set<int> envPeriodIndices;
+      std::vector<SqlFileTimeSeriesBatch::Column> columns(items.size());
+      for (size_t i = 0; i < items.size(); ++i) {
+        const DataDictionaryItem& item = *items[i];
+        columns[i].envPeriod = item.envPeriod;
+        columns[i].reportingFrequency = item.reportingFrequency;
+        columns[i].name = item.name;
+        columns[i].keyValue = item.keyValue;
+        columns[i].units = item.units;
+        recordColumns[item.recordIndex].push_back(std::make_pair(item.envPeriodIndex, i));
+        tableRecords[item.table].insert(item.recordIndex);
+        envPeriodIndices.insert(item.envPeriodIndex);
+      }
+
+      // read the Time table once, by TimeIndex
+      std::vector<ReportTime> times;
+      std::vector<int> timeEnvPeriods;
+      {
+        std::stringstream s;
+        s << "SELECT TimeIndex, EnvironmentPeriodIndex, ";
+        if (hasYear()) {
+          s << "Year, ";
+        }
+        s << "Month, Day, Interval FROM Time";
+
+        PreparedStatement stmt(cachedStatement(s.str()), m_db);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
+
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW)
+        {
+          int b = 0;
+          int timeIndex = sqlite3_column_int(sqlStmtPtr, b++);
+          int envPeriodIndex = sqlite3_column_int(sqlStmtPtr, b++);
+          if ((timeIndex < 0) || (envPeriodIndices.find(envPeriodIndex) == envPeriodIndices.end())) {
+            continue;
+          }
+          if (static_cast<size_t>(timeIndex) >= times.size()) {
+            times.resize(timeIndex + 1);
+            timeEnvPeriods.resize(timeIndex + 1, -1);
+          }
+          ReportTime& time = times[timeIndex];
+          if (hasYear()) {
+            time.year = sqlite3_column_int(sqlStmtPtr, b++);
+          }
+          time.month = sqlite3_column_int(sqlStmtPtr, b++);
+          time.day = sqlite3_column_int(sqlStmtPtr, b++);
+          time.interval = sqlite3_column_int(sqlStmtPtr, b++);
+          timeEnvPeriods[timeIndex] = envPeriodIndex;
+        }
+      }
+
+      // reported values, routed to the column of their record index and environment period
+      std::vector<const std::vector<std::pair<int, size_t> >*> columnsByRecord(recordColumns.rbegin()->first + 1, nullptr);
+      for (const auto& record : recordColumns) {
+        if (record.first >= 0) {
+          columnsByRecord[record.first] = &record.second;
+        }
+      }
+      std::vector<std::vector<int> > columnTimes(items.size());
+      auto readValues = [&](const std::string& statement) {
+        PreparedStatement stmt(statement, connection());
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW)
+        {
+          int recordIndex = sqlite3_column_int(sqlStmtPtr, 0);
+          int timeIndex = sqlite3_column_int(sqlStmtPtr, 1);
+          if ((recordIndex < 0) || (static_cast<size_t>(recordIndex) >= columnsByRecord.size()) || !columnsByRecord[recordIndex] ||
+              (timeIndex < 0) || (static_cast<size_t>(timeIndex) >= timeEnvPeriods.size()))
+          {
+            continue;
+          }
+          int envPeriodIndex = timeEnvPeriods[timeIndex];
+          for (const auto& envPeriodColumn : *columnsByRecord[recordIndex]) {
+            if (envPeriodColumn.first == envPeriodIndex) {
+              columns[envPeriodColumn.second].values.push_back(sqlite3_column_double(sqlStmtPtr, 2));
+              columnTimes[envPeriodColumn.second].push_back(timeIndex);
+              break;
+            }
+          }
+        }
+      };
+
+      if (hasReportData()) {
+        // ReportMeterData and ReportVariableData are views of ReportData joined with ReportExtendedData, read it directly instead
+        std::set<int> records;
+        for (const auto& table : tableRecords) {
+          records.insert(table.second.begin(), table.second.end());
+        }
+        boost::optional<int> numRecords = execAndReturnFirstInt("SELECT COUNT(*) FROM ReportDataDictionary");
+        if (numRecords && (4 * records.size() >= static_cast<size_t>(*numRecords))) {
+          // a sequential scan beats index lookups when reading a good part of the table
+          readValues("SELECT ReportDataDictionaryIndex, TimeIndex, Value FROM ReportData");
+        } else {
+          readValues("SELECT ReportDataDictionaryIndex, TimeIndex, Value FROM ReportData WHERE ReportDataDictionaryIndex IN (" +
+                     recordList(records) + ") ORDER BY ReportDataDictionaryIndex");
+        }
+      } else {
+        for (const auto& table : tableRecords) {
+          std::string recordColumn;
+          if (table.first == "ReportMeterData") {
+            recordColumn = "ReportMeterDataDictionaryIndex";
+          } else if (table.first == "ReportVariableData") {
+            recordColumn = "ReportVariableDataDictionaryIndex";
+          } else {
+            continue;
+          }
+          readValues("SELECT " + recordColumn + ", TimeIndex, VariableValue FROM " + table.first + " WHERE " + recordColumn + " IN (" +
+                     recordList(table.second) + ") ORDER BY " + recordColumn);
+        }
+      }
+
+      // time axes are built once per environment period and reporting frequency, unless some series report at other times
+      std::map<std::pair<int, std::string>, std::vector<unsigned> > groupTimeAxes;
+      std::vector<std::vector<int> > timeAxisTimes;
+      for (size_t i = 0; i < items.size(); ++i) {
+        std::vector<int>& columnTime = columnTimes[i];
+        if (columnTime.empty()) {
+          continue;
+        }
+
+        SqlFileTimeSeriesBatch::Column& column = columns[i];
+        if (!std::is_sorted(columnTime.begin(), columnTime.end())) {
+          std::vector<size_t> order(columnTime.size());
+          std::iota(order.begin(), order.end(), 0);
+          std::stable_sort(order.begin(), order.end(), [&columnTime](size_t a, size_t b) { return columnTime[a] < columnTime[b]; });
+          std::vector<int> sortedTime(order.size());
+          std::vector<double> sortedValues(order.size());
+          for (size_t j = 0; j < order.size(); ++j) {
+            sortedTime[j] = columnTime[order[j]];
+            sortedValues[j] = column.values[order[j]];
+          }
+          columnTime.swap(sortedTime);
+          column.values.swap(sortedValues);
+        }
+
+        const DataDictionaryItem& item = *items[i];
+        std::vector<unsigned>& candidates = groupTimeAxes[std::make_pair(item.envPeriodIndex, item.reportingFrequency)];
+        boost::optional<unsigned> timeAxisIndex;
+        for (unsigned candidate : candidates) {
+          if (timeAxisTimes[candidate] == columnTime) {
+            timeAxisIndex = candidate;
+            break;
+          }
+        }
+
+        if (!timeAxisIndex) {
+          std::vector<ReportTime> reportTimes;
+          reportTimes.reserve(columnTime.size());
+          for (int timeIndex : columnTime) {
+            reportTimes.push_back(times[timeIndex]);
+          }
+          boost::optional<SqlFileTimeSeriesBatch::TimeAxis> axis = timeAxis(reportTimes, item.reportingFrequency, item.envPeriodIndex);
+          OS_ASSERT(axis);
+          timeAxisIndex = result.m_timeAxes.size();
+          result.m_timeAxes.push_back(std::move(*axis));
+          timeAxisTimes.push_back(std::move(columnTime));
+          candidates.push_back(*timeAxisIndex);
+        }
+
+        column.timeAxis = *timeAxisIndex;
+        result.m_columns.push_back(std::move(column));
+      }
+
+      return result;
+    }
+
+    bool SqlFile_Impl::exportColumnar(const openstudio::path& path, const std::vector<SqlFileTimeSeriesQuery>& queries, bool compress)
+    {
+      try {
+        SqlFileTimeSeriesBatch batch = timeSeriesBatch(queries);
+
+        std::vector<ColumnarResults::StringTable> tables(2);
+
+        ColumnarResults::StringTable& dataDictionary = tables[0];
+        dataDictionary.name = "DataDictionary";
+        dataDictionary.columnNames = {"EnvironmentPeriod", "ReportingFrequency", "Name", "KeyValue", "Units", "Table"};
+        dataDictionary.columns.resize(dataDictionary.columnNames.size());
+        for (const DataDictionaryItem& item : m_dataDictionary) {
+          dataDictionary.columns[0].push_back(item.envPeriod);
+          dataDictionary.columns[1].push_back(item.reportingFrequency);
+          dataDictionary.columns[2].push_back(item.name);
+          dataDictionary.columns[3].push_back(item.keyValue);
+          dataDictionary.columns[4].push_back(item.units);
+          dataDictionary.columns[5].push_back(item.table);
+        }
+
+        ColumnarResults::StringTable& tabularData = tables[1];
+        tabularData.name = "TabularData";
+        tabularData.columnNames = {"ReportName", "ReportForString", "TableName", "RowName", "ColumnName", "Units", "Value"};
+        tabularData.columns.resize(tabularData.columnNames.size());
+        for (const auto& rows : this->tabularData()) {
+          for (const TabularDataEntry& entry : rows.second) {
+            tabularData.columns[0].push_back(std::get<0>(rows.first));
+            tabularData.columns[1].push_back(std::get<1>(rows.first));
+            tabularData.columns[2].push_back(entry.tableName);
+            tabularData.columns[3].push_back(std::get<2>(rows.first));
+            tabularData.columns[4].push_back(entry.columnName);
+            tabularData.columns[5].push_back(entry.units);
+            tabularData.columns[6].push_back(entry.text);
+          }
+        }
+
+        ColumnarResults::write(path, batch, tables, compress);
+      } catch (const std::exception& e) {
+        LOG(Error, "Cannot export columnar results to '" << toString(path) << "': " << e.what());
+        return false;
+      }
+      return true;
+    }
+
+    SqlFileTimeSeriesCursor SqlFile_Impl::timeSeriesCursor(const std::vector<SqlFileTimeSeriesQuery>& queries, unsigned blockSize)
+    {
+      SqlFileTimeSeriesCursor result;
+      if (!m_db) {
+        return result;
+      }
+
+      std::vector<const DataDictionaryItem*> items = dataDictionaryItems(queries);
+      if (items.empty()) {
+        return result;
+      }
+
+      auto state = std::make_shared<SqlFileTimeSeriesCursor::State>();
+      state->sqlFile = shared_from_this();
+      state->blockSize = std::max(1u, blockSize);
+
+      // ReportData holds meters and variables under one record index, the older tables each have their own
+      bool reportData = hasReportData();
+      std::map<int, std::set<int> > tableRecords;
+      for (const DataDictionaryItem* item : items) {
+        int table = 0;
+        if (!reportData) {
+          if (item->table == "ReportVariableData") {
+            table = 1;
+          } else if (item->table != "ReportMeterData") {
+            continue;
+          }
+        }
+        if (item->recordIndex < 0) {
+          continue;
+        }
+
+        SqlFileTimeSeriesCursor::Column column;
+        column.envPeriod = item->envPeriod;
+        column.reportingFrequency = item->reportingFrequency;
+        column.name = item->name;
+        column.keyValue = item->keyValue;
+        column.units = item->units;
+        column.envPeriodIndex = item->envPeriodIndex;
+
+        size_t key = 2 * static_cast<size_t>(item->recordIndex) + table;
+        if (key >= state->recordColumns.size()) {
+          state->recordColumns.resize(key + 1);
+        }
+        state->recordColumns[key].push_back(state->columns.size());
+        state->columns.push_back(std::move(column));
+        tableRecords[table].insert(item->recordIndex);
+      }
+
+      // rows are sorted by time step, SQLite spills the sort to a temporary file rather than holding it in memory
+      std::string statement;
+      if (reportData) {
+        statement = "SELECT TimeIndex, 0, ReportDataDictionaryIndex, Value FROM ReportData WHERE ReportDataDictionaryIndex IN (" +
+                    recordList(tableRecords[0]) + ") ORDER BY 1";
+      } else {
+        std::vector<std::string> selects;
+        if (tableRecords.count(0)) {
+          selects.push_back("SELECT TimeIndex, 0, ReportMeterDataDictionaryIndex, VariableValue FROM ReportMeterData WHERE ReportMeterDataDictionaryIndex IN (" +
+                            recordList(tableRecords[0]) + ")");
+        }
+        if (tableRecords.count(1)) {
+          selects.push_back("SELECT TimeIndex, 1, ReportVariableDataDictionaryIndex, VariableValue FROM ReportVariableData WHERE ReportVariableDataDictionaryIndex IN (" +
+                            recordList(tableRecords[1]) + ")");
+        }
+        if (selects.empty()) {
+          return result;
+        }
+        statement = boost::algorithm::join(selects, " UNION ALL ") + " ORDER BY 1";
+      }
+
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      int code = sqlite3_prepare_v2(connection(), statement.c_str(), statement.size(), &sqlStmtPtr, nullptr);
+      if (!sqlStmtPtr) {
+        LOG(Error, "Could not prepare statement '" << statement << "', error code " << code);
+        return result;
+      }
+      state->statement.reset(sqlStmtPtr, sqlite3_finalize);
+
+      result.m_state = state;
+      return result;
+    }
+
+    bool SqlFile_Impl::nextTimeSeriesBlock(SqlFileTimeSeriesCursor::State& state)
+    {
+      state.dateTimes.clear();
+      for (SqlFileTimeSeriesCursor::Column& column : state.columns) {
+        column.values.clear();
+      }
+      if (!m_connectionOpen) {
+        state.done = true;
+      }
+      if (state.done) {
+        state.statement.reset();
+        return false;
+      }
+
+      std::stringstream timeStatement;
+      timeStatement << "SELECT EnvironmentPeriodIndex, Month, Day, Hour, Minute";
+      if (hasYear()) {
+        timeStatement << ", Year";
+      }
+      timeStatement << " FROM Time WHERE TimeIndex=?";
+
+      sqlite3_stmt* sqlStmtPtr = state.statement.get();
+      // a row of the current time step has been added to this block
+      bool added = false;
+      while (true)
+      {
+        if (!state.pending) {
+          int code = sqlite3_step(sqlStmtPtr);
+          if (code != SQLITE_ROW) {
+            if (code != SQLITE_DONE) {
+              LOG(Error, "Error reading time series, error code " << code << ": " << sqlite3_errmsg(sqlite3_db_handle(sqlStmtPtr)));
+            }
+            state.done = true;
+            state.statement.reset();
+            break;
+          }
+        }
+        state.pending = false;
+
+        int timeIndex = sqlite3_column_int(sqlStmtPtr, 0);
+        if (timeIndex != state.timeIndex) {
+          state.timeIndex = timeIndex;
+          state.envPeriodIndex = -1;
+          added = false;
+
+          PreparedStatement time(cachedStatement(timeStatement.str()), m_db, timeIndex);
+          if (sqlite3_step(time.m_statement) == SQLITE_ROW) {
+            state.envPeriodIndex = sqlite3_column_int(time.m_statement, 0);
+            unsigned month = sqlite3_column_int(time.m_statement, 1);
+            unsigned day = sqlite3_column_int(time.m_statement, 2);
+            if ((month == 0) || (day == 0)) {
+              // run period reports
+              state.dateTime = lastDateTime(false, state.envPeriodIndex);
+            } else {
+              Time reportTime(0, sqlite3_column_int(time.m_statement, 3), sqlite3_column_int(time.m_statement, 4), 0);
+              state.dateTime = hasYear()
+                ? DateTime(Date(month, day, sqlite3_column_int(time.m_statement, 5)), reportTime)
+                : DateTime(Date(month, day), reportTime);
+            }
+          }
+        }
+
+        size_t key = 2 * static_cast<size_t>(sqlite3_column_int(sqlStmtPtr, 2)) + sqlite3_column_int(sqlStmtPtr, 1);
+        if (key >= state.recordColumns.size()) {
+          continue;
+        }
+        for (unsigned c : state.recordColumns[key]) {
+          SqlFileTimeSeriesCursor::Column& column = state.columns[c];
+          if (column.envPeriodIndex != state.envPeriodIndex) {
+            continue;
+          }
+          if (!added) {
+            if (state.dateTimes.size() == state.blockSize) {
+              // starts the next block
+              state.pending = true;
+              return true;
+            }
+            state.dateTimes.push_back(state.dateTime);
+            for (SqlFileTimeSeriesCursor::Column& other : state.columns) {
+              other.values.push_back(std::numeric_limits<double>::quiet_NaN());
+            }
+            added = true;
+          }
+          column.values.back() = sqlite3_column_double(sqlStmtPtr, 3);
+          break;
+        }
+      }
+
+      return !state.dateTimes.empty();
+    }
+
     boost::optional<std::pair<DateTime, DateTime> > SqlFile_Impl::daylightSavingsPeriod() const
     {
       // first and last date for dst=1
@@ -2718,7 +3395,7 @@ namespace openstudio{
         // first date time of dst
         std::string s = "select month, day, hour, minute from Time where dst=1 group by month order by month, day, hour, minute";
 
-        int code = sqlite3_prepare_v2(m_db, s.c_str(),-1,&sqlStmtPtr,nullptr);
+        int code = sqlite3_prepare_v2(connection(), s.c_str(),-1,&sqlStmtPtr,nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
@@ -2735,7 +3412,7 @@ namespace openstudio{
         // last date time of dst
         s = "select month, day, hour, minute from Time where dst=1 group by month order by month desc, day desc, hour desc, minute desc";
 
-        code = sqlite3_prepare_v2(m_db, s.c_str(),-1,&sqlStmtPtr,nullptr);
+        code = sqlite3_prepare_v2(connection(), s.c_str(),-1,&sqlStmtPtr,nullptr);
 
         code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
@@ -2763,7 +3440,18 @@ namespace openstudio{
     /// returns datadictionary of available timeseries
     DataDictionaryTable SqlFile_Impl::dataDictionary() const
     {
-      return m_dataDictionary;
+      // with the time series cached so far, as items held them before the cache was kept apart
+      DataDictionaryTable result = m_dataDictionary;
+      std::lock_guard<std::mutex> lock(m_cachedTimeSeriesMutex);
+      for (const auto& cached : m_cachedTimeSeries) {
+        auto it = result.find(boost::make_tuple(cached.first.first, cached.first.second));
+        if (it != result.end()) {
+          DataDictionaryItem item = *it;
+          item.timeSeries = cached.second;
+          result.replace(it, item);
+        }
+      }
+      return result;
     }
 
     /// Energy plus version number
@@ -2772,8 +3460,8 @@ namespace openstudio{
     {
       std::string result;
       if (m_db) {
-        sqlite3_stmt* sqlStmtPtr;
-        sqlite3_prepare_v2(m_db, "SELECT EnergyPlusVersion FROM Simulations", -1, &sqlStmtPtr, nullptr);
+        PreparedStatement stmt(cachedStatement("SELECT EnergyPlusVersion FROM Simulations"), m_db);
+        sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
         int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW) {
           // in 8.1 this is 'EnergyPlus-Windows-32 8.1.0.008, YMD=2014.11.08 22:49'
@@ -2787,7 +3475,6 @@ namespace openstudio{
             result = version_match[0].str();
           }
         }
-        sqlite3_finalize(sqlStmtPtr);
       }
       return result;
     }
@@ -2807,7 +3494,7 @@ namespace openstudio{
 
       sqlite3_stmt* sqlStmtPtr;
 
-      int code = sqlite3_prepare_v2(m_db, s.c_str(),-1,&sqlStmtPtr,nullptr);
+      int code = sqlite3_prepare_v2(connection(), s.c_str(),-1,&sqlStmtPtr,nullptr);
       code = sqlite3_step(sqlStmtPtr);
 
       while (code == SQLITE_ROW)
@@ -2858,19 +3545,16 @@ namespace openstudio{
     {
       boost::optional<std::string> refPt;
       std::stringstream s;
-      s << "select ReferencePt" << ptNum << " from daylightmaps where MapNumber=" << mapIndex;
+      s << "select ReferencePt" << ptNum << " from daylightmaps where MapNumber=?";
 
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement stmt(cachedStatement(s.str()), m_db, mapIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
 
       if (code == SQLITE_ROW)
         refPt = columnText(sqlite3_column_text(sqlStmtPtr,0));
 
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
-
       return refPt;
     }
 
@@ -2893,19 +3577,16 @@ namespace openstudio{
     {
       boost::optional<double> minValue;
       std::stringstream s;
-      s << "select min(d.Illuminance) from daylightmaphourlydata d inner join daylightmaphourlyreports r on d.HourlyReportIndex = r.HourlyReportIndex where r.MapNumber=" << mapIndex;
+      s << "select min(d.Illuminance) from daylightmaphourlydata d inner join daylightmaphourlyreports r on d.HourlyReportIndex = r.HourlyReportIndex where r.MapNumber=?";
 
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement stmt(cachedStatement(s.str()), m_db, mapIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
 
       if (code == SQLITE_ROW)
         minValue = sqlite3_column_double(sqlStmtPtr,0);
 
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
-
       return minValue;
     }
 
@@ -2928,19 +3609,16 @@ namespace openstudio{
     {
       boost::optional<double> maxValue;
       std::stringstream s;
-      s << "select max(d.Illuminance) from daylightmaphourlydata d inner join daylightmaphourlyreports r on d.HourlyReportIndex = r.HourlyReportIndex where r.MapNumber=" << mapIndex;
+      s << "select max(d.Illuminance) from daylightmaphourlydata d inner join daylightmaphourlyreports r on d.HourlyReportIndex = r.HourlyReportIndex where r.MapNumber=?";
 
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement stmt(cachedStatement(s.str()), m_db, mapIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
 
       if (code == SQLITE_ROW)
         maxValue = sqlite3_column_double(sqlStmtPtr,0);
 
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
-
       return maxValue;
     }
 
@@ -2958,20 +3636,18 @@ namespace openstudio{
     void SqlFile_Impl::illuminanceMapMaxValue(const int& mapIndex, double& minValue, double& maxValue) const
     {
       std::stringstream s;
-      s << "select min(d.Illuminance), max(d.Illuminance) from daylightmaphourlydata d inner join daylightmaphourlyreports r on d.HourlyReportIndex = r.HourlyReportIndex where r.MapNumber=" << mapIndex;
+      s << "select min(d.Illuminance), max(d.Illuminance) from daylightmaphourlydata d inner join daylightmaphourlyreports r on d.HourlyReportIndex = r.HourlyReportIndex where r.MapNumber=?";
 
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement stmt(cachedStatement(s.str()), m_db, mapIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
 
       if (code == SQLITE_ROW)
       {
         minValue = sqlite3_column_double(sqlStmtPtr,0);
         maxValue = sqlite3_column_double(sqlStmtPtr,1);
       }
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
     }
 
 
@@ -3132,12 +3808,12 @@ namespace openstudio{
       if (hasIlluminanceMapYear()) {
         s << "Year, ";
       }
-      s << "Month, DayOfMonth, Hour from daylightmaphourlyreports where MapNumber=" << mapIndex;
+      s << "Month, DayOfMonth, Hour from daylightmaphourlyreports where MapNumber=?";
 
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement stmt(cachedStatement(s.str()), m_db, mapIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
       while (code == SQLITE_ROW)
       {
         std::pair<int, DateTime> pair;
@@ -3161,9 +3837,6 @@ namespace openstudio{
         code = sqlite3_step(sqlStmtPtr);
       }
 
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
-
       return reportIndicesDates;
     }
 
@@ -3176,12 +3849,12 @@ namespace openstudio{
       if (hasYear()) {
         s << "Year, ";
       }
-      s << "Month, DayOfMonth, Hour from daylightmaphourlyreports where HourlyReportIndex=" << hourlyReportIndex;
+      s << "Month, DayOfMonth, Hour from daylightmaphourlyreports where HourlyReportIndex=?";
 
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement stmt(cachedStatement(s.str()), m_db, hourlyReportIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW)
       {
         int b = 0;
@@ -3198,10 +3871,6 @@ namespace openstudio{
         return DateTime();
       }
 
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
-
-
       // Note JM 2019-03-14: Starting with E+ v8.9.0, we actually have Year in the SQL file
       // So if we can, we use the actual year, otherwise we initialze with defaults
       // and let the Date Ctor figure out the assumed year
@@ -3231,26 +3900,11 @@ namespace openstudio{
         hours = 24;
       }
 
-      std::stringstream s;
-      s << "select HourlyReportIndex from daylightmaphourlyreports where MapNumber='" << mapIndex << "'"
-        // E+ doesn't have a Year for this table cf https://github.com/NREL/EnergyPlus/issues/7225
-        //  << " AND Year=" << year
-        << " AND Month=" << monthOfYear <<
-        " AND DayOfMonth=" << dayOfMonth <<
-        " AND Hour=" << hours ;
-
-      sqlite3_stmt* sqlStmtPtr;
-
-      boost::optional<int> timeIndex;
-      int code = sqlite3_prepare_v2(m_db, s.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW)
-      {
-        timeIndex = sqlite3_column_int(sqlStmtPtr,0);
-      }
-
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
+      // E+ doesn't have a Year for this table cf https://github.com/NREL/EnergyPlus/issues/7225
+      boost::optional<int> timeIndex = execAndReturnFirstInt("select HourlyReportIndex from daylightmaphourlyreports where MapNumber=?"
+        " AND Month=? AND DayOfMonth=? AND Hour=?",
+        // Bind Args
+        mapIndex, monthOfYear, dayOfMonth, hours);
 
       if (!timeIndex)
       {
@@ -3291,14 +3945,11 @@ namespace openstudio{
       double xVal(0.0), yVal(0.0), yValPrevious(0.0), illuminanceVal(0.0);
       bool yValChanged=false;
 
-      std::stringstream statement;
-      statement << "select X,Y,Illuminance from daylightmaphourlydata where HourlyReportIndex=" << hourlyReportIndex <<
-        " order by Y asc, X asc";
-
-      sqlite3_stmt* sqlStmtPtr;
+      PreparedStatement stmt(cachedStatement("select X,Y,Illuminance from daylightmaphourlydata where HourlyReportIndex=? order by Y asc, X asc"),
+                             m_db, hourlyReportIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      int code = sqlite3_prepare_v2(m_db, statement.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
       if (code == SQLITE_ROW)
       {
         xVal = sqlite3_column_double(sqlStmtPtr,0);
@@ -3351,9 +4002,6 @@ namespace openstudio{
         code = sqlite3_step(sqlStmtPtr);
       }
 
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
-
     }
 
 
@@ -3372,14 +4020,11 @@ namespace openstudio{
       unsigned i = 0;
       unsigned j = 0;
 
-      std::stringstream statement;
-      statement << "select Illuminance from daylightmaphourlydata where HourlyReportIndex=" << hourlyReportIndex <<
-        " order by X asc, Y asc";
+      PreparedStatement stmt(cachedStatement("select Illuminance from daylightmaphourlydata where HourlyReportIndex=? order by X asc, Y asc"),
+                             m_db, hourlyReportIndex);
+      sqlite3_stmt* sqlStmtPtr = stmt.m_statement;
 
-      sqlite3_stmt* sqlStmtPtr;
-
-      int code = sqlite3_prepare_v2(m_db, statement.str().c_str(),-1,&sqlStmtPtr,nullptr);
-      code = sqlite3_step(sqlStmtPtr);
+      int code = sqlite3_step(sqlStmtPtr);
       while (code == SQLITE_ROW)
       {
         if (i >= M){
@@ -3402,22 +4047,16 @@ namespace openstudio{
         }
       }
 
-      /// must finalize to prevent memory leaks
-      sqlite3_finalize(sqlStmtPtr);
-
       return illuminance;
     }
 
     // find the illuminance map index by name
     boost::optional<int> SqlFile_Impl::illuminanceMapIndex(const std::string& name) const
     {
-      // TODO: haven't figured out how to bind properly to the LIKE statement, tried
-      // LIKE ?
-      // LIKE %?%  => sqlite3_prepare_v2 fails
-      // LIKE %%?%%
-      // LIKE '%?%' (not recognized as a placeholder)
-      const std::string& s = "SELECT MapNumber FROM DaylightMaps WHERE MapName LIKE '%" + name + "%'";
-      return execAndReturnFirstInt(s);
+      // the wildcards are concatenated around the placeholder, '%?%' would not be recognized as one
+      return execAndReturnFirstInt("SELECT MapNumber FROM DaylightMaps WHERE MapName LIKE '%' || ? || '%'",
+          // Bind Args
+          name);
     }
 
     void SqlFile_Impl::mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries)
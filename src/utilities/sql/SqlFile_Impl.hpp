@@ -35,6 +35,8 @@
 #include "SummaryData.hpp"
 #include "SqlFileEnums.hpp"
 #include "SqlFileDataDictionary.hpp"
+#include "SqlFileTimeSeriesBatch.hpp"
+#include "SqlFileTimeSeriesCursor.hpp"
 #include "PreparedStatement.hpp"
 #include "../data/DataEnums.hpp"
 #include "../data/EndUses.hpp"
@@ -43,7 +45,12 @@
 
 #include <boost/optional.hpp>
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 struct sqlite3;
@@ -59,7 +66,7 @@ namespace openstudio{
   // private namespace
   namespace detail{
 
-    class UTILITIES_API SqlFile_Impl {
+    class UTILITIES_API SqlFile_Impl : public std::enable_shared_from_this<SqlFile_Impl> {
     public:
 
       /// constructor from filesystem path, will throw ConstructorException if file does not exist
@@ -68,6 +75,11 @@ namespace openstudio{
       /// pass in false if those indexes are not needed
       SqlFile_Impl(const openstudio::path& path, const bool createIndexes=true);
 
+      /// constructor from filesystem path opening the file in openMode
+      /// in ReadOnly mode the file is never written to, createIndexes then indexes a temporary copy of the file,
+      /// and queries may be run from several threads at once, each thread but the one opening the file gets its own connection
+      SqlFile_Impl(const openstudio::path& path, const SqlFileOpenMode& openMode, const bool createIndexes);
+
       /// createIndexes will create useful indexes when creating an sqlite file but for faster creation
       /// pass in false if those indexes are not needed
       SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
@@ -88,6 +100,9 @@ namespace openstudio{
       /// get the path
       openstudio::path path() const;
 
+      /// mode the file was opened in
+      SqlFileOpenMode openMode() const;
+
       /// close the file
       bool close();
 
@@ -658,6 +673,23 @@ namespace openstudio{
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
       std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+      /** Expands and executes all queries at once, returning the matching time series in order without
+       *  duplicates. Reported values are read in one scan per data table, and time series reported at
+       *  the same times share one time axis. */
+      SqlFileTimeSeriesBatch timeSeriesBatch(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
+      /** Expands all queries and returns a cursor reading the matching time series in time order, blockSize
+       *  time steps at a time. The cursor keeps this SqlFile_Impl alive. */
+      SqlFileTimeSeriesCursor timeSeriesCursor(const std::vector<SqlFileTimeSeriesQuery>& queries, unsigned blockSize);
+
+      /** Reads the next block of time steps of a cursor returned by timeSeriesCursor, returns false once
+       *  every time step has been read or the file has been closed. */
+      bool nextTimeSeriesBlock(SqlFileTimeSeriesCursor::State& state);
+
+      /** Writes the time series matching queries, the data dictionary and the tabular data to a columnar
+       *  results file at path, see ColumnarResults. Returns false and logs an error on failure. */
+      bool exportColumnar(const openstudio::path& path, const std::vector<SqlFileTimeSeriesQuery>& queries, bool compress);
+
       // returns an optional pair of date times for begin and end of daylight savings time
       boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime> > daylightSavingsPeriod() const;
 
@@ -745,7 +777,7 @@ namespace openstudio{
       template<typename... Args>
       boost::optional<double> execAndReturnFirstDouble(const std::string& statement, Args&& ... args) const {
         if (m_db) {
-          PreparedStatement stmt(statement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(statement, true), m_db, args...);
           return stmt.execAndReturnFirstDouble();
         }
         return boost::none;
@@ -756,7 +788,7 @@ namespace openstudio{
       template<typename... Args>
       boost::optional<int> execAndReturnFirstInt(const std::string& statement, Args&& ... args) const {
         if (m_db) {
-          PreparedStatement stmt(statement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(statement, true), m_db, args...);
           return stmt.execAndReturnFirstInt();
         }
         return boost::none;
@@ -767,7 +799,7 @@ namespace openstudio{
       template<typename... Args>
       boost::optional<std::string> execAndReturnFirstString(const std::string& statement, Args&& ... args) const {
         if (m_db) {
-          PreparedStatement stmt(statement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(statement, true), m_db, args...);
           return stmt.execAndReturnFirstString();
         }
         return boost::none;
@@ -778,7 +810,7 @@ namespace openstudio{
       template<typename... Args>
       boost::optional<std::vector<double> > execAndReturnVectorOfDouble(const std::string& statement, Args&& ... args) const {
         if (m_db) {
-          PreparedStatement stmt(statement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(statement, true), m_db, args...);
           return stmt.execAndReturnVectorOfDouble();
         }
         return boost::none;
@@ -789,7 +821,7 @@ namespace openstudio{
       template<typename... Args>
       boost::optional<std::vector<int> > execAndReturnVectorOfInt(const std::string& statement, Args&& ... args) const {
         if (m_db) {
-          PreparedStatement stmt(statement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(statement, true), m_db, args...);
           return stmt.execAndReturnVectorOfInt();
         }
         return boost::none;
@@ -801,7 +833,7 @@ namespace openstudio{
       boost::optional<std::vector<std::string> > execAndReturnVectorOfString(const std::string& statement, Args&& ... args) const {
         if (m_db)
         {
-          PreparedStatement stmt(statement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(statement, true), m_db, args...);
           return stmt.execAndReturnVectorOfString();
         }
         return boost::none;
@@ -812,8 +844,12 @@ namespace openstudio{
       template<typename... Args>
       int execute(const std::string& statement, Args&& ... args) const {
         int code = SQLITE_ERROR;
+        // read only connections are query only, so the tabular data cannot change under concurrent readers
+        if (!m_readOnly) {
+          m_tabularData.reset();
+        }
         if (m_db) {
-          PreparedStatement stmt(statement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(statement, true), m_db, args...);
           code = stmt.execute();
         }
         return code;
@@ -875,8 +911,9 @@ namespace openstudio{
       // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
       template<typename... Args>
       void execAndThrowOnError(const std::string& bindingStatement, Args&& ... args) {
+        m_tabularData.reset();
         if (m_db) {
-          PreparedStatement stmt(bindingStatement, m_db, false, args...);
+          PreparedStatement stmt(cachedStatement(bindingStatement, true), m_db, args...);
           stmt.execAndThrowOnError();
         }
         std::runtime_error("Error executing SQL statement as database connection is not open.");
@@ -889,6 +926,27 @@ namespace openstudio{
       // return a single timeseries matching recordIndex - internally used to retrieve timeseries
       boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary);
       std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
+
+      // date and interval columns of one row of the Time table
+      struct ReportTime
+      {
+        boost::optional<unsigned> year;
+        unsigned month = 0;
+        unsigned day = 0;
+        unsigned interval = 0;
+      };
+
+      // time axis for values reported at times, empty if times is
+      boost::optional<SqlFileTimeSeriesBatch::TimeAxis> timeAxis(const std::vector<ReportTime>& times, const std::string& reportingFrequency, int envPeriodIndex);
+
+      // data dictionary items matching a vetted query, falling back on the same alternate names as timeSeries
+      std::vector<const DataDictionaryItem*> dataDictionaryItems(const SqlFileTimeSeriesQuery& query);
+
+      // data dictionary items matching any of queries, each only once
+      std::vector<const DataDictionaryItem*> dataDictionaryItems(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
+      // true if values are stored in ReportData, ReportVariableData and ReportMeterData are views of it then
+      bool hasReportData();
       boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
       // return first date in time table used for start date of run period variables
@@ -904,6 +962,62 @@ namespace openstudio{
 
       bool isValidConnection();
 
+      // Returns the prepared statement for statement from the cache of this connection, preparing it on first use.
+      // Wrap the result in a PreparedStatement to bind arguments, the statement is reset when that goes out of scope.
+      // A statement that fails to prepare gives nullptr, or throws if throwOnError is set
+      sqlite3_stmt* cachedStatement(const std::string& statement, bool throwOnError = false) const;
+
+      // finalizes all cached statements, must be done before closing the connection
+      void clearStatementCache();
+
+      // a connection of a thread other than the one that opened a read only file, with its own statement cache
+      struct ReaderConnection
+      {
+        sqlite3* db = nullptr;
+        std::map<std::string, std::vector<sqlite3_stmt*> > statements;
+      };
+
+      // connection for the calling thread, opened on first use
+      ReaderConnection& readerConnection() const;
+
+      // connection to use from the calling thread, m_db unless the file is read only and this is not the thread that opened it
+      sqlite3* connection() const;
+
+      // opens m_databaseFilename according to the open mode, returns nullptr on failure
+      sqlite3* openConnection() const;
+
+      // copies the file to a temporary database and indexes the copy, throws on failure
+      openstudio::path createIndexedCopy() const;
+
+      // one row of TabularDataWithStrings, less the names it is indexed by
+      struct TabularDataEntry
+      {
+        std::string tableName;
+        std::string columnName;
+        std::string units;
+        std::string text;
+        // text converted the same way as by execAndReturnFirstDouble
+        double value;
+      };
+
+      // (ReportName, ReportForString, RowName)
+      using TabularDataKey = std::tuple<std::string, std::string, std::string>;
+
+      // all of TabularDataWithStrings by TabularDataKey, each vector in table order.
+      // The whole table is read on first use so that the many summary accessors do not each run a query
+      const std::map<TabularDataKey, std::vector<TabularDataEntry> >& tabularData() const;
+
+      // rows of TabularDataWithStrings for ReportName, ReportForString and RowName, in table order
+      const std::vector<TabularDataEntry>& tabularDataEntries(const std::string& reportName, const std::string& reportForString,
+                                                              const std::string& rowName) const;
+
+      // value of the first row of TabularDataWithStrings matching all of its arguments
+      boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                               const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+      // annual cost of a column of the Economics Results Summary Report, whose row is named 'Cost' or 'Cost (~~$~~)' depending on the version
+      boost::optional<double> annualCostValue(const std::string& columnName) const;
+
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
       openstudio::path m_path;
@@ -918,6 +1032,34 @@ namespace openstudio{
 
       bool m_hasIlluminanceMapYear;
 
+      bool m_readOnly;
+
+      // read only file opened through an indexed temporary copy, at m_copyPath while open
+      bool m_useIndexedCopy;
+      openstudio::path m_copyPath;
+
+      // file actually opened, m_sqliteFilename or m_copyPath
+      std::string m_databaseFilename;
+
+      // prepared statements of m_db by SQL text, more than one when a statement is used again while it is still being stepped
+      mutable std::map<std::string, std::vector<sqlite3_stmt*> > m_statementCache;
+
+      // thread that opened the file, and so uses m_db
+      std::thread::id m_ownerThread;
+
+      // connections of other threads to a read only file
+      mutable std::map<std::thread::id, ReaderConnection> m_readerConnections;
+      mutable std::mutex m_readerConnectionsMutex;
+
+      // index returned by tabularData, reset by close and by any statement run through execute or execAndThrowOnError
+      mutable boost::optional<std::map<TabularDataKey, std::vector<TabularDataEntry> > > m_tabularData;
+      mutable std::mutex m_tabularDataMutex;
+
+      // time series cached lazily by recordIndex and envPeriodIndex of their DataDictionaryItem, kept apart from
+      // m_dataDictionary so that it is not changed after the file is opened and can be read without a lock
+      std::map<std::pair<int, int>, TimeSeries> m_cachedTimeSeries;
+      mutable std::mutex m_cachedTimeSeriesMutex;
+
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
 
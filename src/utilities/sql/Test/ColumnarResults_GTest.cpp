@@ -0,0 +1,120 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "SqlFileFixture.hpp"
+
+#include "../ColumnarResults.hpp"
+#include "../SqlFileTimeSeriesBatch.hpp"
+#include "../SqlFileTimeSeriesQuery.hpp"
+#include "../../data/TimeSeries.hpp"
+#include "../../data/Vector.hpp"
+#include "../../core/Exception.hpp"
+
+#include <fstream>
+
+using namespace openstudio;
+
+TEST_F(SqlFileFixture, ColumnarResults)
+{
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  queries.push_back(SqlFileTimeSeriesQuery(boost::none, ReportingFrequency(ReportingFrequency::Hourly), TimeSeriesIdentifier("Electricity:Facility")));
+  queries.push_back(SqlFileTimeSeriesQuery(boost::none, ReportingFrequency(ReportingFrequency::Hourly),
+                                           TimeSeriesIdentifier("Site Outdoor Air Drybulb Temperature"), KeyValueIdentifier("Environment")));
+  SqlFileTimeSeriesBatch batch = sqlFile.timeSeriesBatch(queries);
+  ASSERT_EQ(2u, batch.size());
+
+  for (bool compress : {false, true}) {
+    openstudio::path path = toPath(compress ? "./ColumnarResults.zlib.osrc" : "./ColumnarResults.osrc");
+    ASSERT_TRUE(sqlFile.exportColumnar(path, queries, compress));
+
+    ColumnarResults results(path);
+    ASSERT_EQ(batch.size(), results.numTimeSeries());
+    EXPECT_EQ(batch.numTimeAxes(), results.numTimeAxes());
+    for (unsigned i = 0; i < batch.size(); ++i) {
+      EXPECT_EQ(batch.environmentPeriod(i), results.environmentPeriod(i));
+      EXPECT_EQ(batch.reportingFrequency(i), results.reportingFrequency(i));
+      EXPECT_EQ(batch.timeSeriesName(i), results.timeSeriesName(i));
+      EXPECT_EQ(batch.keyValue(i), results.keyValue(i));
+      EXPECT_EQ(batch.units(i), results.units(i));
+
+      boost::optional<unsigned> found = results.find(batch.environmentPeriod(i), batch.reportingFrequency(i), batch.timeSeriesName(i), batch.keyValue(i));
+      ASSERT_TRUE(found);
+      EXPECT_EQ(i, *found);
+
+      ColumnarSpan<double> values = results.values(i);
+      ASSERT_EQ(batch.values(i).size(), values.size());
+      EXPECT_TRUE(std::equal(values.begin(), values.end(), batch.values(i).begin()));
+
+      unsigned t = results.timeAxisIndex(i);
+      EXPECT_EQ(batch.timeAxisIndex(i), t);
+      EXPECT_EQ(batch.firstReportDateTime(t), results.firstReportDateTime(t));
+      ColumnarSpan<std::int64_t> seconds = results.secondsFromFirstReport(t);
+      ASSERT_EQ(batch.secondsFromFirstReport(t).size(), seconds.size());
+      EXPECT_TRUE(std::equal(seconds.begin(), seconds.end(), batch.secondsFromFirstReport(t).begin()));
+
+      TimeSeries expected = batch.timeSeries(i);
+      TimeSeries actual = results.timeSeries(i);
+      EXPECT_EQ(expected.firstReportDateTime(), actual.firstReportDateTime());
+      EXPECT_EQ(expected.units(), actual.units());
+      EXPECT_EQ(toStandardVector(expected.values()), toStandardVector(actual.values()));
+    }
+    EXPECT_FALSE(results.find(batch.environmentPeriod(0), "Hourly", "Not A Variable", ""));
+
+    std::vector<std::string> tableNames = results.tableNames();
+    ASSERT_EQ(2u, tableNames.size());
+    EXPECT_EQ("DataDictionary", tableNames[0]);
+    EXPECT_EQ("TabularData", tableNames[1]);
+    EXPECT_LT(0u, results.numTableRows("DataDictionary"));
+    EXPECT_LT(0u, results.numTableRows("TabularData"));
+    EXPECT_EQ(0u, results.numTableRows("NotATable"));
+    EXPECT_THROW(results.tableValue("DataDictionary", "NotAColumn", 0), openstudio::Exception);
+
+    boost::optional<double> expectedNetSiteEnergy = sqlFile.netSiteEnergy();
+    boost::optional<double> netSiteEnergy = results.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                                                                     "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
+    ASSERT_TRUE(expectedNetSiteEnergy);
+    ASSERT_TRUE(netSiteEnergy);
+    EXPECT_DOUBLE_EQ(*expectedNetSiteEnergy, *netSiteEnergy);
+  }
+
+  // not a columnar results file
+  EXPECT_THROW(ColumnarResults(sqlFile.path()), openstudio::Exception);
+  EXPECT_FALSE(ColumnarResults::load(toPath("./DoesNotExist.osrc")));
+
+  // truncated file
+  {
+    std::ifstream in("./ColumnarResults.osrc", std::ios_base::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::ofstream out("./ColumnarResults.truncated.osrc", std::ios_base::binary | std::ios_base::trunc);
+    out.write(bytes.data(), bytes.size() / 2);
+  }
+  EXPECT_FALSE(ColumnarResults::load(toPath("./ColumnarResults.truncated.osrc")));
+}
@@ -0,0 +1,115 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "SqlFileFixture.hpp"
+
+#include "../SqlFileCollection.hpp"
+#include "../SqlFileTimeSeriesQuery.hpp"
+#include "../SqlFileEnums.hpp"
+#include "../../data/TimeSeries.hpp"
+#include "../../data/Vector.hpp"
+
+#include <cmath>
+
+using namespace openstudio;
+
+TEST_F(SqlFileFixture, SqlFileCollection)
+{
+  std::vector<openstudio::path> paths;
+  paths.push_back(sqlFile.path());
+  paths.push_back(sqlFile2.path());
+  paths.push_back(toPath("./DoesNotExist/eplusout.sql"));
+  paths.push_back(sqlFile.path());
+
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  queries.push_back(SqlFileTimeSeriesQuery(boost::none, ReportingFrequency(ReportingFrequency::Hourly), TimeSeriesIdentifier("Electricity:Facility")));
+  queries.push_back(SqlFileTimeSeriesQuery(boost::none, ReportingFrequency(ReportingFrequency::Hourly),
+                                           TimeSeriesIdentifier("Site Outdoor Air Drybulb Temperature"), KeyValueIdentifier("Environment")));
+
+  SqlFileCollection collection(paths, queries);
+  EXPECT_LE(1u, collection.numThreads());
+  collection.setNumThreads(2);
+  EXPECT_EQ(2u, collection.numThreads());
+  EXPECT_EQ(4u, collection.numRuns());
+
+  EXPECT_EQ(3u, collection.process(true));
+  EXPECT_TRUE(collection.processed(0));
+  EXPECT_TRUE(collection.processed(1));
+  EXPECT_FALSE(collection.processed(2));
+  EXPECT_TRUE(collection.processed(3));
+  EXPECT_LT(0.0, collection.filesPerSecond());
+
+  std::string envPeriod = sqlFile.availableEnvPeriods()[0];
+  boost::optional<unsigned> v = collection.find(envPeriod, "Hourly", "Electricity:Facility", "");
+  ASSERT_TRUE(v);
+  EXPECT_EQ("Electricity:Facility", collection.timeSeriesName(*v));
+
+  boost::optional<TimeSeries> expected = sqlFile.timeSeries(envPeriod, "Hourly", "Electricity:Facility", "");
+  ASSERT_TRUE(expected);
+  std::vector<double> expectedValues = toStandardVector(expected->values());
+  for (unsigned run : {0u, 3u}) {
+    ASSERT_EQ(expectedValues.size(), collection.values(run, *v).size());
+    ASSERT_TRUE(collection.reduction(run, *v, SqlFileReduction::Sum));
+    EXPECT_DOUBLE_EQ(sum(expected->values()), *collection.reduction(run, *v, SqlFileReduction::Sum));
+    EXPECT_DOUBLE_EQ(maximum(expected->values()), *collection.reduction(run, *v, SqlFileReduction::Maximum));
+    EXPECT_DOUBLE_EQ(minimum(expected->values()), *collection.reduction(run, *v, SqlFileReduction::Minimum));
+    EXPECT_DOUBLE_EQ(mean(expected->values()), *collection.reduction(run, *v, SqlFileReduction::Mean));
+
+    boost::optional<TimeSeries> ts = collection.timeSeries(run, *v);
+    ASSERT_TRUE(ts);
+    EXPECT_EQ(expected->firstReportDateTime(), ts->firstReportDateTime());
+    EXPECT_DOUBLE_EQ(sum(expected->values()), sum(ts->values()));
+  }
+  // the run that could not be opened has no results
+  EXPECT_FALSE(collection.reduction(2, *v, SqlFileReduction::Sum));
+  EXPECT_TRUE(collection.values(2, *v).empty());
+  std::vector<double> sums = collection.reductions(*v, SqlFileReduction::Sum);
+  ASSERT_EQ(4u, sums.size());
+  EXPECT_TRUE(std::isnan(sums[2]));
+  EXPECT_DOUBLE_EQ(sums[0], sums[3]);
+
+  // without values only the reductions are kept
+  collection.setNumThreads(1);
+  EXPECT_EQ(3u, collection.process());
+  v = collection.find(envPeriod, "Hourly", "Electricity:Facility", "");
+  ASSERT_TRUE(v);
+  EXPECT_TRUE(collection.values(0, *v).empty());
+  EXPECT_FALSE(collection.timeSeries(0, *v));
+  EXPECT_DOUBLE_EQ(sums[0], *collection.reduction(0, *v, SqlFileReduction::Sum));
+
+  // results streamed to a visitor
+  unsigned numTimeSeries = 0;
+  EXPECT_EQ(3u, collection.forEach([&](unsigned run, const SqlFileTimeSeriesBatch& batch) {
+    EXPECT_NE(2u, run);
+    numTimeSeries += batch.size();
+  }));
+  EXPECT_LT(0u, numTimeSeries);
+}
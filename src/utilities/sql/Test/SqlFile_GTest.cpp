@@ -30,6 +30,8 @@
 #include <gtest/gtest.h>
 
 #include "SqlFileFixture.hpp"
+#include "../SqlFileTimeSeriesQuery.hpp"
+#include "../SqlFileTimeSeriesCursor.hpp"
 
 #include "../../time/Date.hpp"
 #include "../../time/Calendar.hpp"
@@ -47,6 +49,12 @@
 #include <utilities/idd/Exterior_WaterEquipment_FieldEnums.hxx>
 
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <atomic>
+#include <thread>
 #include <boost/regex.hpp>
 #include <resources.hxx>
 #include <stdexcept>
@@ -69,6 +77,33 @@ TEST_F(SqlFileFixture, SummaryValues)
   EXPECT_NEAR(570.38, *(sqlFile.totalSourceEnergy()), 2); // for 6.0, was 564.41
 }
 
+TEST_F(SqlFileFixture, TabularDataIndex)
+{
+  // summary accessors are served from an index of TabularDataWithStrings, check them against the query they replace
+  const std::string query = "SELECT Value FROM TabularDataWithStrings WHERE ReportName=? AND ReportForString=? AND TableName=? AND RowName=? AND ColumnName=? AND Units=?";
+
+  boost::optional<double> expected = sqlFile.execAndReturnFirstDouble(query, std::string("AnnualBuildingUtilityPerformanceSummary"),
+    std::string("Entire Facility"), std::string("Site and Source Energy"), std::string("Net Site Energy"), std::string("Total Energy"), std::string("GJ"));
+  ASSERT_TRUE(expected);
+  ASSERT_TRUE(sqlFile.netSiteEnergy());
+  EXPECT_DOUBLE_EQ(expected.get(), sqlFile.netSiteEnergy().get());
+
+  expected = sqlFile.execAndReturnFirstDouble(query, std::string("AnnualBuildingUtilityPerformanceSummary"),
+    std::string("Entire Facility"), std::string("End Uses"), std::string("Interior Lighting"), std::string("Electricity"), std::string("GJ"));
+  ASSERT_TRUE(expected);
+  ASSERT_TRUE(sqlFile.electricityInteriorLighting());
+  EXPECT_DOUBLE_EQ(expected.get(), sqlFile.electricityInteriorLighting().get());
+
+  boost::optional<EndUses> endUses = sqlFile.endUses();
+  ASSERT_TRUE(endUses);
+  EXPECT_DOUBLE_EQ(expected.get(), endUses->getEndUse(EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights));
+
+  // the index is rebuilt after the file is reopened
+  EXPECT_TRUE(sqlFile.reopen());
+  ASSERT_TRUE(sqlFile.electricityInteriorLighting());
+  EXPECT_DOUBLE_EQ(expected.get(), sqlFile.electricityInteriorLighting().get());
+}
+
 
 TEST_F(SqlFileFixture, EnvPeriods)
 {
@@ -202,6 +237,403 @@ TEST_F(SqlFileFixture, BadStatement)
   }
 }
 
+TEST_F(SqlFileFixture, CachedStatements)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+
+  // the same query runs through a cached statement the second time, with fresh bindings
+  openstudio::OptionalTimeSeries ts1 = sqlFile.timeSeries(availableEnvPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature",  "Environment");
+  openstudio::OptionalTimeSeries ts2 = sqlFile.timeSeries(availableEnvPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature",  "Environment");
+  ASSERT_TRUE(ts1);
+  ASSERT_TRUE(ts2);
+  EXPECT_EQ(ts1->firstReportDateTime(), ts2->firstReportDateTime());
+  ASSERT_EQ(ts1->values().size(), ts2->values().size());
+  EXPECT_DOUBLE_EQ(sum(ts1->values()), sum(ts2->values()));
+
+  const std::string query = "SELECT Value FROM ReportData WHERE ReportDataIndex=?";
+  boost::optional<double> first = sqlFile.execAndReturnFirstDouble(query, 1);
+  boost::optional<double> second = sqlFile.execAndReturnFirstDouble(query, 2);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  EXPECT_DOUBLE_EQ(first.get(), sqlFile.execAndReturnFirstDouble(query, 1).get());
+  EXPECT_DOUBLE_EQ(second.get(), sqlFile.execAndReturnFirstDouble(query, 2).get());
+  EXPECT_FALSE(sqlFile.execAndReturnFirstDouble(query, -1));
+
+  // a statement that fails to prepare is not cached, and throws every time
+  EXPECT_THROW(sqlFile.execAndReturnFirstDouble("SELECT * FROM NonExistantTable;"), std::runtime_error);
+  EXPECT_THROW(sqlFile.execAndReturnFirstDouble("SELECT * FROM NonExistantTable;"), std::runtime_error);
+
+  // names are bound rather than pasted into the statement
+  EXPECT_FALSE(sqlFile.illuminanceMapIndex("' OR 1=1 OR MapName LIKE '"));
+}
+
+TEST_F(SqlFileFixture, DISABLED_TimeSeriesBenchmark)
+{
+  // retrieve every available time series, this is dominated by the per series queries
+  auto start = std::chrono::steady_clock::now();
+  unsigned n = 0;
+  for (const std::string& envPeriod : sqlFile2.availableEnvPeriods()) {
+    for (const std::string& reportingFrequency : sqlFile2.availableReportingFrequencies(envPeriod)) {
+      for (const std::string& variableName : sqlFile2.availableVariableNames(envPeriod, reportingFrequency)) {
+        n += sqlFile2.timeSeries(envPeriod, reportingFrequency, variableName).size();
+      }
+    }
+  }
+  auto end = std::chrono::steady_clock::now();
+  EXPECT_LT(0u, n);
+  std::cout << "Retrieved " << n << " time series in " << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+}
+
+TEST_F(SqlFileFixture, TimeSeriesBatch)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  std::string envPeriod = availableEnvPeriods[0];
+
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, "Site Outdoor Air Drybulb Temperature", "Environment"));
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Detailed, "Site Outdoor Air Drybulb Temperature", "Environment"));
+  queries.push_back(SqlFileTimeSeriesQuery(EnvironmentIdentifier(envPeriod), ReportingFrequency(ReportingFrequency::Hourly), TimeSeriesIdentifier("Electricity:Facility")));
+  // duplicates are only returned once
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, "Site Outdoor Air Drybulb Temperature", "ENVIRONMENT"));
+
+  SqlFileTimeSeriesBatch batch = sqlFile.timeSeriesBatch(queries);
+  ASSERT_EQ(3u, batch.size());
+  EXPECT_NE(batch.timeAxisIndex(0), batch.timeAxisIndex(1));
+  EXPECT_EQ("Site Outdoor Air Drybulb Temperature", batch.timeSeriesName(0));
+  EXPECT_EQ("Environment", batch.keyValue(0));
+  EXPECT_EQ("Hourly", batch.reportingFrequency(0));
+  EXPECT_EQ("Electricity:Facility", batch.timeSeriesName(2));
+  ASSERT_TRUE(batch.intervalLength(batch.timeAxisIndex(0)));
+  EXPECT_EQ(Time(0, 1), *batch.intervalLength(batch.timeAxisIndex(0)));
+
+  ASSERT_TRUE(batch.find(envPeriod, "Hourly", "Electricity:Facility", ""));
+  EXPECT_EQ(2u, *batch.find(envPeriod, "Hourly", "Electricity:Facility", ""));
+  EXPECT_FALSE(batch.find(envPeriod, "Daily", "Electricity:Facility", ""));
+
+  // same time series as retrieving them one by one
+  std::vector<openstudio::OptionalTimeSeries> expected;
+  expected.push_back(sqlFile.timeSeries(envPeriod, "Hourly", "Site Outdoor Air Drybulb Temperature",  "Environment"));
+  expected.push_back(sqlFile.timeSeries(envPeriod, "HVAC System Timestep", "Site Outdoor Air Drybulb Temperature",  "Environment"));
+  expected.push_back(sqlFile.timeSeries(envPeriod, "Hourly", "Electricity:Facility",  ""));
+  for (unsigned i = 0; i < 3; ++i) {
+    ASSERT_TRUE(expected[i]);
+    TimeSeries ts = batch.timeSeries(i);
+    EXPECT_EQ(expected[i]->firstReportDateTime(), ts.firstReportDateTime());
+    EXPECT_EQ(expected[i]->units(), ts.units());
+    ASSERT_EQ(expected[i]->values().size(), ts.values().size());
+    ASSERT_EQ(expected[i]->values().size(), batch.values(i).size());
+    for (unsigned j = 0; j < ts.values().size(); ++j) {
+      EXPECT_DOUBLE_EQ(expected[i]->values()[j], batch.values(i)[j]);
+    }
+    EXPECT_DOUBLE_EQ(expected[i]->value(DateTime(Date(MonthOfYear::Jul, 4, 2013), Time(0, 12, 0, 0))),
+                     ts.value(DateTime(Date(MonthOfYear::Jul, 4, 2013), Time(0, 12, 0, 0))));
+  }
+
+  // all key values of a variable share the time axis of their environment period and reporting frequency
+  batch = sqlFile.timeSeriesBatch(std::vector<SqlFileTimeSeriesQuery>(1, SqlFileTimeSeriesQuery(EnvironmentIdentifier(envPeriod),
+      ReportingFrequency(ReportingFrequency::Hourly), TimeSeriesIdentifier("Zone Air Temperature"))));
+  std::vector<TimeSeries> zoneTemperatures = sqlFile.timeSeries(envPeriod, "Hourly", "Zone Air Temperature");
+  ASSERT_FALSE(zoneTemperatures.empty());
+  ASSERT_EQ(zoneTemperatures.size(), batch.size());
+  EXPECT_EQ(1u, batch.numTimeAxes());
+  for (unsigned i = 0; i < batch.size(); ++i) {
+    EXPECT_EQ(0u, batch.timeAxisIndex(i));
+    EXPECT_DOUBLE_EQ(sum(zoneTemperatures[i].values()), sum(batch.timeSeries(i).values()));
+  }
+
+  EXPECT_TRUE(sqlFile.timeSeriesBatch(std::vector<SqlFileTimeSeriesQuery>()).empty());
+}
+
+TEST_F(SqlFileFixture, TimeSeriesCursor)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  std::string envPeriod = availableEnvPeriods[0];
+
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  queries.push_back(SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, "Site Outdoor Air Drybulb Temperature", "Environment"));
+  queries.push_back(SqlFileTimeSeriesQuery(EnvironmentIdentifier(envPeriod), ReportingFrequency(ReportingFrequency::Hourly), TimeSeriesIdentifier("Zone Air Temperature")));
+  SqlFileTimeSeriesBatch batch = sqlFile.timeSeriesBatch(queries);
+  ASSERT_FALSE(batch.empty());
+
+  // small blocks so that time steps are split across many of them
+  SqlFileTimeSeriesCursor cursor = sqlFile.timeSeriesCursor(queries, 100);
+  EXPECT_EQ(100u, cursor.blockSize());
+  ASSERT_EQ(batch.size(), cursor.numTimeSeries());
+  std::vector<std::vector<double> > values(cursor.numTimeSeries());
+  std::vector<DateTime> dateTimes;
+  while (cursor.next()) {
+    EXPECT_LE(cursor.size(), 100u);
+    dateTimes.insert(dateTimes.end(), cursor.dateTimes().begin(), cursor.dateTimes().end());
+    for (unsigned i = 0; i < cursor.numTimeSeries(); ++i) {
+      ASSERT_EQ(cursor.size(), cursor.values(i).size());
+      for (double value : cursor.values(i)) {
+        if (!std::isnan(value)) {
+          values[i].push_back(value);
+        }
+      }
+    }
+  }
+  EXPECT_FALSE(cursor.next());
+  EXPECT_TRUE(cursor.empty());
+
+  for (unsigned i = 0; i < cursor.numTimeSeries(); ++i) {
+    boost::optional<unsigned> j = batch.find(cursor.environmentPeriod(i), cursor.reportingFrequency(i), cursor.timeSeriesName(i), cursor.keyValue(i));
+    ASSERT_TRUE(j);
+    EXPECT_EQ(batch.units(*j), cursor.units(i));
+    ASSERT_EQ(batch.values(*j).size(), values[i].size());
+    for (unsigned k = 0; k < values[i].size(); ++k) {
+      EXPECT_DOUBLE_EQ(batch.values(*j)[k], values[i][k]);
+    }
+  }
+  ASSERT_FALSE(dateTimes.empty());
+  EXPECT_EQ(batch.timeSeries(0).firstReportDateTime(), dateTimes.front());
+  EXPECT_TRUE(std::is_sorted(dateTimes.begin(), dateTimes.end()));
+
+  // export to csv a block at a time
+  openstudio::path csvPath = toPath("./SqlFileTimeSeriesCursor.csv");
+  {
+    cursor = sqlFile.timeSeriesCursor(queries);
+    std::ofstream csv(toString(csvPath));
+    csv << "Date/Time";
+    for (unsigned i = 0; i < cursor.numTimeSeries(); ++i) {
+      csv << "," << cursor.keyValue(i) << ":" << cursor.timeSeriesName(i) << " [" << cursor.units(i) << "]";
+    }
+    csv << std::endl;
+    while (cursor.next()) {
+      for (unsigned j = 0; j < cursor.size(); ++j) {
+        csv << cursor.dateTimes()[j];
+        for (unsigned i = 0; i < cursor.numTimeSeries(); ++i) {
+          csv << "," << cursor.values(i)[j];
+        }
+        csv << std::endl;
+      }
+    }
+  }
+  std::ifstream csv(toString(csvPath));
+  unsigned numLines = 0;
+  for (std::string line; std::getline(csv, line);) {
+    ++numLines;
+  }
+  EXPECT_EQ(dateTimes.size() + 1, numLines);
+
+  EXPECT_EQ(0u, sqlFile.timeSeriesCursor(std::vector<SqlFileTimeSeriesQuery>()).numTimeSeries());
+}
+
+TEST_F(SqlFileFixture, DISABLED_TimeSeriesBatchBenchmark)
+{
+  // every available time series, one query per variable versus a single batch
+  std::vector<SqlFileTimeSeriesQuery> queries;
+  for (const std::string& envPeriod : sqlFile2.availableEnvPeriods()) {
+    for (const std::string& reportingFrequency : sqlFile2.availableReportingFrequencies(envPeriod)) {
+      boost::optional<ReportingFrequency> rf = sqlFile2.reportingFrequencyFromDB(reportingFrequency);
+      if (!rf) {
+        continue;
+      }
+      for (const std::string& variableName : sqlFile2.availableVariableNames(envPeriod, reportingFrequency)) {
+        queries.push_back(SqlFileTimeSeriesQuery(EnvironmentIdentifier(envPeriod), *rf, TimeSeriesIdentifier(variableName)));
+      }
+    }
+  }
+
+  SqlFile sql1(sqlFile2.path());
+  auto start = std::chrono::steady_clock::now();
+  unsigned n = 0;
+  for (const SqlFileTimeSeriesQuery& query : queries) {
+    n += sql1.timeSeries(query).size();
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  SqlFile sql2(sqlFile2.path());
+  auto batchStart = std::chrono::steady_clock::now();
+  SqlFileTimeSeriesBatch batch = sql2.timeSeriesBatch(queries);
+  auto batchEnd = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(n, batch.size());
+  std::cout << "Retrieved " << n << " time series in " << std::chrono::duration<double, std::milli>(end - start).count() << " ms, "
+            << batch.size() << " on " << batch.numTimeAxes() << " time axes in a batch in "
+            << std::chrono::duration<double, std::milli>(batchEnd - batchStart).count() << " ms" << std::endl;
+}
+
+TEST_F(SqlFileFixture, ReadOnly)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  std::string envPeriod = availableEnvPeriods[0];
+  std::vector<std::string> keyValues = sqlFile.availableKeyValues(envPeriod, "Hourly", "Zone Air Temperature");
+  ASSERT_FALSE(keyValues.empty());
+  int numIndexes = sqlFile.execAndReturnFirstInt("SELECT COUNT(*) FROM sqlite_master WHERE type='index'").get();
+
+  EXPECT_EQ(SqlFileOpenMode::ReadWrite, sqlFile.openMode().value());
+
+  for (bool createIndexes : {false, true}) {
+    SqlFile readOnly(sqlFile.path(), SqlFileOpenMode::ReadOnly, createIndexes);
+    ASSERT_TRUE(readOnly.connectionOpen());
+    EXPECT_EQ(SqlFileOpenMode::ReadOnly, readOnly.openMode().value());
+    ASSERT_TRUE(readOnly.netSiteEnergy());
+    EXPECT_DOUBLE_EQ(sqlFile.netSiteEnergy().get(), readOnly.netSiteEnergy().get());
+
+    // writes are rejected
+    EXPECT_NE(0, readOnly.execute("CREATE TABLE ReadOnlyTest (Id INTEGER)"));
+
+    // every thread queries on its own connection, results are the same as on a single thread
+    std::vector<double> expected;
+    for (const std::string& keyValue : keyValues) {
+      expected.push_back(sum(sqlFile.timeSeries(envPeriod, "Hourly", "Zone Air Temperature", keyValue)->values()));
+    }
+    std::vector<std::vector<double>> results(4, std::vector<double>(keyValues.size()));
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < results.size(); ++t) {
+      threads.emplace_back([&, t]() {
+        for (unsigned i = 0; i < keyValues.size(); ++i) {
+          boost::optional<TimeSeries> ts = readOnly.timeSeries(envPeriod, "Hourly", "Zone Air Temperature", keyValues[i]);
+          results[t][i] = ts ? sum(ts->values()) : 0.0;
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    for (const std::vector<double>& result : results) {
+      for (unsigned i = 0; i < keyValues.size(); ++i) {
+        EXPECT_DOUBLE_EQ(expected[i], result[i]);
+      }
+    }
+  }
+
+  // indexes of a read only file are created in a temporary copy, the file itself is unchanged
+  EXPECT_EQ(numIndexes, sqlFile.execAndReturnFirstInt("SELECT COUNT(*) FROM sqlite_master WHERE type='index'").get());
+  EXPECT_FALSE(sqlFile.execAndReturnFirstInt("SELECT COUNT(*) FROM sqlite_master WHERE name='ReadOnlyTest'").get());
+}
+
+TEST_F(SqlFileFixture, ReadOnlyConcurrentDictionary)
+{
+  std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_FALSE(availableEnvPeriods.empty());
+  std::string envPeriod = availableEnvPeriods[0];
+
+  // every hourly series, none of them cached yet on the read only file
+  std::vector<std::pair<std::string, std::string> > series;
+  std::vector<double> expected;
+  for (const std::string& name : sqlFile.availableVariableNames(envPeriod, "Hourly")) {
+    for (const std::string& keyValue : sqlFile.availableKeyValues(envPeriod, "Hourly", name)) {
+      boost::optional<TimeSeries> ts = sqlFile.timeSeries(envPeriod, "Hourly", name, keyValue);
+      ASSERT_TRUE(ts);
+      series.push_back(std::make_pair(name, keyValue));
+      expected.push_back(sum(ts->values()));
+    }
+  }
+  ASSERT_LT(1u, series.size());
+  std::vector<SqlFileTimeSeriesQuery> queries{SqlFileTimeSeriesQuery(envPeriod, ReportingFrequency::Hourly, series[0].first, series[0].second)};
+
+  SqlFile readOnly(sqlFile.path(), SqlFileOpenMode::ReadOnly, false);
+  ASSERT_TRUE(readOnly.connectionOpen());
+
+  // series are cached by some threads while others look up the data dictionary
+  std::vector<std::vector<double> > results(4, std::vector<double>(series.size()));
+  std::atomic<bool> done(false);
+  std::atomic<unsigned> numLookups(0);
+  std::atomic<bool> lookupsMatch(true);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < results.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      for (unsigned k = 0; k < series.size(); ++k) {
+        unsigned i = (k + t * series.size() / results.size()) % series.size();
+        boost::optional<TimeSeries> ts = readOnly.timeSeries(envPeriod, "Hourly", series[i].first, series[i].second);
+        results[t][i] = ts ? sum(ts->values()) : 0.0;
+      }
+    });
+  }
+  for (unsigned t = 0; t < 2; ++t) {
+    threads.emplace_back([&]() {
+      while (!done || (numLookups < 4)) {
+        if (readOnly.availableKeyValues(envPeriod, "Hourly", series[0].first).empty()) {
+          lookupsMatch = false;
+        }
+        // resolved through the items of the data dictionary
+        if (readOnly.timeSeriesBatch(queries).size() != 1u) {
+          lookupsMatch = false;
+        }
+        ++numLookups;
+      }
+    });
+  }
+  for (unsigned t = 0; t < results.size(); ++t) {
+    threads[t].join();
+  }
+  done = true;
+  for (unsigned t = results.size(); t < threads.size(); ++t) {
+    threads[t].join();
+  }
+
+  EXPECT_TRUE(lookupsMatch);
+  for (const std::vector<double>& result : results) {
+    for (unsigned i = 0; i < series.size(); ++i) {
+      EXPECT_DOUBLE_EQ(expected[i], result[i]);
+    }
+  }
+
+  // cached series are returned again
+  for (unsigned i = 0; i < series.size(); ++i) {
+    boost::optional<TimeSeries> ts = readOnly.timeSeries(envPeriod, "Hourly", series[i].first, series[i].second);
+    ASSERT_TRUE(ts);
+    EXPECT_DOUBLE_EQ(expected[i], sum(ts->values()));
+  }
+}
+
+TEST_F(SqlFileFixture, DISABLED_ReadOnlyThroughput)
+{
+  // every available time series, split between an increasing number of threads sharing one read only file
+  std::vector<std::vector<std::string>> queries;
+  for (const std::string& envPeriod : sqlFile2.availableEnvPeriods()) {
+    for (const std::string& reportingFrequency : sqlFile2.availableReportingFrequencies(envPeriod)) {
+      for (const std::string& variableName : sqlFile2.availableVariableNames(envPeriod, reportingFrequency)) {
+        for (const std::string& keyValue : sqlFile2.availableKeyValues(envPeriod, reportingFrequency, variableName)) {
+          queries.push_back({envPeriod, reportingFrequency, variableName, keyValue});
+        }
+      }
+    }
+  }
+
+  // not timed, the first pass pages the file in so that every thread count reads it from memory
+  {
+    SqlFile warmUp(sqlFile2.path(), SqlFileOpenMode::ReadOnly, false);
+    for (const std::vector<std::string>& query : queries) {
+      EXPECT_TRUE(warmUp.timeSeries(query[0], query[1], query[2], query[3]));
+    }
+  }
+
+  for (unsigned numThreads : {1u, 2u, 4u, 8u}) {
+    // a file of its own, time series already read are cached in its data dictionary
+    SqlFile readOnly(sqlFile2.path(), SqlFileOpenMode::ReadOnly, false);
+    std::atomic<unsigned> next(0);
+    std::atomic<unsigned> n(0);
+    std::atomic<size_t> numValues(0);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+      threads.emplace_back([&]() {
+        for (unsigned i = next++; i < queries.size(); i = next++) {
+          boost::optional<TimeSeries> ts = readOnly.timeSeries(queries[i][0], queries[i][1], queries[i][2], queries[i][3]);
+          if (ts) {
+            ++n;
+            numValues += ts->values().size();
+          }
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_EQ(queries.size(), n.load());
+    std::cout << "Retrieved " << n.load() << " time series (" << numValues.load() << " values) on " << numThreads << " threads in "
+              << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+  }
+}
+
 TEST_F(SqlFileFixture, CreateSqlFile)
 {
   openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTest.sql");